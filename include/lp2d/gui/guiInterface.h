@@ -22,10 +22,20 @@
 #include "lp2d/renderer/plotRenderer.h"
 #include "lp2d/gui/plotListGrid.h"
 #include "lp2d/parser/fileTypeManager.h"
+#include "lp2d/parser/channelCache.h"
+#include "lp2d/gui/jobProgressDialog.h"
+#include "lp2d/utilities/jobQueue.h"
+#include "lp2d/utilities/dataStream.h"
+
+// wxWidgets headers
+#include <wx/weakref.h>
+#include <wx/timer.h>
 
 // Standard C++ headers
 #include <memory>
 #include <type_traits>
+#include <functional>
+#include <set>
 
 // wxWidgets forward declarations
 class wxArrayString;
@@ -48,28 +58,94 @@ public:
 	/// \param owner Object owning the associated GUI components.
 	explicit GuiInterface(wxFrame* owner);
 
+	/// Destructor.  Cancels any background jobs which are still running and
+	/// closes any open streams.
+	~GuiInterface();
+
+	/// Function receiving the outcome of LoadFiles() or LoadText().  Called
+	/// exactly once:  with true after the curves have been added to the
+	/// plot, or with false if no data was loaded (including when the load is
+	/// cancelled).
+	typedef std::function<void(const bool& loaded)> LoadCallback;
+
 	/// Loads the specified files.  When the first file is loaded, user will be
 	/// prompted to select which data channels to extract.  If the file format
 	/// (including header rows, etc.) of subsequent files is the same, the same
 	/// extraction options will be used.  If the file format or file header
 	/// changes, the user will be prompted to make extraction selections again.
 	///
+	/// The data is extracted in the background; the curves are added to the
+	/// plot once all of the files have been read.
+	///
 	/// \param fileList List of files to load.
+	/// \param onLoaded Function to execute on the main thread once loading
+	///                 is complete (only if this returns true).
 	///
-	/// \returns True if all files were successfully loaded.
-	bool LoadFiles(const wxArrayString &fileList);
-
-	/// Loads the specified text data as if it were read from a file.
+	/// \returns True if loading was started (false if the user cancelled or
+	///          if none of the files could be opened).
+	bool LoadFiles(const wxArrayString &fileList,
+		LoadCallback onLoaded = nullptr);
+
+	/// Loads the specified text data as if it were read from a file.  The
+	/// format is identified from the contents as it is for files, and the
+	/// data is parsed in memory (no temporary file is created) in the
+	/// background.
 	///
-	/// \param data Text data to parse.
+	/// \param data     Text data to parse.
+	/// \param onLoaded Function to execute on the main thread once loading
+	///                 is complete (only if this returns true).
 	///
-	/// \returns True if the data was successfully loaded.
-	bool LoadText(const wxString& data);
+	/// \returns True if loading was started.
+	bool LoadText(const wxString& data, LoadCallback onLoaded = nullptr);
+
+	/// Requests cancellation of all background jobs (loading files, computing
+	/// FFTs, etc.).  Results from cancelled jobs are discarded.
+	void CancelAllJobs() { mJobQueue.CancelAll(); }
+
+	/// Checks to see if any background jobs are still running.
+	/// \returns True if any background job has not yet completed.
+	bool IsBusy() const { return !mJobQueue.IsIdle(); }
 
 	/// Reloads the last set of data that was loaded with a single
 	/// drag-and-drop or Open button click.
 	void ReloadData();
 
+	/// Enables or disables lazy loading.  When enabled, LoadFiles() only
+	/// indexes the selected channels (for file types which support it) and
+	/// the data for each channel is extracted when the curve is first made
+	/// visible or used in a math channel.  Only the first channel of each
+	/// file is initially visible.
+	///
+	/// \param lazy Flag indicating whether or not to load lazily.
+	void SetLazyLoading(const bool& lazy) { mLazyLoading = lazy; }
+
+	/// Gets the flag indicating whether or not lazy loading is enabled.
+	/// \returns True if lazy loading is enabled.
+	bool GetLazyLoading() const { return mLazyLoading; }
+
+	/// Sets the maximum amount of memory to use for lazily loaded data.  When
+	/// exceeded, the data for the least recently used hidden curves is
+	/// released (and will be extracted again if needed).
+	///
+	/// \param bytes Memory budget in bytes.  Use zero for no limit.
+	void SetLazyLoadMemoryBudget(const unsigned long long& bytes)
+	{ mChannelCache.SetMemoryBudget(bytes); }
+
+	/// Sets the interval at which the curves are updated while files are
+	/// being loaded.  Curves are added as soon as the first portion of the
+	/// file has been parsed, and the remaining data is appended as it
+	/// becomes available.  Does not apply to lazily loaded files.
+	///
+	/// \param bytes Amount of each file to parse between updates.  Use zero
+	///              to add the curves only once loading is complete.
+	void SetProgressiveLoadInterval(const unsigned long long& bytes)
+	{ mProgressiveLoadInterval = bytes; }
+
+	/// Gets the interval at which curves are updated while loading.
+	/// \returns The interval [bytes].
+	unsigned long long GetProgressiveLoadInterval() const
+	{ return mProgressiveLoadInterval; }
+
 	void Copy();///< Copies rendered image to clipboard.
 	void Paste();///< Pastes delimited text as curve data.
 
@@ -105,6 +181,21 @@ public:
 	///                visible initially
 	void AddCurve(std::unique_ptr<Dataset2D> data, wxString name, const bool& visible = true);
 
+	/// Adds a new curve which displays data pushed to the returned stream.
+	/// Samples may be pushed from any one thread (see DataStream); they are
+	/// appended to the curve on the main thread at display rate.  The stream
+	/// is closed when the curve is removed.
+	///
+	/// \param name     Name to display to identify the curve.
+	/// \param capacity Maximum number of samples to buffer between updates.
+	/// \param policy   Method for handling samples pushed to a full buffer.
+	///
+	/// \returns Stream for providing data to the curve.
+	std::shared_ptr<DataStream> AddStream(const wxString& name,
+		const unsigned int& capacity = 65536,
+		const DataStream::OverflowPolicy& policy
+		= DataStream::OverflowPolicy::Block);
+
 	/// Removes the specified curve from the plot.
 	///
 	/// \param i Index of the curve to remove.
@@ -136,6 +227,8 @@ public:
 	};
 
 	/// Adds a descendant of DataFile to the list of recognizable file types.
+	/// The type is also offered pasted text if it hides
+	/// DataFile::IsBufferType().
 	template<typename T>
 	void RegisterFileType();
 
@@ -275,7 +368,35 @@ private:
 
 	wxString mApplicationTitle;
 
-	wxString GenerateTemporaryFileName(const unsigned int &length = 10) const;
+	/// Files (and associated options) to be loaded by a background job.
+	struct LoadRequest
+	{
+		std::vector<std::unique_ptr<DataFile>> files;
+		wxArrayString sourceNames;
+		std::vector<DataFile::SelectionData> selections;
+		std::vector<bool> lazy;
+		std::vector<bool> loaded;
+
+		/// Interval at which partial data is delivered [bytes].
+		unsigned long long progressiveInterval = 0;
+
+		/// Datasets receiving partial data for each file (main thread only).
+		std::vector<std::vector<Dataset2D*>> progressiveCurves;
+		bool curvesCleared = false;///< Set once existing curves are handled.
+
+		/// Executed once on the main thread when loading is complete.
+		LoadCallback onComplete;
+	};
+
+	bool LoadDataFiles(std::vector<std::unique_ptr<DataFile>>& files,
+		const wxArrayString& sourceNames, LoadCallback onComplete);
+	void AddLoadedFiles(LoadRequest& request);
+	static void ReportLoadComplete(LoadRequest& request, const bool& loaded);
+	void AppendLoadedData(LoadRequest& request, const unsigned int& file,
+		std::vector<std::unique_ptr<Dataset2D>>& data);
+	void PrepareForLoadedCurves(LoadRequest& request, const unsigned int& file);
+	static wxString GetLoadedCurveName(const LoadRequest& request,
+		const unsigned int& file, const unsigned int& channel);
 
 	wxArrayString mLastFilesLoaded;
 	DataFile::SelectionData mLastSelectionInfo;
@@ -283,6 +404,45 @@ private:
 
 	FileTypeManager mFileTypeManager;
 
+	bool mLazyLoading = false;
+	ChannelCache mChannelCache;
+
+	unsigned long long mProgressiveLoadInterval = 16 * 1024 * 1024;// [bytes]
+
+	/// Curves which are still receiving data from a background load.
+	std::set<const Dataset2D*> mLoadingCurves;
+
+	/// Streams and the curves to which their data is appended.
+	struct StreamCurve
+	{
+		Dataset2D* data;
+		std::shared_ptr<DataStream> stream;
+	};
+
+	std::vector<StreamCurve> mStreams;
+
+	/// Timer for periodically draining the streams.
+	class StreamTimer : public wxTimer
+	{
+	public:
+		explicit StreamTimer(GuiInterface& guiInterface)
+			: mGuiInterface(guiInterface) {}
+		void Notify() override { mGuiInterface.DrainStreams(); }
+
+	private:
+		GuiInterface& mGuiInterface;
+	};
+
+	StreamTimer mStreamTimer{ *this };
+	static const int mStreamDrainInterval;// [msec]
+
+	void DrainStreams();
+
+	void EnsureCurvesLoaded(const std::vector<unsigned int>& curves);
+	void EnsureCurvesLoaded(const wxArrayInt& selectedRows);
+	static std::vector<unsigned int> GetReferencedCurves(
+		const wxString& mathString);
+
 	FileFormat mCurrentFileFormat = FileFormat::Generic;
 	wxString mGenericXAxisLabel;
 
@@ -293,17 +453,14 @@ private:
 
 	FilterParameters DisplayFilterDialog();
 	void ApplyFilter(const FilterParameters &parameters,
-		const std::unique_ptr<Dataset2D>& data);
+		const double& xFactor, Dataset2D& data) const;
 
 	std::unique_ptr<Dataset2D> GetCurveFitData(const unsigned int &order,
-		const std::unique_ptr<const Dataset2D>& data, wxString &name,
+		const Dataset2D& data, wxString &name,
 		const unsigned int& row) const;
 	wxString GetCurveFitName(const CurveFit::PolynomialFit &fitData,
 		const unsigned int &row) const;
 
-	std::unique_ptr<Dataset2D> GetFFTData(
-		const std::unique_ptr<const Dataset2D>& data);
-
 	std::unique_ptr<Filter> GetFilter(const FilterParameters &parameters,
 		const double &sampleRate, const double &initialValue) const;
 
@@ -323,6 +480,16 @@ private:
 	void UpdateCurveProperties(const unsigned int &index,
 		const Color &color, const bool &visible,
 		const bool &rightAxis);
+
+	// Declared last so that the worker threads are stopped before anything
+	// else is destroyed
+	JobQueue mJobQueue;
+	wxWeakRef<JobProgressDialog> mJobProgressDialog;
+
+	void StartJob(const wxString& description, JobQueue::Work work,
+		std::function<void()> onCancelled = nullptr);
+	void PostCurve(JobQueue::Context& context, std::unique_ptr<Dataset2D> data,
+		const wxString& name, const bool& showMarkers = true);
 };
 
 
@@ -331,7 +498,8 @@ void GuiInterface::RegisterFileType()
 {
 	static_assert(std::is_base_of<DataFile, T>::value,
 		"T must be a descendant of DataFile");
-	mFileTypeManager.RegisterFileType(T::IsType, DataFile::Create<T>);
+	mFileTypeManager.RegisterFileType(T::IsType, DataFile::Create<T>,
+		T::IsBufferType, DataFile::CreateFromBuffer<T>);
 }
 
 }// namespace LibPlot2D
@@ -0,0 +1,99 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  jobProgressDialog.h
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Non-modal dialog for displaying the progress of background jobs.
+
+#ifndef JOB_PROGRESS_DIALOG_H_
+#define JOB_PROGRESS_DIALOG_H_
+
+// Local headers
+#include "lp2d/utilities/jobQueue.h"
+
+// wxWidgets headers
+#include <wx/dialog.h>
+#include <wx/timer.h>
+
+// Standard C++ headers
+#include <vector>
+
+// wxWidgets forward declarations
+class wxStaticText;
+class wxGauge;
+class wxButton;
+class wxSizer;
+
+namespace LibPlot2D
+{
+
+/// Non-modal dialog for displaying the progress of the jobs in a JobQueue.
+/// This dialog is also responsible for periodically calling
+/// JobQueue::ProcessPending() while jobs are active, so that results are
+/// delivered to the main thread even when the dialog is hidden.  The dialog
+/// is only shown if jobs remain active for more than a short time.
+class JobProgressDialog : public wxDialog
+{
+public:
+	/// Constructor.
+	///
+	/// \param parent Pointer to the window that owns this.
+	/// \param jobs   Queue to monitor.  Must outlive this object (or Stop()
+	///               must be called prior to destroying the queue).
+	JobProgressDialog(wxWindow* parent, JobQueue& jobs);
+
+	/// Begins monitoring the queue.  Should be called after submitting jobs.
+	void Start();
+
+	/// Stops monitoring the queue and hides the dialog.
+	void Stop();
+
+private:
+	JobQueue& mJobs;
+	wxTimer mTimer;
+
+	/// Number of timer ticks for which jobs have been active.
+	unsigned int mActiveTicks = 0;
+	bool mHiddenByUser = false;
+
+	struct JobControls
+	{
+		unsigned int id;
+		wxStaticText* description;
+		wxGauge* gauge;
+		wxButton* cancelButton;
+	};
+
+	std::vector<JobControls> mJobControls;
+	wxSizer* mJobSizer;
+
+	void CreateControls();
+	void UpdateJobControls(const std::vector<JobQueue::JobStatus>& status);
+
+	static const int mTimerInterval;// [msec]
+	static const unsigned int mShowDelayTicks;
+	static const int mGaugeRange;
+
+	enum EventIDs
+	{
+		idTimer = wxID_HIGHEST + 600,
+		idCancelAll
+	};
+
+	void OnTimer(wxTimerEvent& event);
+	void OnCancelButton(wxCommandEvent& event);
+	void OnCancelAllButton(wxCommandEvent& event);
+	void OnClose(wxCloseEvent& event);
+
+	DECLARE_EVENT_TABLE();
+};
+
+}// namespace LibPlot2D
+
+#endif// JOB_PROGRESS_DIALOG_H_
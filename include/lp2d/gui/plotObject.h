@@ -138,6 +138,12 @@ public:
 	/// \param pretty Set true to use the higher quality rendering algorithm.
 	void SetPrettyCurves(const bool &pretty) { mPretty = pretty; }
 
+	/// Sets the flag indicating whether or not to draw the curves with cheaper
+	/// (draft quality) geometry.
+	///
+	/// \param draft Set true to use draft quality geometry.
+	void SetDraftCurves(const bool &draft) { mDraft = draft; }
+
 	/// \name Text object controls
 	/// @{
 
@@ -188,6 +194,14 @@ public:
 	/// \returns The total number of curves.
 	unsigned int GetCurveCount() const { return mPlotList.size(); }
 
+	/// Gets the specified curve.
+	///
+	/// \param index Index of the curve.
+	///
+	/// \returns Reference to the curve.
+	const PlotCurve& GetCurve(const unsigned int& index) const
+	{ return *mPlotList[index]; }
+
 	/// Gets the total number of points.
 	/// \returns The total number of points.
 	unsigned long long GetTotalPointCount() const;
@@ -254,6 +268,7 @@ private:
 	bool mRightUsed;
 
 	bool mPretty;
+	bool mDraft = false;
 
 	double mXMajorResolution;
 	double mYLeftMajorResolution;
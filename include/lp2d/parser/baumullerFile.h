@@ -41,6 +41,15 @@ public:
 	/// object of this type.
 	static bool IsType(const wxString &fileName);
 
+	/// Checks to determine if the specified in-memory contents can
+	/// successfully be an object of this type.
+	///
+	/// \param buffer Contents to examine.
+	///
+	/// \returns True if the contents are likely to be compatible with an
+	/// object of this type.
+	static bool IsBufferType(const std::string &buffer);
+
 protected:
 	wxArrayString GetCurveInformation(unsigned int &headerLineCount,
 		std::vector<double> &factors,
@@ -49,7 +58,9 @@ protected:
 	void DoTypeSpecificProcessTasks() override;
 
 private:
-	bool ConstructNames(std::string &nextLine, std::ifstream &file,
+	static bool HasIdentifier(std::istream &file);
+
+	bool ConstructNames(std::string &nextLine, std::istream &file,
 		wxArrayString &names, wxArrayString &previousLines) const;
 
 	friend std::unique_ptr<DataFile>
@@ -0,0 +1,114 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  channelCache.h
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Manages lazily loaded data channels, extracting data on demand and
+//        releasing the least recently used data to stay within a memory
+//        budget.
+
+#ifndef CHANNEL_CACHE_H_
+#define CHANNEL_CACHE_H_
+
+// Standard C++ headers
+#include <vector>
+#include <map>
+#include <memory>
+
+namespace LibPlot2D
+{
+
+// Local forward declarations
+class DataFile;
+class Dataset2D;
+
+/// Class for managing data channels which were loaded with
+/// DataFile::LoadIndex().  The datasets registered with this object are
+/// initially empty; they are populated in place when requested with Load().
+/// When the total size of the populated datasets exceeds the memory budget,
+/// the data for the least recently used channels is released (the dataset
+/// objects themselves remain valid, but empty, and can be loaded again
+/// later).
+class ChannelCache
+{
+public:
+	/// Adds the specified file and its channels to the cache.
+	///
+	/// \param file     File which was prepared with DataFile::LoadIndex().
+	/// \param channels Datasets to populate on demand.  Element i corresponds
+	///                 to DataFile::GetDataset(i).  The caller retains
+	///                 ownership of the datasets, but must call Remove() prior
+	///                 to deleting them.
+	void AddSource(std::unique_ptr<DataFile> file,
+		const std::vector<Dataset2D*>& channels);
+
+	/// Removes the specified dataset from the cache.  Has no effect if the
+	/// dataset is not managed by this object.
+	///
+	/// \param dataset Dataset to remove.
+	void Remove(const Dataset2D* dataset);
+
+	/// Removes all datasets and files from the cache.
+	void Clear() { mChannels.clear(); }
+
+	/// Checks to see if any datasets are managed by this object.
+	/// \returns True if no datasets are managed by this object.
+	bool IsEmpty() const { return mChannels.empty(); }
+
+	/// Ensures that the specified datasets are populated.  Datasets which are
+	/// not managed by this object are ignored.  If any data was extracted and
+	/// the memory budget is exceeded as a result, data for the least recently
+	/// used datasets not contained in \p required is released.
+	///
+	/// \param required Datasets which must be populated.
+	///
+	/// \returns True if any dataset was populated.
+	bool Load(const std::vector<const Dataset2D*>& required);
+
+	/// Sets the maximum amount of memory to use for storing data.  Note that
+	/// datasets passed to Load() are always populated, even if the budget is
+	/// exceeded as a result.
+	///
+	/// \param bytes Memory budget in bytes.  Use zero for no limit.
+	void SetMemoryBudget(const unsigned long long& bytes)
+	{ mMemoryBudget = bytes; }
+
+	/// Gets the memory budget.
+	/// \returns The memory budget in bytes.
+	unsigned long long GetMemoryBudget() const { return mMemoryBudget; }
+
+	/// Gets the memory currently used by populated datasets.
+	/// \returns The memory used in bytes.
+	unsigned long long GetMemoryUsage() const;
+
+private:
+	struct Channel
+	{
+		std::shared_ptr<DataFile> file;
+		unsigned int index;
+		Dataset2D* dataset;
+		bool loaded = false;
+		unsigned long long lastUsed = 0;
+	};
+
+	std::map<const Dataset2D*, Channel> mChannels;
+
+	unsigned long long mMemoryBudget = 0;
+	unsigned long long mUseCounter = 0;
+
+	bool Extract(const std::vector<Channel*>& channels);
+	bool ReleaseUnused(const std::vector<const Dataset2D*>& required);
+
+	static unsigned long long GetSize(const Dataset2D& dataset);
+	static void Release(Dataset2D& dataset);
+};
+
+}// namespace LibPlot2D
+
+#endif// CHANNEL_CACHE_H_
@@ -43,11 +43,26 @@ public:
 	/// object of this type.
 	static bool IsType(const wxString &fileName);
 
+	/// Checks to determine if the specified in-memory contents can
+	/// successfully be an object of this type.
+	///
+	/// \param buffer Contents to examine.
+	///
+	/// \returns True if the contents are likely to be compatible with an
+	/// object of this type.
+	static bool IsBufferType(const std::string &buffer);
+
+	bool SupportsLazyLoad() const override { return false; }
+	bool SupportsProgressiveLoad() const override
+	{ return !mFileFormat.IsAsynchronous(); }
+
 protected:
 	CustomFileFormat mFileFormat;///< Information about the custom format.
 
+	void UseBuffer(std::string buffer) override;
+
 	wxArrayString CreateDelimiterList() const override;
-	bool ExtractData(std::ifstream &file, const wxArrayInt &choices,
+	bool ExtractData(std::istream &file, const wxArrayInt &choices,
 		std::vector<std::vector<double>>& rawData,
 		std::vector<double> &factors, wxString &errorString) const override;
 	void AssembleDatasets(
@@ -60,7 +75,7 @@ protected:
 		const unsigned int &selectedCount) const override;
 
 private:
-	bool ExtractSpecialData(std::ifstream &file, const wxArrayInt &choices,
+	bool ExtractSpecialData(std::istream &file, const wxArrayInt &choices,
 		std::vector<std::vector<double>>& rawData,
 		std::vector<double> &factors, wxString &errorString) const;
 	bool ExtractAsynchronousData(double &timeZero,
@@ -17,6 +17,9 @@
 
 // Standard C++ headers
 #include <vector>
+#include <istream>
+#include <string>
+#include <memory>
 
 // wxWidgets headers
 #include <wx/wx.h>
@@ -38,6 +41,14 @@ public:
 	/// \param pathAndFileName Path and file name of desired file.
 	explicit CustomFileFormat(const wxString &pathAndFileName);
 
+	/// Constructor for identifying the format of data held in memory.
+	///
+	/// \param sourceName Name used to identify the data (in place of a file
+	///                   name when matching format extensions).
+	/// \param buffer     Contents to examine.  The buffer is only used
+	///                   during construction.
+	CustomFileFormat(const wxString &sourceName, const std::string &buffer);
+
 	/// Checks to see if this object is associated with a custom format.
 	/// \returns True if a suitable custom format was recognized.
 	bool IsCustomFormat() const { return !mFormatName.IsEmpty(); }
@@ -94,7 +105,11 @@ private:
 	static const wxString mCustomFormatsRootName;
 	static const unsigned long mCustomFormatsVersion;
 
-	const wxString mPathAndFileName;
+	wxString mPathAndFileName;
+
+	/// Contents to examine in place of the file (only set during
+	/// construction).
+	const std::string* mBuffer = nullptr;
 
 	wxString mFormatName;
 	wxString mDelimiter;
@@ -102,8 +117,8 @@ private:
 	wxString mTimeFormat;
 	wxString mEndIdentifier;
 
-	bool mAsynchronous;
-	bool mIsXML;
+	bool mAsynchronous = false;
+	bool mIsXML = false;
 
 	wxString mXDataNode;
 	wxString mXDataKey;
@@ -144,11 +159,15 @@ private:
 
 	std::vector<Channel> mChannels;
 
+	void ReadFormatDefinitions();
 	bool CheckRootAndVersion(const wxXmlDocument &document) const;
 
-	bool IsFormat(const wxString &pathAndFileName, const Identifier &id);
-	bool MatchNextLine(std::ifstream &inFile, const Identifier &id) const;
-	bool MatchNextLine(std::ifstream &inFile, const wxString &textToMatch,
+	std::unique_ptr<std::istream> OpenStream() const;
+	bool LoadDocument(wxXmlDocument &document) const;
+
+	bool IsFormat(const Identifier &id);
+	bool MatchNextLine(std::istream &inFile, const Identifier &id) const;
+	bool MatchNextLine(std::istream &inFile, const wxString &textToMatch,
 		const bool &matchCase = false) const;
 
 	bool ReadFormatTag(wxXmlNode &formatNode);
@@ -160,7 +179,7 @@ private:
 
 	bool ProcessLocationID(const wxString &value, Identifier &id) const;
 	bool ProcessFormatChildren(wxXmlNode *formatChild, Identifier &id);
-	bool MatchSpecifiedLine(std::ifstream &inFile, const Identifier &id) const;
+	bool MatchSpecifiedLine(std::istream &inFile, const Identifier &id) const;
 
 	bool ReadCodeOrColumn(wxXmlNode &channelNode, Channel &channel) const;
 	bool ReadCode(wxXmlNode &channelNode, Channel &channel) const;
@@ -45,17 +45,31 @@ public:
 	/// object of this type.
 	static bool IsType(const wxString &fileName);
 
+	/// Checks to determine if the specified in-memory contents can
+	/// successfully be an object of this type.
+	///
+	/// \param buffer Contents to examine.
+	///
+	/// \returns True if the contents are likely to be compatible with an
+	/// object of this type.
+	static bool IsBufferType(const std::string &buffer);
+
+	bool SupportsLazyLoad() const override { return false; }
+
 protected:
 	CustomFileFormat mFileFormat;///< Information about the custom format.
 
+	void UseBuffer(std::string buffer) override;
+
 	wxArrayString CreateDelimiterList() const override;
-	bool ExtractData(std::ifstream &file, const wxArrayInt &choices,
+	bool ExtractData(std::istream &file, const wxArrayInt &choices,
 		std::vector<std::vector<double>>& rawData, std::vector<double> &factors,
 		wxString &errorString) const override;
 	wxArrayString GetCurveInformation(unsigned int &headerLineCount,
 		std::vector<double> &factors, wxArrayInt &nonNumericColumns) const override;
 
 private:
+	bool LoadDocument(wxXmlDocument &document) const;
 	wxArrayString SeparateNodes(const wxString &nodePath) const;
 	wxXmlNode* FollowNodePath(const wxXmlDocument &document, const wxString &path) const;
 	wxXmlNode* FollowNodePath(wxXmlNode *node, const wxString &path) const;
@@ -16,6 +16,7 @@
 
 // Local headers
 #include "lp2d/utilities/dataset2D.h"
+#include "lp2d/utilities/jobQueue.h"
 
 // wxWidgets headers
 #include <wx/wx.h>
@@ -23,7 +24,11 @@
 // Standard C++ headers
 #include <vector>
 #include <fstream>
+#include <string>
+#include <istream>
 #include <memory>
+#include <atomic>
+#include <functional>
 
 namespace LibPlot2D
 {
@@ -44,6 +49,11 @@ namespace LibPlot2D
 /// types to be registerable with FileTypeManager) that their constructors take
 ///	a single `const wxString&` argument.
 ///
+/// Types which can also identify data held in memory (i.e. pasted from the
+/// clipboard) should hide IsBufferType() with their own version.  The default
+/// version never matches, so such data is not offered to types which only
+/// know how to examine files.
+///
 /// \see FileTypeManager
 /// \see GuiInterface
 class DataFile
@@ -59,6 +69,58 @@ public:
 	template<typename T>
 	static std::unique_ptr<DataFile> Create(const wxString& fileName);
 
+	/// Factory method for creating new DataFile objects which parse their
+	/// contents from memory instead of from disk (i.e. for clipboard data).
+	///
+	/// \param buffer     Contents to parse.
+	/// \param sourceName Name used to identify the data in messages.
+	///
+	/// \returns Pointer to a new DataFile of the appropriate type.
+	template<typename T>
+	static std::unique_ptr<DataFile> CreateFromBuffer(std::string buffer,
+		const wxString& sourceName);
+
+	/// Checks to determine if the specified in-memory contents can
+	/// successfully be an object of this type.  This default version is used
+	/// by types which can only examine files.
+	///
+	/// \param buffer Contents to examine.
+	///
+	/// \returns True if the contents are likely to be compatible with an
+	///          object of this type.
+	static bool IsBufferType(const std::string& WXUNUSED(buffer))
+	{ return false; }
+
+	/// Read-only stream which reads directly from an existing buffer without
+	/// making a copy of the contents.  The buffer must outlive the stream.
+	class MemoryStream : public std::istream
+	{
+	public:
+		/// Constructor.
+		///
+		/// \param buffer Contents to be read by this stream.
+		explicit MemoryStream(const std::string& buffer);
+
+	private:
+		/// Stream buffer which exposes an existing character array.
+		class ReadBuffer : public std::streambuf
+		{
+		public:
+			/// Constructor.
+			///
+			/// \param buffer Contents to be read by this stream buffer.
+			explicit ReadBuffer(const std::string& buffer);
+
+		protected:
+			pos_type seekoff(off_type offset, std::ios::seekdir direction,
+				std::ios::openmode mode = std::ios::in) override;
+			pos_type seekpos(pos_type position,
+				std::ios::openmode mode = std::ios::in) override;
+		};
+
+		ReadBuffer mReadBuffer;
+	};
+
 	/// Performs initialization of this object.
 	void Initialize();
 
@@ -87,6 +149,37 @@ public:
 	/// \returns True if the data was successfully extracted from the file.
 	bool Load(const SelectionData &selectionInfo);
 
+	/// Prepares the file for lazy loading according to the specified options.
+	/// Rather than extracting data, this records the location of each data
+	/// row within the file and creates an empty Dataset2D for each selected
+	/// channel.  Data is later extracted on demand using ExtractChannels().
+	///
+	/// \param selectionInfo User-specified options for importing new data.
+	///
+	/// \returns True if the file was successfully indexed.
+	bool LoadIndex(const SelectionData &selectionInfo);
+
+	/// Checks to see if this file type can be loaded lazily.  Types which
+	/// override ExtractData() should also override this method to return
+	/// false unless the row-based parsing in ExtractChannels() is sufficient.
+	///
+	/// \returns True if LoadIndex() and ExtractChannels() may be used.
+	virtual bool SupportsLazyLoad() const { return true; }
+
+	/// Extracts data for the specified channels of a file previously indexed
+	/// with LoadIndex().  Rows are divided among several threads for parsing.
+	///
+	/// \param channels          Indices of the channels to extract (same
+	///                          indexing as GetDataset()).
+	/// \param targets           Datasets to populate; one for each entry in
+	///                          \p channels.
+	/// \param errorString [out] Explaination of any parsing errors.
+	///
+	/// \returns True if data was successfully extracted.  If false, check
+	///          \p errorString.
+	bool ExtractChannels(const std::vector<unsigned int>& channels,
+		const std::vector<Dataset2D*>& targets, wxString& errorString) const;
+
 	/// Returns a Dataset2D for the specified channel.
 	///
 	/// \param i Index of the channel to retrieve.
@@ -125,6 +218,47 @@ public:
 	///          this file.
 	bool DescriptionsMatch(const wxArrayString &descriptions) const;
 
+	/// Associates this object with a background job.  While set, Load()
+	/// reports progress and checks for cancellation via the job, and messages
+	/// are displayed via the job instead of directly, so that the data may be
+	/// loaded on a worker thread.  Initialize() and GetSelectionsFromUser()
+	/// must still be called from the main thread.
+	///
+	/// \param context        Context of the job performing the load, or
+	///                       nullptr.
+	/// \param progressStart  Job progress corresponding to the start of the
+	///                       file (for jobs which load several files).
+	/// \param progressWeight Portion of the job represented by this file.
+	void SetJobContext(JobQueue::Context* context,
+		const double& progressStart = 0.0, const double& progressWeight = 1.0);
+
+	/// Function receiving rows as they are extracted.  One Dataset2D is
+	/// provided for each selected channel, containing only the rows that
+	/// have been extracted since the previous call.
+	typedef std::function<void(std::vector<std::unique_ptr<Dataset2D>>)>
+		PartialDataCallback;
+
+	/// Enables progressive loading.  While set, Load() periodically passes
+	/// the rows extracted so far to \p callback (on the thread calling
+	/// Load()), and passes the remaining rows once extraction is complete.
+	/// All data is delivered through \p callback, so GetDataset() is not
+	/// populated.
+	///
+	/// \param callback Function to receive the data, or nullptr to disable
+	///                 progressive loading.
+	/// \param interval Amount of the file to parse between calls to
+	///                 \p callback [bytes].
+	void SetPartialDataCallback(PartialDataCallback callback,
+		const std::streamoff& interval);
+
+	/// Checks to see if this file type can be loaded progressively.  Types
+	/// which override AssembleDatasets() should also override this method to
+	/// return false unless the datasets can be assembled from any subset of
+	/// rows.
+	///
+	/// \returns True if SetPartialDataCallback() may be used.
+	virtual bool SupportsProgressiveLoad() const { return true; }
+
 protected:
 	/// Constructor.
 	///
@@ -133,6 +267,23 @@ protected:
 
 	const wxString mFileName;///< Path and file name of desired file.
 
+	/// Opens a stream for reading the contents of this object, either from
+	/// file or from the in-memory buffer.
+	///
+	/// \param mode Mode with which files are opened.
+	///
+	/// \returns Stream positioned at the start of the data.  Check the
+	///          stream state to determine if it was successfully opened.
+	std::unique_ptr<std::istream> OpenStream(
+		const std::ios::openmode& mode = std::ios::in) const;
+
+	/// Causes the contents of this object to be read from the specified
+	/// buffer instead of from file.  Types which examine their contents on
+	/// construction should override this to examine the buffer instead.
+	///
+	/// \param buffer Contents to parse.
+	virtual void UseBuffer(std::string buffer);
+
 	std::vector<std::unique_ptr<Dataset2D>> mData;///< Extracted data.
 	std::vector<double> mScales;///< Scale factors to use when extracting data.
 	wxArrayString mDescriptions;///< For all channels.
@@ -150,6 +301,49 @@ protected:
 	/// opposed to simply being represented by a floating-point value).
 	bool mTimeIsFormatted = false;
 
+	/// Offset of the start of each data row (populated by LoadIndex()).
+	std::vector<std::streamoff> mRowOffsets;
+	wxArrayInt mSelections;///< Columns selected via LoadIndex().
+
+	/// Flag indicating that the data should be read from \p mBuffer instead
+	/// of from \p mFileName.
+	bool mUseBuffer = false;
+	std::string mBuffer;///< In-memory contents (when \p mUseBuffer is set).
+
+	/// Displays a message to the user.  If this object is associated with a
+	/// job, the message is displayed on the main thread.
+	///
+	/// \param message Text of the message.
+	/// \param caption Caption of the message box.
+	/// \param style   Style flags for the message box.
+	void ShowMessage(const wxString& message, const wxString& caption,
+		const long& style) const;
+
+	/// Reports the position within the stream as the progress of the
+	/// associated job (if any).  Intended to be called periodically while
+	/// extracting data.
+	///
+	/// \param file Stream from which data is being extracted.
+	///
+	/// \returns False if the associated job was cancelled.
+	bool UpdateProgress(std::istream& file) const;
+
+	/// Number of lines to extract between calls to UpdateProgress().
+	static const unsigned int mProgressLineInterval;
+
+	/// Passes the rows extracted so far to the partial data callback (if
+	/// any), provided enough of the stream has been parsed since the
+	/// previous call.  Delivered rows are removed from \p rawData.  Intended
+	/// to be called periodically while extracting data, only when \p rawData
+	/// contains the same number of rows for each channel.
+	///
+	/// \param file              Stream from which data is being extracted.
+	/// \param rawData [in, out] Data extracted from file.
+	/// \param factors           Scale factors corresponding to \p rawData.
+	void PublishPartialData(std::istream& file,
+		std::vector<std::vector<double>>& rawData,
+		const std::vector<double>& factors) const;
+
 	/// Parses the file to determine which delimiter is most likely to result
 	/// in successfull data extraction.
 	wxString DetermineBestDelimiter() const;
@@ -170,7 +364,7 @@ protected:
 	///
 	/// \returns True if data was successfully extracted.  If false, check
 	///          \p errorString.
-	virtual bool ExtractData(std::ifstream &file, const wxArrayInt &choices,
+	virtual bool ExtractData(std::istream &file, const wxArrayInt &choices,
 		std::vector<std::vector<double>>& rawData,
 		std::vector<double> &factors, wxString &errorString) const;
 
@@ -299,7 +493,7 @@ protected:
 	///
 	/// \param file	 Stream to manipulate.
 	/// \param count Number of lines to skip.
-	static void SkipLines(std::ifstream &file, const unsigned int &count);
+	static void SkipLines(std::istream &file, const unsigned int &count);
 
 	/// Adjusts the indices to account for columns that were not displayed as
 	/// allowable selections.  Index 0 is first data column (not time column).
@@ -316,6 +510,27 @@ protected:
 	///
 	/// \returns Adjusted index.
 	unsigned int AdjustForSkippedColumns(const unsigned int &i) const;
+
+private:
+	/// Minimum number of rows to assign to each thread in ExtractChannels().
+	static const unsigned int mMinimumRowsPerThread;
+
+	JobQueue::Context* mJobContext = nullptr;
+	double mProgressStart = 0.0;
+	double mProgressWeight = 1.0;
+	std::streamoff mStreamSize = 0;
+
+	PartialDataCallback mPartialDataCallback;
+	std::streamoff mPartialDataInterval = 0;
+	mutable std::streamoff mNextPublishPosition = 0;
+
+	void Publish(std::vector<std::vector<double>>& rawData,
+		const std::vector<double>& factors) const;
+
+	void ExtractRows(const unsigned int& start, const unsigned int& end,
+		const std::vector<unsigned int>& columns,
+		const std::vector<Dataset2D*>& targets,
+		std::atomic<unsigned int>& validRows, wxString& errorString) const;
 };
 
 template<typename T>
@@ -326,6 +541,15 @@ std::unique_ptr<DataFile> DataFile::Create(const wxString& fileName)
 	return std::make_unique<T>(fileName);
 }
 
+template<typename T>
+std::unique_ptr<DataFile> DataFile::CreateFromBuffer(std::string buffer,
+	const wxString& sourceName)
+{
+	std::unique_ptr<DataFile> file(Create<T>(sourceName));
+	file->UseBuffer(std::move(buffer));
+	return file;
+}
+
 }// namespace LibPlot2D
 
 #endif// DATA_FILE_H_
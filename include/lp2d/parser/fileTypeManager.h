@@ -19,6 +19,7 @@
 
 // Standard C++ headers
 #include <vector>
+#include <string>
 
 namespace LibPlot2D
 {
@@ -40,8 +41,18 @@ public:
 	/// \see DataFile
 	typedef std::unique_ptr<DataFile> (*FileFactory)(const wxString &fileName);
 
+	/// Typedef for functions checking the type of in-memory contents.
+	/// \see DataFile::IsBufferType()
+	typedef bool (*BufferTypeCheckFunction)(const std::string &buffer);
+
+	/// Typedef for creation methods for in-memory contents.
+	/// \see DataFile::CreateFromBuffer()
+	typedef std::unique_ptr<DataFile> (*BufferFactory)(std::string buffer,
+		const wxString &sourceName);
+
 	/// Registers the specified pair of type-checking function and file factory
-	/// function.
+	/// function.  Types registered in this way are not considered for
+	/// in-memory contents.
 	///
 	/// \param typeFunction Pointer to a method for determining if a file can
 	///                     be opened with the corresponding \p fileFactory.
@@ -50,6 +61,24 @@ public:
 	void RegisterFileType(TypeCheckFunction typeFunction,
 		FileFactory fileFactory);
 
+	/// Registers the specified type-checking and factory functions for files
+	/// and for in-memory contents.
+	///
+	/// \param typeFunction       Pointer to a method for determining if a
+	///                           file can be opened with the corresponding
+	///                           \p fileFactory.
+	/// \param fileFactory        Pointer to a method for opening a file for
+	///                           which the \p typeFunction returns true.
+	/// \param bufferTypeFunction Pointer to a method for determining if
+	///                           in-memory contents can be parsed by an
+	///                           object created by \p bufferFactory.
+	/// \param bufferFactory      Pointer to a method for creating an object
+	///                           to parse contents for which
+	///                           \p bufferTypeFunction returns true.
+	void RegisterFileType(TypeCheckFunction typeFunction,
+		FileFactory fileFactory, BufferTypeCheckFunction bufferTypeFunction,
+		BufferFactory bufferFactory);
+
 	/// Gets a new DataFile object of the appropriate type.
 	///
 	/// \param fileName Path and file name of desired file.
@@ -57,8 +86,28 @@ public:
 	/// \returns A pointer to a new DataFile object.
 	std::unique_ptr<DataFile> GetDataFile(const wxString &fileName);
 
+	/// Gets a new DataFile object of the appropriate type for parsing the
+	/// specified in-memory contents (i.e. pasted text).
+	///
+	/// \param buffer     Contents to parse.
+	/// \param sourceName Name used to identify the data in messages.
+	///
+	/// \returns A pointer to a new DataFile object, or nullptr if none of
+	///          the registered types recognize the contents.
+	std::unique_ptr<DataFile> GetDataFileFromBuffer(std::string buffer,
+		const wxString &sourceName);
+
 private:
-	std::vector<std::pair<TypeCheckFunction, FileFactory>> mRegisteredTypes;
+	/// Functions associated with one registered type.
+	struct FileType
+	{
+		TypeCheckFunction typeFunction;
+		FileFactory fileFactory;
+		BufferTypeCheckFunction bufferTypeFunction;///< May be nullptr.
+		BufferFactory bufferFactory;///< May be nullptr.
+	};
+
+	std::vector<FileType> mRegisteredTypes;
 };
 
 }// namespace LibPlot2D
@@ -41,6 +41,15 @@ public:
 	/// object of this type.
 	static bool IsType(const wxString &fileName);
 
+	/// Checks to determine if the specified in-memory contents can
+	/// successfully be an object of this type.
+	///
+	/// \param buffer Contents to examine.
+	///
+	/// \returns True if the contents are likely to be compatible with an
+	/// object of this type.
+	static bool IsBufferType(const std::string &buffer);
+
 private:
 	friend std::unique_ptr<DataFile>
 		DataFile::Create<GenericFile>(const wxString&);
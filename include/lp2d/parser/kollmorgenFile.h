@@ -42,16 +42,29 @@ public:
 	/// object of this type.
 	static bool IsType(const wxString &fileName);
 
+	/// Checks to determine if the specified in-memory contents can
+	/// successfully be an object of this type.
+	///
+	/// \param buffer Contents to examine.
+	///
+	/// \returns True if the contents are likely to be compatible with an
+	/// object of this type.
+	static bool IsBufferType(const std::string &buffer);
+
+	bool SupportsLazyLoad() const override { return false; }
+
 protected:
 	wxArrayString GetCurveInformation(unsigned int &headerLineCount,
 		std::vector<double> &factors,
 		wxArrayInt &nonNumericColumns) const override;
 	void DoTypeSpecificLoadTasks() override;
-	bool ExtractData(std::ifstream &file, const wxArrayInt &choices,
+	bool ExtractData(std::istream &file, const wxArrayInt &choices,
 		std::vector<std::vector<double>>& rawData,
 		std::vector<double> &factors, wxString &errorString) const override;
 
 private:
+	static bool HasIdentifier(std::istream &file);
+
 	double mTimeStep;// [sec]
 
 	friend std::unique_ptr<DataFile>
@@ -0,0 +1,166 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  frameStatistics.h
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Records where the time goes in each frame drawn by a RenderWindow.
+
+#ifndef FRAME_STATISTICS_H_
+#define FRAME_STATISTICS_H_
+
+// Local headers
+#include "lp2d/utilities/rollingHistogram.h"
+
+// Standard C++ headers
+#include <vector>
+#include <chrono>
+#include <cstddef>
+
+namespace LibPlot2D
+{
+
+// Local forward declarations
+class Primitive;
+
+/// Collects timing and size measurements for each on-screen frame, along with
+/// histograms of the most recent frames.  Recording is disabled by default;
+/// while disabled (and outside of frames), the Record methods return
+/// immediately.  Offscreen renders are not recorded.  All methods must be
+/// called from the GUI thread.
+///
+/// Times are measured on the CPU.  Draw times include only the time to submit
+/// the OpenGL commands, not the time for the GPU to execute them.
+class FrameStatistics
+{
+public:
+	FrameStatistics();
+
+	typedef std::chrono::steady_clock Clock;
+
+	/// Measurements for one primitive which was drawn during a frame.
+	struct PrimitiveTiming
+	{
+		/// Identifies the primitive (it may since have been destroyed, so it
+		/// should only be compared, not dereferenced).
+		const Primitive* primitive;
+		double updateTime;///< Time to update buffers [msec].
+		double drawTime;///< Time to issue draw commands [msec].
+		unsigned int vertexCount;
+	};
+
+	/// Measurements for one frame.  Times are in milliseconds.
+	struct Frame
+	{
+		double plotUpdateTime = 0.0;///< Laying out the plot since the last frame.
+		double prepareTime = 0.0;///< Building geometry in parallel.
+		double updateTime = 0.0;///< Updating buffers (including uploads).
+		double drawTime = 0.0;///< Issuing draw commands.
+		double frameTime = 0.0;///< Total, including plot update.
+
+		std::size_t uploadBytes = 0;///< Data sent to the GPU.
+		unsigned int vertexCount = 0;///< Vertices in the drawn primitives.
+
+		/// Primitives which were drawn, in drawing order.  Primitives which
+		/// were not re-drawn because they are held in the layer cache are not
+		/// included.
+		std::vector<PrimitiveTiming> primitives;
+	};
+
+	/// Quantities for which histograms are kept.
+	enum class Metric
+	{
+		FrameTime,
+		PlotUpdateTime,
+		PrepareTime,
+		UpdateTime,
+		DrawTime,
+		UploadBytes,
+		Count///< Number of metrics (not a metric).
+	};
+
+	/// Enables or disables recording.  Disabling recording discards the
+	/// histograms.
+	///
+	/// \param enabled True to start recording.
+	void SetEnabled(const bool& enabled);
+	inline bool IsEnabled() const { return mEnabled; }
+
+	/// Checks to see if measurements are currently being collected.
+	/// \returns True if recording is enabled and a frame is in progress.
+	inline bool IsRecording() const { return mEnabled && mFrameActive; }
+
+	/// \name Methods for collecting measurements
+	/// @{
+
+	void BeginFrame();
+	void EndFrame();
+
+	/// Records time spent laying out the plot.  Because the layout is updated
+	/// before drawing begins, this may be called outside of a frame; the time
+	/// is then attributed to the next frame.
+	///
+	/// \param duration Time spent in PlotObject::Update().
+	void RecordPlotUpdate(const Clock::duration& duration);
+
+	void RecordPrepare(const Clock::duration& duration);
+	void RecordPrimitive(const Primitive& primitive,
+		const Clock::duration& updateDuration,
+		const Clock::duration& drawDuration, const unsigned int& vertexCount);
+
+	/// Records data sent to the GPU.
+	///
+	/// \param bytes Size of the data.
+	inline void RecordUpload(const std::size_t& bytes)
+	{ if (IsRecording()) mCurrentFrame.uploadBytes += bytes; }
+
+	/// @}
+
+	/// \name Methods for retrieving measurements
+	/// @{
+
+	/// Gets the measurements for the most recently completed frame.
+	/// \returns The last frame.
+	const Frame& GetLastFrame() const { return mLastFrame; }
+
+	/// Gets the number of frames recorded since recording was enabled.
+	/// \returns The number of frames.
+	unsigned long long GetFrameCount() const { return mFrameCount; }
+
+	/// Gets the histogram of the most recent frames for the specified
+	/// quantity.  Times are in milliseconds and sizes in bytes.
+	///
+	/// \param metric Quantity of interest.
+	///
+	/// \returns The histogram.
+	const RollingHistogram& GetHistogram(const Metric& metric) const
+	{ return mHistograms[static_cast<unsigned int>(metric)]; }
+
+	/// @}
+
+private:
+	static const unsigned int mHistoryLength;// [frames]
+
+	bool mEnabled = false;
+	bool mFrameActive = false;
+	unsigned long long mFrameCount = 0;
+
+	Clock::time_point mFrameStart;
+	double mPendingPlotUpdateTime = 0.0;// [msec]
+
+	Frame mCurrentFrame;
+	Frame mLastFrame;
+
+	std::vector<RollingHistogram> mHistograms;
+
+	static double ToMilliseconds(const Clock::duration& duration);
+};
+
+}// namespace LibPlot2D
+
+#endif// FRAME_STATISTICS_H_
@@ -0,0 +1,154 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  glyphAtlas.h
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Process-wide cache of rasterized glyphs for a single font and size,
+//        packed into one image for use as a texture.
+
+#ifndef GLYPH_ATLAS_H_
+#define GLYPH_ATLAS_H_
+
+// Freetype headers
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <map>
+#include <tuple>
+#include <memory>
+#include <unordered_map>
+#include <mutex>
+
+namespace LibPlot2D
+{
+
+/// Rasterizes glyphs on demand and packs them into a single-channel image.
+/// One atlas exists per (font file, pixel size) combination, and it is shared
+/// by all Text objects (in all windows) using that combination.  Glyph
+/// positions never change once assigned, so the image may grow without
+/// invalidating previously built text.  The image is uploaded to each OpenGL
+/// context by RenderWindow::GetGlyphAtlasTexture().  Glyph lookups are not
+/// thread-safe; they must be performed from the GUI thread.
+class GlyphAtlas
+{
+public:
+	~GlyphAtlas();
+
+	GlyphAtlas(const GlyphAtlas&) = delete;
+	GlyphAtlas(GlyphAtlas&&) = delete;
+	GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+	GlyphAtlas& operator=(GlyphAtlas&&) = delete;
+
+	/// Gets the atlas for the specified font and size, creating it if
+	/// necessary.  The atlas is released when the last user releases it.
+	///
+	/// \param fontFileName Path and file name to the font file.
+	/// \param width        Width of the glyphs in pixels (zero to determine
+	///                     from the height).
+	/// \param height       Height of the glyphs in pixels.
+	///
+	/// \returns Pointer to the atlas, or nullptr if the font could not be
+	///          loaded.
+	static std::shared_ptr<GlyphAtlas> Get(const std::string& fontFileName,
+		const unsigned int& width, const unsigned int& height);
+
+	/// Checks to see if the specified font file can be loaded.  Results are
+	/// cached, so each file is only opened once.
+	///
+	/// \param fontFileName Path and file name to the font file.
+	///
+	/// \returns True if the font file can be loaded.
+	static bool FontFileIsValid(const std::string& fontFileName);
+
+	/// Location and metrics for a glyph.  Positions and sizes are in pixels.
+	struct Glyph
+	{
+		unsigned int x = 0;///< Left edge of the glyph image within the atlas.
+		unsigned int y = 0;///< Top edge of the glyph image within the atlas.
+		int xSize = 0;
+		int ySize = 0;
+		int xBearing = 0;
+		int yBearing = 0;
+		unsigned int advance = 0;///< In 1/64 pixels.
+	};
+
+	/// Gets the specified glyph, rasterizing and packing it into the image
+	/// if this is the first request.  Characters not available in the font
+	/// result in empty glyphs.
+	///
+	/// \param code Unicode code point of the character.
+	///
+	/// \returns The glyph information.
+	const Glyph& GetGlyph(const char32_t& code);
+
+	/// \name Image accessors
+	/// @{
+
+	/// Gets an identifier which is unique to this atlas for the life of the
+	/// application.
+	/// \returns The identifier.
+	unsigned int GetId() const { return mId; }
+
+	/// Gets a value which changes each time the image is modified.
+	/// \returns The revision number.
+	unsigned int GetRevision() const { return mRevision; }
+
+	inline unsigned int GetWidth() const { return mWidth; }
+	inline unsigned int GetHeight() const { return mHeight; }
+
+	/// Gets the image (one byte per pixel, row-major, starting at the top).
+	/// \returns The image data.
+	const std::vector<unsigned char>& GetPixels() const { return mPixels; }
+
+	/// @}
+
+private:
+	GlyphAtlas(FT_Face face, const unsigned int& id);
+
+	typedef std::tuple<std::string, unsigned int, unsigned int> Key;
+	static std::map<Key, std::weak_ptr<GlyphAtlas>> mAtlases;
+	static std::map<std::string, bool> mValidFontFiles;
+	static std::mutex mAtlasMutex;
+	static unsigned int mNextId;
+
+	static FT_Library mFt;
+	static unsigned int mFtReferenceCount;
+	static bool AcquireFreeType();
+	static void ReleaseFreeType();
+
+	static const unsigned int mPadding;
+
+	FT_Face mFace;
+	const unsigned int mId;
+	unsigned int mRevision = 1;
+
+	std::unordered_map<char32_t, Glyph> mGlyphs;
+
+	unsigned int mWidth;
+	unsigned int mHeight;
+	std::vector<unsigned char> mPixels;
+
+	// Current packing position (rows are filled left to right, top to bottom)
+	unsigned int mPenX;
+	unsigned int mPenY;
+	unsigned int mRowHeight = 0;
+
+	void Pack(const unsigned int& width, const unsigned int& height,
+		unsigned int& x, unsigned int& y);
+	void Resize(const unsigned int& width, const unsigned int& height);
+
+	static unsigned int NextPowerOfTwo(const unsigned int& value);
+};
+
+}// namespace LibPlot2D
+
+#endif// GLYPH_ATLAS_H_
@@ -9,10 +9,10 @@
 // File:  line.h
 // Date:  4/2/2015
 // Auth:  K. Loux
-// Desc:  Object representing a line, drawn with triangles faded from line
-//        color to background color in order to make the lines prettier, be
-//        more consistent from platform to platofrm and to support sub-pixel
-//        widths.
+// Desc:  Object representing a line, expanded to triangles by a shader and
+//        faded from line color to background color in order to make the
+//        lines prettier, be more consistent from platform to platofrm and to
+//        support sub-pixel widths.
 
 #ifndef LINE_H_
 #define LINE_H_
@@ -20,8 +20,12 @@
 // Standard C++ headers
 #include <vector>
 #include <utility>
+#include <string>
 #include <cassert>
 
+// Eigen headers
+#include <Eigen/Eigen>
+
 // Local headers
 #include "lp2d/renderer/color.h"
 #include "lp2d/renderer/primitives/primitive.h"
@@ -32,25 +36,26 @@ namespace LibPlot2D
 // Local forward declarations
 class RenderWindow;
 
-/// Helper class for rendering a line.  Includes options to use OpenGL lines or
-/// to use OpenGL triangles.  Using OpenGL triangles results in a prettier line
-/// (better anti-aliasing) but may render more slowly.
+/// Helper class for rendering a line.  Only the point positions are stored in
+/// the OpenGL buffers; a geometry shader expands each segment into triangles
+/// of the appropriate width (computed in screen coordinates) and the fragment
+/// shader handles anti-aliasing.  Because width and color are applied at
+/// render time, they may be changed without re-building the geometry.
 class Line
 {
 public:
 	/// Constructor.
 	///
 	/// \param renderWindow Window in which the line will be rendered.
-	explicit Line(const RenderWindow& renderWindow);
+	explicit Line(RenderWindow& renderWindow);
 
 	/// \name Option setting methods
 	/// @{
 
-	/// Sets a flag indicating whether or not we should use triangles or OpenGL
-	/// lines to render this object.
+	/// Sets a flag indicating whether or not the edges of the line should be
+	/// anti-aliased.
 	///
-	/// \param pretty True to indicate that triangles should be used to render
-	///               this object.
+	/// \param pretty True to indicate that the line should be anti-aliased.
 	inline void SetPretty(const bool &pretty) { mPretty = pretty; }
 
 	/// Sets the line width.
@@ -79,17 +84,27 @@ public:
 	inline void SetBackgroundColorForAlphaFade()
 	{ mBackgroundColor = mLineColor; mBackgroundColor.SetAlpha(0.0); }
 
-	/// Sets the scale factor for the x-component of the line.
+	/// Sets flags indicating whether or not the points must be scaled
+	/// logarithmically before they are stored in the buffer.  Non-positive
+	/// values on logarithmic axes are skipped when drawing.  Takes effect the
+	/// next time the geometry is built.
 	///
-	/// \param scale Scale factor.
-	inline void SetXScale(const double& scale)
-	{ assert(scale > 0.0); mXScale = scale; }
-
-	/// Sets the scale factor for the y-component of the line.
+	/// \param x True if the x-axis is logarithmic.
+	/// \param y True if the y-axis is logarithmic.
+	inline void SetLogarithmic(const bool &x, const bool &y)
+	{ mXLogarithmic = x; mYLogarithmic = y; }
+
+	/// Sets the point (after logarithmic scaling) which is subtracted from
+	/// each point before it is stored in the buffer.  The buffer holds single
+	/// precision values, so choosing an origin near the data preserves the
+	/// precision of data which is far from zero (i.e. time stamps).  The
+	/// origin is added back in double precision by Draw().  Takes effect the
+	/// next time the geometry is built.
 	///
-	/// \param scale Scale factor.
-	inline void SetYScale(const double& scale)
-	{ assert(scale > 0.0); mYScale = scale; }
+	/// \param x X-ordinate of the origin.
+	/// \param y Y-ordinate of the origin.
+	inline void SetOrigin(const double &x, const double &y)
+	{ mXOrigin = x; mYOrigin = y; }
 
 	/// Sets the OpenGL rendering type hint.
 	///
@@ -99,180 +114,180 @@ public:
 
 	/// @}
 
-	/// Enumeration for specifying how the line should be updated.
-	enum class UpdateMethod
-	{
-		Immediate,///< Send to OpenGL immediately.
-		Manual///< Caller is responsible for sending to OpenGL.
-	};
-
 	/// \name Geometry creation methods
 	/// @{
 
 	/// Creates OpenGL buffers and fills them with the appropriate geometry
-	/// data.  All options must be set prior to calling.
+	/// data.  Must be rendered with Draw().
 	///
 	/// \param x1               X-ordinate of first end of the line.
 	/// \param y1               Y-ordinate of first end of the line.
 	/// \param x2               X-ordinate of second end of the line.
 	/// \param y2               Y-ordinate of second end of the line.
 	/// \param bufferInfo [out] Information regarding populated OpenGL buffers.
-	/// \param update           Desired update method.
 	void Build(const unsigned int &x1, const unsigned int &y1,
 		const unsigned int &x2, const unsigned int &y2,
-		Primitive::BufferInfo& bufferInfo,
-		const UpdateMethod& update = UpdateMethod::Immediate) const;
+		Primitive::BufferInfo& bufferInfo) const;
 
 	/// Creates OpenGL buffers and fills them with the appropriate geometry
-	/// data.  All options must be set prior to calling.
+	/// data.  Must be rendered with Draw().
 	///
 	/// \param x1               X-ordinate of first end of the line.
 	/// \param y1               Y-ordinate of first end of the line.
 	/// \param x2               X-ordinate of second end of the line.
 	/// \param y2               Y-ordinate of second end of the line.
 	/// \param bufferInfo [out] Information regarding populated OpenGL buffers.
-	/// \param update           Desired update method.
 	void Build(const double &x1, const double &y1, const double &x2,
-		const double &y2, Primitive::BufferInfo& bufferInfo,
-		const UpdateMethod& update = UpdateMethod::Immediate) const;
+		const double &y2, Primitive::BufferInfo& bufferInfo) const;
 
 	/// Creates OpenGL buffers and fills them with the appropriate geometry
-	/// data.  All options must be set prior to calling.  Each point after the
-	/// first results in a new line segment (i.e. this creates continuous
-	/// lines).
+	/// data.  Each point after the first results in a new line segment (i.e.
+	/// this creates continuous lines).  Must be rendered with Draw().
 	///
 	/// \param points           List of x-y pairs designating the shape of the
 	///                         line.
 	/// \param bufferInfo [out] Information regarding populated OpenGL buffers.
-	/// \param update           Desired update method.
 	void Build(
 		const std::vector<std::pair<unsigned int, unsigned int>> &points,
-		Primitive::BufferInfo& bufferInfo,
-		const UpdateMethod& update = UpdateMethod::Immediate) const;
+		Primitive::BufferInfo& bufferInfo) const;
 
 	/// Creates OpenGL buffers and fills them with the appropriate geometry
-	/// data.  All options must be set prior to calling.  Each point after the
-	/// first results in a new line segment (i.e. this creates continuous
-	/// lines).
+	/// data.  Each point after the first results in a new line segment (i.e.
+	/// this creates continuous lines).  Must be rendered with Draw().
 	///
 	/// \param points           List of x-y pairs designating the shape of the
 	///                         line.
 	/// \param bufferInfo [out] Information regarding populated OpenGL buffers.
-	/// \param update           Desired update method.
 	void Build(const std::vector<std::pair<double, double>> &points,
-		Primitive::BufferInfo& bufferInfo,
-		const UpdateMethod& update = UpdateMethod::Immediate) const;
+		Primitive::BufferInfo& bufferInfo) const;
 
 	/// Creates OpenGL buffers and fills them with the appropriate geometry
-	/// data.  All options must be set prior to calling.  Each point after the
-	/// first results in a new line segment (i.e. this creates continuous
-	/// lines).
+	/// data.  Each point after the first results in a new line segment (i.e.
+	/// this creates continuous lines).  Must be rendered with Draw().
 	///
 	/// \param x                List of x-ordinates of line points.
-	/// \param y                List of x-ordinates of line points.
+	/// \param y                List of y-ordinates of line points.
 	/// \param bufferInfo [out] Information regarding populated OpenGL buffers.
-	/// \param update           Desired update method.
 	void Build(const std::vector<double>& x,
-		const std::vector<double>& y, Primitive::BufferInfo& bufferInfo,
-		const UpdateMethod& update = UpdateMethod::Immediate) const;
+		const std::vector<double>& y, Primitive::BufferInfo& bufferInfo) const;
+
+	/// Fills the local buffer with the same geometry as Build(), but does not
+	/// send it to the GPU.  No OpenGL calls are made, so this may be called
+	/// from any thread.  Must be followed by a call to Upload() from the
+	/// thread which owns the OpenGL context.
+	///
+	/// \param x                List of x-ordinates of line points.
+	/// \param y                List of y-ordinates of line points.
+	/// \param bufferInfo [out] Local buffer to populate.
+	void BuildVertices(const std::vector<double>& x,
+		const std::vector<double>& y, Primitive::BufferInfo& bufferInfo) const;
+
+	/// Creates OpenGL buffers (if necessary) and fills them with the geometry
+	/// prepared by BuildVertices().  Must be rendered with Draw().
+	///
+	/// \param bufferInfo [out] Information regarding populated OpenGL buffers.
+	void Upload(Primitive::BufferInfo& bufferInfo) const;
+
+	/// Adds points to the end of a line strip created with Build().  Only
+	/// the new points are sent to the GPU, unless the buffer must grow (the
+	/// storage is doubled each time it grows, so this is infrequent).
+	///
+	/// \param x                List of x-ordinates of points to add.
+	/// \param y                List of y-ordinates of points to add.
+	/// \param bufferInfo [out] Information regarding populated OpenGL buffers.
+	void Append(const std::vector<double>& x,
+		const std::vector<double>& y, Primitive::BufferInfo& bufferInfo) const;
 
 	/// Creates OpenGL buffers and fills them with the appropriate geometry
-	/// data.  All options must be set prior to calling.  For every two points,
-	/// one line segment is drawn (i.e. this creates discontinuous lines).
+	/// data.  For every two points, one line segment is drawn (i.e. this
+	/// creates discontinuous lines).  Must be rendered with DrawSegments().
 	///
 	/// \param points           List of x-y pairs designating the locations of
 	///                         the segments.
 	/// \param bufferInfo [out] Information regarding populated OpenGL buffers.
-	/// \param update           Desired update method.
 	void BuildSegments(const std::vector<std::pair<double, double>> &points,
-		Primitive::BufferInfo& bufferInfo,
-		const UpdateMethod& update = UpdateMethod::Immediate) const;
+		Primitive::BufferInfo& bufferInfo) const;
 
 	/// @}
 
 	/// \name Methods for executing the OpenGL rendering.
 	/// @{
 
-	/// To be called after creation of Primitive::BufferInfo objects.  This
-	/// method must only be used if geometry was created with a call to Build()
-	/// after a call to SetPretty(false).
+	/// To be called after creation of Primitive::BufferInfo objects with a
+	/// call to Build().  The associated vertex array must be bound prior to
+	/// calling.  Width and color options are applied here.
 	///
 	/// \param vertexCount Number of vertices in the corresponding BufferInfo
 	///                    object.
-	static void DoUglyDraw(const unsigned int& vertexCount);
-
-	/// To be called after creation of Primitive::BufferInfo objects.  This
-	/// method must only be used if geometry was created with a call to Build()
-	/// or BuildSegments() after a call to SetPretty(true).
-	///
-	/// \param indexCount Number of indices in the corresponding BufferInfo
-	///                   object.
-	static void DoPrettyDraw(const unsigned int& indexCount);
-
-	/// To be called after creation of Primitive::BufferInfo objects.  This
-	/// method must only be used if geometry was created with a call to
-	/// BuildSegments() after a call to SetPretty(false).
+	/// \param modelview   Transformation from the coordinates used to build
+	///                    the geometry to screen coordinates (pixels).
+	void Draw(const unsigned int& vertexCount,
+		const Eigen::Matrix4d& modelview) const;
+
+	/// To be called after creation of Primitive::BufferInfo objects with a
+	/// call to BuildSegments().  The associated vertex array must be bound
+	/// prior to calling.  Width and color options are applied here.
 	///
 	/// \param vertexCount Number of vertices in the corresponding BufferInfo
 	///                    object.
-	static void DoUglySegmentDraw(const unsigned int& vertexCount);
+	/// \param modelview   Transformation from the coordinates used to build
+	///                    the geometry to screen coordinates (pixels).
+	void DrawSegments(const unsigned int& vertexCount,
+		const Eigen::Matrix4d& modelview) const;
+
+	/// Gets the transformation from the coordinates stored in the buffer to
+	/// screen coordinates, for drawing other objects (i.e. markers) from the
+	/// same buffer.
+	///
+	/// \param modelview Transformation from scaled data coordinates to screen
+	///                  coordinates (pixels).
+	///
+	/// \returns The modelview matrix with the origin applied.
+	Eigen::Matrix4d GetBufferModelview(const Eigen::Matrix4d& modelview) const;
 
 	/// @}
 
 private:
 	static const double mFadeDistance;
+	static const unsigned int mParallelChunkSize;
+
+	static const std::string mVertexShader;
+	static const std::string mGeometryShader;
+	static const std::string mFragmentShader;
+
+	static const std::string mHalfWidthName;
+	static const std::string mFadeWidthName;
+	static const std::string mPixelSizeName;
+	static const std::string mLineColorName;
+	static const std::string mFadeColorName;
+
 	double mHalfWidth;
 
 	Color mLineColor = Color::ColorBlack;
 	Color mBackgroundColor;
 	bool mPretty = true;
+	bool mXLogarithmic = false;
+	bool mYLogarithmic = false;
+	double mXOrigin = 0.0;
+	double mYOrigin = 0.0;
 
-	double mXScale = 1.0;
-	double mYScale = 1.0;
-
-	const RenderWindow& mRenderWindow;
+	RenderWindow& mRenderWindow;
 
 	GLenum mHint;
 
-	void ComputeOffsets(const double &x1, const double &y1, const double &x2,
-		const double &y2, double& dxLine, double& dyLine, double& dxEdge,
-		double& dyEdge) const;
-	void ComputeOffsets(const double &xPrior, const double &yPrior,
-		const double &x, const double &y, const double &xNext,
-		const double &yNext, double& dxLine, double& dyLine, double& dxEdge,
-		double& dyEdge) const;
-
-	struct Offsets
-	{
-		double dxLine;
-		double dyLine;
-		double dxEdge;
-		double dyEdge;
-	};
-
-	void DoUglyDraw(const double &x1, const double &y1, const double &x2,
-		const double &y2, const UpdateMethod& update,
+	void AllocateBuffer(const unsigned int& vertexCount,
 		Primitive::BufferInfo& bufferInfo) const;
-	void DoUglyDraw(const std::vector<std::pair<double, double>> &points,
-		const UpdateMethod& update, Primitive::BufferInfo& bufferInfo) const;
-	void DoPrettyDraw(const std::vector<std::pair<double, double>> &points,
-		const UpdateMethod& update, Primitive::BufferInfo& bufferInfo) const;
-
-	void DoPrettySegmentDraw(
-		const std::vector<std::pair<double, double>> &points,
-		const UpdateMethod& update, Primitive::BufferInfo& bufferInfo) const;
-
-	enum class LineStyle
-	{
-		Continuous,
-		Segments
-	};
+	void AssignVertex(const unsigned int& i, const double& x, const double& y,
+		Primitive::BufferInfo& bufferInfo) const;
+	static double ScaleForAxis(const double& value, const bool& logarithmic);
+	void UploadBuffer(Primitive::BufferInfo& bufferInfo,
+		const unsigned int& firstVertex = 0) const;
 
-	void AssignVertexData(const std::vector<std::pair<double, double>>& points,
-		const LineStyle& style, Primitive::BufferInfo& bufferInfo) const;
+	void DoDraw(const GLenum& mode, const unsigned int& vertexCount,
+		const Eigen::Matrix4d& modelview) const;
 
-	void AllocateBuffer(const unsigned int& vertexCount,
-		const unsigned int& triangleCount, Primitive::BufferInfo& bufferInfo) const;
+	GLuint DoGLInitialization() const;
+	friend RenderWindow;
 };
 
 }// namespace LibPlot2D
@@ -0,0 +1,122 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  marker.h
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Object representing data point markers, drawn as instanced quads
+//        and shaped in the fragment shader.
+
+#ifndef MARKER_H_
+#define MARKER_H_
+
+// Standard C++ headers
+#include <string>
+#include <cassert>
+
+// Eigen headers
+#include <Eigen/Eigen>
+
+// Local headers
+#include "lp2d/renderer/color.h"
+#include "lp2d/renderer/primitives/primitive.h"
+
+namespace LibPlot2D
+{
+
+// Local forward declarations
+class RenderWindow;
+
+/// Helper class for rendering data point markers.  One quad is drawn for each
+/// point in an existing position buffer (such as one built by Line::Build())
+/// using instanced rendering, so no per-point data is generated on the CPU.
+/// Size, shape and color are applied at render time.
+class Marker
+{
+public:
+	/// Constructor.
+	///
+	/// \param renderWindow Window in which the markers will be rendered.
+	explicit Marker(RenderWindow& renderWindow);
+
+	/// Available marker shapes.
+	enum class Shape
+	{
+		Square,
+		Circle,
+		Diamond,
+		Triangle,
+		Plus
+	};
+
+	/// \name Option setting methods
+	/// @{
+
+	/// Sets the marker size.
+	///
+	/// \param size Width of the marker in pixels.
+	inline void SetSize(const double &size)
+	{ assert(size >= 0.0); mHalfSize = 0.5 * size; }
+
+	/// Sets the marker shape.
+	///
+	/// \param shape Shape of the marker.
+	inline void SetShape(const Shape &shape) { mShape = shape; }
+
+	/// Sets the marker color.
+	///
+	/// \param color Color of the marker.
+	inline void SetColor(const Color &color) { mColor = color; }
+
+	/// @}
+
+	/// Configures the vertex array for drawing one marker at each point of
+	/// the specified position buffer.  Must be called again if the OpenGL
+	/// objects associated with the position buffer are re-created.
+	///
+	/// \param positions        Buffer containing point positions (two floats
+	///                         per point).
+	/// \param firstPoint       Index of the first point to mark.
+	/// \param bufferInfo [out] Buffer whose vertex array will reference the
+	///                         position buffer.
+	void Build(const Primitive::BufferInfo& positions,
+		const unsigned int& firstPoint,
+		Primitive::BufferInfo& bufferInfo) const;
+
+	/// To be called after configuration of the Primitive::BufferInfo object
+	/// with a call to Build().  The associated vertex array must be bound
+	/// prior to calling.
+	///
+	/// \param pointCount Number of markers to draw.
+	/// \param modelview  Transformation from the coordinates of the position
+	///                   buffer to screen coordinates (pixels) (see
+	///                   Line::GetBufferModelview()).
+	void Draw(const unsigned int& pointCount,
+		const Eigen::Matrix4d& modelview) const;
+
+private:
+	static const std::string mVertexShader;
+	static const std::string mFragmentShader;
+
+	static const std::string mHalfSizeName;
+	static const std::string mShapeName;
+	static const std::string mMarkerColorName;
+
+	double mHalfSize;
+	Shape mShape = Shape::Square;
+	Color mColor = Color::ColorBlack;
+
+	RenderWindow& mRenderWindow;
+
+	GLuint DoGLInitialization() const;
+	friend RenderWindow;
+};
+
+}// namespace LibPlot2D
+
+#endif// MARKER_H_
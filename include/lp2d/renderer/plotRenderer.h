@@ -40,6 +40,7 @@ class PlotObject;
 class Dataset2D;
 class ZoomBox;
 class PlotCursor;
+class TextRendering;
 class GuiInterface;
 
 /// Class for handling rendering of 2D plots.
@@ -63,7 +64,27 @@ public:
 		HighWrite = 1 << 0,
 		HighDrag = 1 << 1,
 		HighStatic = 1 << 2,
-		AlwaysHigh = HighWrite | HighDrag | HighStatic
+		AlwaysHigh = HighWrite | HighDrag | HighStatic,
+
+		/// During interactions (panning and zooming), switch to draft curves
+		/// if rendering exceeds the frame budget.  See
+		/// AdaptiveQualitySettings.
+		Adaptive = 1 << 3
+	};
+
+	/// Thresholds for adapting the curve quality to the rendering speed.
+	/// Only used when the CurveQuality::Adaptive flag is set.
+	struct AdaptiveQualitySettings
+	{
+		/// If a frame takes longer than this to update and render during an
+		/// interaction, the remainder of the interaction is drawn with draft
+		/// curves (no anti-aliasing or markers and coarser decimation)
+		/// [msec].
+		double frameBudget = 1000.0 / 30.0;
+
+		/// Once no interaction has occurred for this long, curves which were
+		/// drawn as drafts are re-drawn at full quality [msec].
+		unsigned int idleDelay = 250;
 	};
 
 	/// \name Getters
@@ -99,8 +120,12 @@ public:
 	bool GetMinorGridOn() const;
 
 	CurveQuality GetCurveQuality() const { return mCurveQuality; }
+	const AdaptiveQualitySettings& GetAdaptiveQualitySettings() const
+	{ return mAdaptiveQualitySettings; }
 
 	bool LegendIsVisible() const;
+	bool StatisticsOverlayIsVisible() const
+	{ return mStatisticsOverlayVisible; }
 
 	bool GetLeftCursorVisible() const;
 	bool GetRightCursorVisible() const;
@@ -147,10 +172,19 @@ public:
 	void SetRightLogarithmic(const bool &log);
 
 	void SetCurveQuality(const CurveQuality& curveQuality);
+	void SetAdaptiveQualitySettings(const AdaptiveQualitySettings& settings);
 
 	void SetLegendOn();
 	void SetLegendOff();
 
+	/// Shows or hides the measurements of the last frame (and a summary of
+	/// the recent frames) in the upper left corner of the plot.  Showing the
+	/// overlay enables recording of the frame statistics; hiding it does not
+	/// disable recording.
+	///
+	/// \param visible True to show the overlay.
+	void SetStatisticsOverlayVisible(const bool& visible);
+
 	void SetXLimits(const double &min, const double &max);
 	void SetLeftYLimits(const double &min, const double &max);
 	void SetRightYLimits(const double &min, const double &max);
@@ -170,6 +204,12 @@ public:
 		const bool &visible, const bool &rightAxis, const double &lineSize,
 		const int &markerSize);
 
+	/// Gets the number of vertices used to draw each curve (lines and
+	/// markers).  Together with GetFrameStatistics(), this helps to relate
+	/// frame times to the amount of data being drawn.
+	/// \returns The vertex counts, in the same order as the curves.
+	std::vector<unsigned int> GetCurveVertexCounts() const;
+
 	/// Adds the specified curve to the list of rendered curves.  Internally
 	/// creates a PlotCurve object and adds it to this.
 	///
@@ -232,8 +272,6 @@ public:
 	/// \returns The total number of plotted points.
 	unsigned long long GetTotalPointCount() const;
 
-	wxImage GetImage() const override;
-
 	unsigned int GetVertexDimension() const override { return 2; }
 
 	/// Enumeration of available modelview matrices.
@@ -250,6 +288,13 @@ public:
 	/// \param mv Source of matrix to load into the uniform.
 	void LoadModelviewUniform(const Modelview& mv);
 
+	/// Gets the specified modelview matrix.
+	///
+	/// \param mv Matrix to retrieve.
+	///
+	/// \returns The requested modelview matrix.
+	const Eigen::Matrix4d& GetModelview(const Modelview& mv) const;
+
 	/// Sets the valud of the modelview matrix.
 	///
 	/// \param m Value to assign to the modelview matrix.
@@ -342,6 +387,8 @@ private:
 
 	// Overload of size event
 	void OnSize(wxSizeEvent &event);
+	void OnRenderSizeChanged() override;
+	void ResizePlot();
 
 	// Overload of interaction events
 	void OnMouseWheelEvent(wxMouseEvent &event);
@@ -372,6 +419,13 @@ private:
 
 	GuiInterface& mGuiInterface;
 
+	// Mouse motion only flags the required updates; they are performed once
+	// per frame by UpdateLayout()
+	bool mLayoutPending = false;
+	bool mCursorValuesPending = false;
+	void UpdateLayout() override;
+	void PerformLayout();
+
 	void ProcessZoom(wxMouseEvent &event);
 	void ProcessZoomWithBox(wxMouseEvent &event);
 	void ProcessPan(wxMouseEvent &event);
@@ -414,6 +468,37 @@ private:
 	bool mIgnoreNextMouseMove = false;
 	CurveQuality mCurveQuality = CurveQuality::AlwaysHigh;
 
+	// Adaptive curve quality; panning and zooming call BeginInteraction(),
+	// and the timer calls EndInteraction() once they stop
+	AdaptiveQualitySettings mAdaptiveQualitySettings;
+	bool mDraftCurves = false;
+	bool mInteractionPending = false;
+
+	void BeginInteraction();
+	void ApplyInteractionQuality();
+	void EndInteraction();
+
+	/// Timer for detecting the end of interactions.
+	class InteractionTimer : public wxTimer
+	{
+	public:
+		explicit InteractionTimer(PlotRenderer& renderer)
+			: mRenderer(renderer) {}
+		void Notify() override { mRenderer.EndInteraction(); }
+
+	private:
+		PlotRenderer& mRenderer;
+	};
+
+	InteractionTimer mInteractionTimer{ *this };
+
+	// Frame statistics overlay (one object per line of text)
+	static const unsigned int mStatisticsOverlayLineCount;
+	static const double mStatisticsOverlayFontSize;// [pixels]
+	bool mStatisticsOverlayVisible = false;
+	std::vector<TextRendering*> mStatisticsOverlay;
+	void UpdateStatisticsOverlay() override;
+
 	Eigen::Matrix4d mLeftModelview;
 	Eigen::Matrix4d mRightModelview;
 
@@ -22,6 +22,10 @@
 #include "lp2d/renderer/line.h"
 #include "lp2d/renderer/text.h"
 
+// Standard C++ headers
+#include <map>
+#include <string>
+
 namespace LibPlot2D
 {
 
@@ -223,6 +227,13 @@ private:
 	void DrawAxisLabel();
 	void DrawTickLabels();
 
+	// Formatted tick labels from the previous update (UTF-8), so labels are
+	// only re-formatted when their values change
+	unsigned int mTickLabelPrecision = 0;
+	std::map<double, std::string> mTickLabels;
+	const std::string& GetTickLabel(const double& value,
+		std::map<double, std::string>& labels) const;
+
 	double GetAxisLabelTranslation(const double &offset, const double &fontHeight) const;
 	unsigned int GetPrecision() const;
 	void ComputeTranslations(const double &value, float &xTranslation, float &yTranslation,
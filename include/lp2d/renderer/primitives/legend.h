@@ -181,6 +181,9 @@ private:
 	void GetAdjustedPosition(double &x, double &y) const;
 
 	Line mLines;
+	Primitive::BufferInfo mBorderBuffer;
+	std::vector<Primitive::BufferInfo> mSampleLineBuffers;
+	Primitive::BufferInfo mMarkerBuffer;
 
 	std::vector<Primitive::BufferInfo> mBufferVector;
 	Primitive::BufferInfo BuildBackground() const;
@@ -18,6 +18,7 @@
 #include "lp2d/renderer/primitives/primitive.h"
 #include "lp2d/utilities/managedList.h"
 #include "lp2d/renderer/line.h"
+#include "lp2d/renderer/marker.h"
 
 namespace LibPlot2D
 {
@@ -53,6 +54,11 @@ public:
 	/// \param size Size of the data marker.
 	inline void SetMarkerSize(const double &size) { mMarkerSize = size; mModified = true; }
 
+	/// Sets the shape of the data marker.
+	///
+	/// \param shape Shape of the data marker.
+	inline void SetMarkerShape(const Marker::Shape &shape) { mMarker.SetShape(shape); }
+
 	/// Sets a flag indicating whether or not to use the higher-quality (but
 	/// slower) rendering algorithm.
 	///
@@ -60,6 +66,16 @@ public:
 	///               anti-aliasing.
 	inline void SetPretty(const bool &pretty) { mPretty = pretty; mLine.SetPretty(pretty); mModified = true; }
 
+	/// Sets a flag indicating whether or not to use cheaper geometry (for
+	/// use while the user is interacting with the plot).  Draft curves are
+	/// decimated more coarsely, re-use existing geometry over a wider range
+	/// of zoom levels and, if the curve has a line, are drawn without
+	/// markers.
+	///
+	/// \param draft Set to true to draw with draft quality.
+	inline void SetDraft(const bool &draft)
+	{ if (draft != mDraft) { mDraft = draft; mModified = true; } }
+
 	/// Binds the curve to the specified x-axis.
 	///
 	/// \param xAxis Axis to which this curve should be bound.
@@ -92,6 +108,9 @@ protected:
 	void Update(const unsigned int& i) override;
 	void GenerateGeometry() override;
 
+	bool BeginPrepareUpdate() override;
+	void PrepareUpdate() override;
+
 private:
 	// The axes with which this object is associated
 	Axis *mXAxis = nullptr;
@@ -100,14 +119,19 @@ private:
 	const Dataset2D& mData;
 
 	Line mLine;
+	Marker mMarker;
 
 	bool mPretty = true;
+	bool mDraft = false;
 	double mLineSize = 1.0;
 	double mMarkerSize = -1.0;
 
 	bool PointIsValid(const unsigned int &i) const;
 
-	void BuildMarkers();
+	// Curves without lines must always show their markers
+	inline bool DraftOmitsMarkers() const { return mDraft && mLineSize > 0.0; }
+	inline bool MarkersAreDrawn() const
+	{ return NeedsMarkersDrawn() && !DraftOmitsMarkers(); }
 
 	enum class RangeSize
 	{
@@ -120,12 +144,96 @@ private:
 	RangeSize XRangeIsSmall() const;
 	RangeSize YRangeIsSmall() const;
 
-	double mXScale;
-	double mYScale;
+	/// Minimum average number of points per pixel column for which the
+	/// line is decimated.
+	static const unsigned int mDecimationThreshold;
+
+	/// Number of decimation buckets per pixel column.  Decimated geometry
+	/// is re-used until the zoom level changes by more than this factor.
+	static const unsigned int mDecimationOversampling;
+
+	/// Factor by which draft quality decimation is coarser than normal.
+	static const unsigned int mDraftDecimationFactor;
+
+	/// Number of points processed by each task when splitting the work for
+	/// large curves across threads.
+	static const unsigned int mParallelChunkSize;
+	static unsigned int GetChunkCount(const std::size_t& size);
+
+	/// Describes the contents of the line buffer.  Pan and zoom are applied
+	/// via the modelview matrix, so the buffer is only re-built when the data
+	/// or the axis scaling changes or when the view leaves the range covered
+	/// by the culled geometry.
+	struct LineGeometry
+	{
+		bool valid = false;
+		std::size_t pointCount = 0;
+		unsigned long long revision = 0;///< Revision of the data.
+		unsigned long long baseRevision = 0;///< Base revision of the data.
+
+		bool xLogarithmic = false;///< X-scaling applied to the buffer.
+		bool yLogarithmic = false;///< Y-scaling applied to the buffer.
+
+		bool culled = false;
+		double xMin = 0.0;///< Minimum x-value covered by culled geometry.
+		double xMax = 0.0;///< Maximum x-value covered by culled geometry.
+
+		bool decimated = false;
+		double bucketWidth = 0.0;///< Scaled x-range of each decimation bucket.
+
+		/// Markers are instanced from the line buffer, so geometry built for
+		/// drawing markers is never decimated.
+		bool markers = false;
+	};
+
+	LineGeometry mLineGeometry;
+
+	/// Result of checking the x-data for culling.  When points are appended
+	/// to the data, only the new points are checked.
+	struct MonotonicCheck
+	{
+		bool monotonic = false;
+		std::size_t pointCount = 0;
+		unsigned long long baseRevision = 0;///< Base revision of the data.
+	};
 
-	void InitializeMarkerVertexBuffer();
-	static std::vector<double> DoLogarithmicScale(
-		const std::vector<double>& values);
+	MonotonicCheck mMonotonicCheck;
+	bool XIsMonotonic();
+
+	bool LineGeometryIsCurrent(const unsigned int& columns) const;
+	void PrepareLine(const unsigned int& columns, const bool& markers);
+	unsigned int GetPlotAreaColumns() const;
+	bool LineCanBeAppended(const unsigned int& columns) const;
+	void AppendLine();
+	bool GetVisibleXRange(double& xMin, double& xMax) const;
+	double UnscaleX(const double& value) const;
+	static double GetScaledCenter(const Axis& axis);
+
+	// Set by BeginPrepareUpdate() and PrepareUpdate(); when mLinePrepared is
+	// true, the local line buffer is up-to-date but must still be uploaded.
+	// Anything which requires access to the window is evaluated in
+	// BeginPrepareUpdate(), since PrepareUpdate() runs on other threads.
+	unsigned int mPrepareColumns = 0;
+	bool mPrepareMarkers = false;
+	bool mLinePrepared = false;
+
+	static void Decimate(const std::vector<double>& x,
+		const std::vector<double>& y, const unsigned int& start,
+		const unsigned int& end, const double& xMin, const double& xMax,
+		const unsigned int& buckets, const bool& xLogarithmic,
+		const bool& yLogarithmic, std::vector<double>& xOut,
+		std::vector<double>& yOut);
+	static void DecimateRange(const std::vector<double>& x,
+		const std::vector<double>& y, const unsigned int& start,
+		const unsigned int& end, const double& xMin, const double& xMax,
+		const unsigned int& buckets, const bool& xLogarithmic,
+		const bool& yLogarithmic, std::vector<double>& xOut,
+		std::vector<double>& yOut);
+	static void GetIndexRange(const std::vector<double>& x,
+		const double& xMin, const double& xMax, unsigned int& start,
+		unsigned int& end);
+	static bool IsMonotonic(const std::vector<double>& values,
+		const std::size_t& start);
 };
 
 }// namespace LibPlot2D
@@ -52,6 +52,30 @@ public:
 	/// Performs the drawing operations.
 	void Draw();
 
+	/// Determines whether or not this object has work which can be done by
+	/// Prepare() prior to drawing.  Must be called from the thread which
+	/// owns the OpenGL context.
+	/// \returns True if Prepare() should be called.
+	bool BeginPrepare();
+
+	/// Performs the CPU-intensive portion of the next update (no OpenGL
+	/// calls).  May be called from any thread, but only between calls to
+	/// BeginPrepare() and Draw().
+	void Prepare() { PrepareUpdate(); }
+
+	/// Checks to see if this object will be rendered by the next call to
+	/// Draw().
+	/// \returns True if this object is visible and has valid parameters.
+	bool IsDrawable() { return mIsVisible && HasValidParameters(); }
+
+	/// Checks to see if the next call to Draw() will update any buffers.
+	/// \returns True if this object has changed since it was last drawn.
+	bool IsModified() const;
+
+	/// Gets the number of vertices in this object's buffers.
+	/// \returns The total vertex count.
+	unsigned int GetVertexCount() const;
+
 	/// \name Private data accessors.
 	/// @{
 
@@ -73,11 +97,21 @@ public:
 	///
 	/// \param drawOrder Value to assign to this object's drawing priority.
 	void SetDrawOrder(const unsigned int &drawOrder);
+
+	/// Sets a flag indicating that this object is drawn on top of the rest of
+	/// the scene.  Other objects are rendered once into a cached image, and
+	/// overlays are drawn over that image each frame, so changing an overlay
+	/// does not require re-drawing the rest of the scene.  Overlays are always
+	/// drawn after all other objects, regardless of draw order.
+	///
+	/// \param isOverlay True if this object is an overlay.
+	void SetIsOverlay(const bool &isOverlay);
 	inline void SetModified() { mModified = true; }///< Forces a full re-draw.
 
 	inline Color GetColor() const { return mColor; }
 	inline bool GetIsVisible() const { return mIsVisible; }
 	inline unsigned int GetDrawOrder() const { return mDrawOrder; }
+	inline bool GetIsOverlay() const { return mIsOverlay; }
 
 	/// @}
 
@@ -118,6 +152,11 @@ public:
 		/// Flag indicating whether or not a full update is required.
 		bool vertexCountModified = true;
 
+		/// Number of floats for which storage is allocated in the OpenGL
+		/// vertex buffer.  Only maintained by objects which update the
+		/// buffer in place (i.e. Line).
+		unsigned int vertexBufferCapacity = 0;
+
 		/// Obtains new OpenGL index values.  Always obtains vertex and array
 		/// buffer indices, but index buffers are optional.
 		///
@@ -169,6 +208,17 @@ protected:
 	/// Performs the actions necessary to render this object.
 	virtual void GenerateGeometry() = 0;
 
+	/// Checks to see if the next update includes work which may be done in
+	/// PrepareUpdate(), and captures any state it requires.  Called from the
+	/// thread which owns the OpenGL context.
+	/// \returns True if PrepareUpdate() should be called.
+	virtual bool BeginPrepareUpdate() { return false; }
+
+	/// Performs work for the next update which requires no OpenGL calls (and
+	/// no access to GUI objects), so it may be done in parallel for many
+	/// objects.  Results should be sent to OpenGL in Update().
+	virtual void PrepareUpdate() {}
+
 	/// Enables alpha blending.
 	void EnableAlphaBlending();
 
@@ -180,6 +230,7 @@ protected:
 
 private:
 	unsigned int mDrawOrder = 1000;
+	bool mIsOverlay = false;
 };
 
 }// namespace LibPlot2D
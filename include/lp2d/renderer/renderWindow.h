@@ -21,6 +21,7 @@
 // Local headers
 #include "lp2d/utilities/managedList.h"
 #include "lp2d/renderer/primitives/primitive.h"
+#include "lp2d/renderer/frameStatistics.h"
 
 // Eigen headers
 #include <Eigen/Eigen>
@@ -28,16 +29,21 @@
 // wxWidgets headers
 #include <wx/wx.h>
 #include <wx/glcanvas.h>
+#include <wx/timer.h>
 
 // Standard C++ headers
 #include <memory>
 #include <unordered_map>
 #include <typeindex>
 #include <mutex>
+#include <chrono>
 
 namespace LibPlot2D
 {
 
+// Local forward declarations
+class GlyphAtlas;
+
 /// Class for creating OpenGL scenes.  Includes event handlers for various
 /// mouse and keyboard interactions.
 class RenderWindow : public wxGLCanvas
@@ -179,10 +185,88 @@ public:
 	/// \returns True if the file was successfully written.
 	bool WriteImageToFile(wxString pathAndFileName) const;
 
+	/// Renders the scene offscreen at the specified size and writes it to
+	/// file.
+	///
+	/// \param pathAndFileName Location to write the file.
+	/// \param width           Width of the image in pixels.
+	/// \param height          Height of the image in pixels.
+	/// \param scale           Number of image pixels per window pixel.
+	///
+	/// \returns True if the file was successfully written.
+	///
+	/// \see RenderOffscreen
+	bool WriteImageToFile(wxString pathAndFileName, const unsigned int& width,
+		const unsigned int& height, const double& scale = 1.0);
+
 	/// Gets an image of the current rendered scene.
 	/// \returns An image object representing the current scene.
 	virtual wxImage GetImage() const;
 
+	/// Re-draws the scene offscreen at the window size and returns the
+	/// image.  Unlike GetImage(), this applies any settings which derived
+	/// classes use for images (i.e. curve quality) and does not depend on
+	/// the contents of the window.
+	/// \returns The rendered image, or an invalid image if the offscreen
+	///          framebuffer could not be created.
+	///
+	/// \see RenderOffscreen
+	wxImage RenderImage();
+
+	/// Renders the scene offscreen and returns the image.  The window does
+	/// not need to be shown on screen, but it must exist (on GTK, it must have
+	/// been realized) so that its OpenGL context can be made current.
+	/// Machines without a display may use a virtual X server (i.e. Xvfb with
+	/// Mesa's llvmpipe driver).
+	///
+	/// The scene is laid out as if the window were \p width / \p scale by
+	/// \p height / \p scale pixels, and then magnified to fill the image, so
+	/// line widths, marker sizes and text keep their proportions at any
+	/// resolution.  Large images are drawn in tiles, so the amount of video
+	/// memory required does not depend on the image size; each tile is read
+	/// back through a pixel buffer object while the next one is drawn.
+	///
+	/// \param width  Width of the image in pixels.
+	/// \param height Height of the image in pixels.
+	/// \param scale  Number of image pixels per window pixel.
+	///
+	/// \returns The rendered image, or an invalid image if the offscreen
+	///          framebuffer could not be created.
+	wxImage RenderOffscreen(const unsigned int& width,
+		const unsigned int& height, const double& scale = 1.0);
+
+	/// Checks to see if a call to RenderOffscreen() is in progress.
+	/// \returns True if rendering to the offscreen framebuffer.
+	bool IsRenderingOffscreen() const { return mOffscreenWidth > 0; }
+
+	/// Gets the number of output pixels per window pixel.  This is one,
+	/// except when RenderOffscreen() is magnifying the scene.
+	/// \returns The output scale.
+	double GetOutputScale() const { return mOutputScale; }
+
+	/// Sets the scissor box, specified in window pixels, and converts it to
+	/// framebuffer pixels (accounting for offscreen tiles and scaling).
+	/// Derived classes should use this instead of calling glScissor()
+	/// directly.
+	///
+	/// \param x      Left edge of the box.
+	/// \param y      Bottom edge of the box.
+	/// \param width  Width of the box.
+	/// \param height Height of the box.
+	void SetScissorArea(const int& x, const int& y, const int& width,
+		const int& height);
+
+	/// \name Render target size
+	/// These hide the wxWindow methods so that primitives are laid out for
+	/// the offscreen image during RenderOffscreen() (in window pixels, i.e.
+	/// before scaling); otherwise the window size is returned.
+	/// @{
+
+	wxSize GetSize() const;
+	void GetSize(int* width, int* height) const;
+
+	/// @}
+
 	/// Determines if a particular primitive is in the scene owned by this
 	/// object.
 	///
@@ -191,6 +275,12 @@ public:
 	/// \returns True if the \p pickedObject is owned by this.
 	bool IsThisRendererSelected(const Primitive *pickedObject) const;
 
+	/// Gets the current modelview matrix (transformation from pixels to
+	/// screen coordinates for most primitives).
+	/// \returns The modelview matrix.
+	const Eigen::Matrix4d& GetModelviewMatrix() const
+	{ return mModelviewMatrix; }
+
 	/// Sets a flag indicating that the primitives must be sorted by alpha
 	/// prior to rendering.
 	void SetNeedAlphaSort() { mNeedAlphaSort = true; }
@@ -332,6 +422,41 @@ public:
 	template<typename T>
 	GLuint GetPrimitiveTypeProgram() const;
 
+	/// Gets the texture containing the glyphs of the specified atlas within
+	/// this object's context, creating or updating it as required.
+	///
+	/// \param atlas Atlas for which the texture is required.
+	///
+	/// \returns The OpenGL texture id.
+	GLuint GetGlyphAtlasTexture(const GlyphAtlas& atlas);
+
+	/// Requests that the scene be re-drawn.  Requests are combined; once all
+	/// pending events have been handled, UpdateLayout() is called and the
+	/// scene is re-drawn, at most once per display refresh.  Use this instead
+	/// of Refresh() when responding to high-frequency input (i.e. mouse
+	/// motion).
+	void ScheduleRender();
+
+	/// Gets the time required for the most recent render requested with
+	/// ScheduleRender(), including the call to UpdateLayout().
+	/// \returns The duration of the last scheduled frame.
+	std::chrono::microseconds GetLastFrameDuration() const
+	{ return mLastFrameDuration; }
+
+	/// Gets the measurements of the frames drawn in this window.  Recording
+	/// must be enabled with FrameStatistics::SetEnabled().
+	/// \returns Reference to the frame statistics.
+	FrameStatistics& GetFrameStatistics() { return mFrameStatistics; }
+	const FrameStatistics& GetFrameStatistics() const
+	{ return mFrameStatistics; }
+
+	/// Forces the cached image of the non-overlay primitives to be re-drawn on
+	/// the next render.  This is only required if a primitive's appearance is
+	/// changed without marking it as modified.
+	///
+	/// \see Primitive::SetIsOverlay
+	void InvalidateLayerCache() { mLayerCacheValid = false; }
+
 	/// Accessor for the render mutex.
 	/// \returns Reference to the render mutex.
 	static std::mutex& GetRenderMutex() { return renderMutex; }
@@ -469,12 +594,108 @@ protected:
 	///                   be useful in derived classes.
 	virtual void DoResize(const unsigned int& viewportId);
 
+	/// Called immediately before each render requested with ScheduleRender().
+	/// Derived classes should perform any deferred layout computations here.
+	virtual void UpdateLayout() {}
+
+	/// Called when RenderOffscreen() changes the size of the render target,
+	/// both before rendering and after restoring the window size.  Derived
+	/// classes should update any layout which depends on the size here.
+	virtual void OnRenderSizeChanged() {}
+
+	/// Called before each on-screen frame while frame statistics are
+	/// enabled.  Derived classes may update overlays which display the
+	/// measurements of the previous frame here.
+	virtual void UpdateStatisticsOverlay() {}
+
 	DECLARE_EVENT_TABLE()
 
 private:
 	std::unique_ptr<wxGLContext> mContext;
 	wxGLContext* GetContext();
 
+	void PreparePrimitives();
+
+	// In 2D, non-overlay primitives are rendered into an offscreen
+	// framebuffer, which is copied to the window each frame until one of them
+	// changes.  This way, dragging overlays (cursors, zoom box, legend) has the
+	// same cost regardless of the amount of data being plotted.  Windows with
+	// multisample framebuffers are always drawn directly.
+	GLuint mLayerFramebuffer = 0;
+	GLuint mLayerRenderbuffer = 0;
+	int mLayerWidth = 0;
+	int mLayerHeight = 0;
+	bool mLayerCacheValid = false;
+	std::vector<const Primitive*> mCachedLayerPrimitives;
+
+	static const int mDefaultRefreshRate;// [Hz]
+
+	/// Timer for delaying scheduled renders until the next display refresh.
+	class FrameTimer : public wxTimer
+	{
+	public:
+		explicit FrameTimer(RenderWindow& renderWindow)
+			: mRenderWindow(renderWindow) {}
+		void Notify() override { mRenderWindow.RunScheduledFrame(); }
+
+	private:
+		RenderWindow& mRenderWindow;
+	};
+
+	FrameTimer mFrameTimer{ *this };
+	bool mRenderPending = false;
+	std::chrono::steady_clock::time_point mLastScheduledFrame;
+	std::chrono::microseconds mLastFrameDuration{ 0 };
+
+	FrameStatistics mFrameStatistics;
+
+	std::chrono::microseconds GetFrameInterval() const;
+	void RunScheduledFrame();
+
+	bool InitializeGL();
+	void DrawScene();
+
+	// Target for RenderOffscreen(); mOffscreenWidth and mOffscreenHeight
+	// (the layout size in window pixels) are non-zero only while rendering
+	// to it.  The image is drawn one tile at a time into the framebuffer.
+	GLuint mOffscreenFramebuffer = 0;
+	GLuint mOffscreenColorbuffer = 0;
+	GLuint mOffscreenDepthbuffer = 0;
+	int mOffscreenBufferWidth = 0;
+	int mOffscreenBufferHeight = 0;
+	int mOffscreenWidth = 0;
+	int mOffscreenHeight = 0;
+
+	static const int mMaxTileSize;// [pixels]
+
+	/// Describes the region of the offscreen image being drawn.
+	struct Tile
+	{
+		int x = 0;///< Left edge within the image [pixels].
+		int y = 0;///< Bottom edge within the image [pixels].
+		int width = 0;
+		int height = 0;
+	};
+
+	double mOutputScale = 1.0;
+	int mImageWidth = 0;// [pixels]
+	int mImageHeight = 0;// [pixels]
+	Tile mTile;
+
+	// Last scissor box requested with SetScissorArea() [window pixels]
+	int mScissorArea[4] = { 0, 0, 0, 0 };
+
+	bool PrepareOffscreenFramebuffer(const int& width, const int& height);
+	void FreeOffscreenFramebuffer();
+	Eigen::Matrix4d GetTileTransform() const;
+	void ApplyScissorArea() const;
+	void CopyTile(const GLuint& buffer, const Tile& tile, wxImage& image) const;
+
+	void DrawWithLayerCache(const bool& sceneModified);
+	bool PrepareLayerFramebuffer(const int& width, const int& height);
+	void FreeLayerFramebuffer();
+	void ClearColorBuffer() const;
+
 	static const double mExactPixelShift;
 
 	// Flags describing the options for this object's functionality
@@ -510,6 +731,7 @@ private:
 	// Window events
 	void OnPaint(wxPaintEvent& event);
 	void OnSize(wxSizeEvent& event);
+	void OnIdle(wxIdleEvent& event);
 	void OnEnterWindow(wxMouseEvent &event);
 	// End event handlers-------------------------------------------------
 
@@ -545,6 +767,18 @@ private:
 	std::unordered_map<std::type_index, bool> mTypeInitializedMap;
 	std::unordered_map<std::type_index, GLuint> mTypeProgramMap;
 
+	// Atlases are shared by all windows, but each context needs its own copy
+	// of the texture
+	struct GlyphAtlasTexture
+	{
+		GLuint id;
+		unsigned int revision = 0;
+		unsigned int width = 0;
+		unsigned int height = 0;
+	};
+
+	std::unordered_map<unsigned int, GlyphAtlasTexture> mGlyphAtlasTextures;
+
 	static std::mutex renderMutex;
 };
 
@@ -20,19 +20,21 @@
 // Eigen headers
 #include <Eigen/Eigen>
 
-// Freetype headers
-#include <ft2build.h>
-#include FT_FREETYPE_H
-
 // Standard C++ headers
 #include <string>
-#include <map>
-#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <cassert>
 
 namespace LibPlot2D
 {
 
-/// Helper class for building BufferInfo objects for rendering text.
+// Local forward declarations
+class GlyphAtlas;
+
+/// Helper class for building BufferInfo objects for rendering text.  Glyphs
+/// are obtained from the GlyphAtlas shared by all Text objects having the
+/// same font and size.  Strings are interpreted as UTF-8.
 class Text
 {
 public:
@@ -40,7 +42,7 @@ public:
 	///
 	/// \param renderer The window in which the text will be rendered.
 	explicit Text(RenderWindow& renderer);
-	~Text();
+	~Text() = default;
 
 	// Enforce rule of 5
 	Text(const Text&) = delete;
@@ -116,7 +118,9 @@ public:
 		int yDown;///< Pixels down.
 	};
 
-	/// Returns the bounding box associated with the specified string.
+	/// Returns the bounding box associated with the specified string.  The
+	/// layout of each string is cached, so repeated calls (and calls to
+	/// AppendText() or BuildText() with the same string) are inexpensive.
 	///
 	/// \param s String for which the bounding box is to be generated.
 	///
@@ -126,7 +130,7 @@ public:
 	/// Checks to see if this object is ready to render.
 	/// \returns True if this object was successfully initialized and is ready
 	///          to render.
-	bool IsOK() const { return mIsOK && (mGlyphsGenerated || mFace); }
+	bool IsOK() const { return mIsOK && !mFontFileName.empty(); }
 
 	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
@@ -136,51 +140,44 @@ private:
 
 	static const std::string mTextColorName;
 	static const std::string mVertexName;
-	static const std::string mTextureIndexName;
 
 	RenderWindow& mRenderer;
 
 	static GLint mVertexLocation;
-	static GLint mIndexLocation;
-
-	static FT_Library mFt;
-	static unsigned int mFtReferenceCount;
 
-	FT_Face mFace = nullptr;
 	Color mColor = Color::ColorBlack;
 
 	double mX;
 	double mY;
 	double mScale = 1.0;
 
-	unsigned int mMaxXSize;
-	unsigned int mMaxYSize;
-
 	std::string mText;
 
-	struct Glyph
-	{
-		unsigned int index;
-		int xSize;
-		int ySize;
-		int xBearing;
-		int yBearing;
-		unsigned int advance;
-	};
+	std::string mFontFileName;
+	unsigned int mWidth = 0;
+	unsigned int mHeight = 0;
 
-	std::map<char, Glyph> mGlyphs;
-	unsigned int mTextureId = std::numeric_limits<unsigned int>::max();
+	std::shared_ptr<GlyphAtlas> mAtlas;
+	GlyphAtlas* GetAtlas();
+	bool mIsOK = true;
 
-	void DoInternalInitialization();
 	GLuint DoGLInitialization();
 	friend RenderWindow;
 
-	bool GenerateGlyphs();
-	bool mGlyphsGenerated = false;
+	static std::u32string DecodeUTF8(const std::string& s);
 
-	void Initialize();
-	void FreeFTResources();
-	bool mIsOK = true;
+	// Layout of previously requested strings (at unit scale, relative to the
+	// text origin), so only the translation must be applied when the same
+	// string is rendered again
+	struct StringLayout
+	{
+		BoundingBox boundingBox;
+		std::vector<float> vertices;///< Four floats per vertex, six per glyph.
+	};
+
+	static const unsigned int mMaxCachedStrings;
+	std::unordered_map<std::string, StringLayout> mLayoutCache;
+	const StringLayout& GetLayout(const std::string& s);
 
 	Eigen::Matrix4d mModelview;
 
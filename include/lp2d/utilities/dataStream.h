@@ -0,0 +1,123 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  dataStream.h
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Lock-free single-producer/single-consumer buffer for streaming
+//        samples from an external thread to a plotted curve.
+
+#ifndef DATA_STREAM_H_
+#define DATA_STREAM_H_
+
+// Standard C++ headers
+#include <atomic>
+#include <memory>
+
+namespace LibPlot2D
+{
+
+// Local forward declarations
+class Dataset2D;
+
+/// Ring buffer for passing samples from a producer thread to the main
+/// thread without locking.  Exactly one thread may call Push() (the producer
+/// may be any thread, but must not change), and only the main thread may
+/// call Drain().  Streams are created via GuiInterface::AddStream(), which
+/// periodically drains the samples into the associated curve.
+class DataStream
+{
+public:
+	/// Options for handling samples pushed to a full buffer.
+	enum class OverflowPolicy
+	{
+		Block,///< Push() waits for space (the consumer is never behind).
+		DropOldest///< The oldest unread samples are discarded.
+	};
+
+	/// Constructor.
+	///
+	/// \param capacity Maximum number of unread samples.
+	/// \param policy   Method for handling samples pushed to a full buffer.
+	DataStream(const unsigned int& capacity, const OverflowPolicy& policy);
+
+	DataStream(const DataStream&) = delete;
+	DataStream& operator=(const DataStream&) = delete;
+
+	/// Adds a block of samples to the buffer.  Must only be called by the
+	/// producer thread.
+	///
+	/// \param x     Array of \p count x-values.
+	/// \param y     Array of \p count y-values.
+	/// \param count Number of samples to add.
+	///
+	/// \returns Number of samples added.  Less than \p count only if the
+	///          stream was closed.
+	unsigned int Push(const double* x, const double* y,
+		const unsigned int& count);
+
+	/// Adds a single sample to the buffer.  Must only be called by the
+	/// producer thread.
+	///
+	/// \param x X-value of the sample.
+	/// \param y Y-value of the sample.
+	///
+	/// \returns True if the sample was added (false if the stream was
+	///          closed).
+	bool Push(const double& x, const double& y) { return Push(&x, &y, 1) == 1; }
+
+	/// Moves all unread samples to the end of the specified dataset.
+	/// Samples pushed while draining are left for the next call.  Must only
+	/// be called by the consumer (main) thread.
+	///
+	/// \param target Dataset to which samples are appended.
+	///
+	/// \returns Number of samples appended.
+	unsigned int Drain(Dataset2D& target);
+
+	/// Closes the stream.  Subsequent calls to Push() (and any waiting
+	/// calls) return without adding samples.  Streams are closed when the
+	/// associated curve is removed.
+	void Close() { mClosed = true; }
+
+	/// Checks to see if the stream was closed.
+	/// \returns True if the stream was closed.
+	bool IsClosed() const { return mClosed; }
+
+	/// Gets the number of samples which were discarded due to overflow.
+	/// \returns The number of discarded samples.
+	unsigned long long GetDroppedCount() const { return mDropped; }
+
+	/// Gets the maximum number of unread samples.
+	/// \returns The capacity of the buffer.
+	unsigned int GetCapacity() const { return mCapacity; }
+
+private:
+	// Samples are accessed atomically because, under the drop-oldest
+	// policy, the producer may overwrite a slot while the consumer is
+	// reading it (the consumer then discards what it read)
+	struct Sample
+	{
+		std::atomic<double> x;
+		std::atomic<double> y;
+	};
+
+	const unsigned int mCapacity;
+	const OverflowPolicy mPolicy;
+	std::unique_ptr<Sample[]> mBuffer;
+
+	// Positions are never wrapped, so they uniquely identify each sample
+	std::atomic<unsigned long long> mHead{ 0 };///< Next write (producer).
+	std::atomic<unsigned long long> mTail{ 0 };///< Next read.
+	std::atomic<unsigned long long> mDropped{ 0 };
+	std::atomic<bool> mClosed{ false };
+};
+
+}// namespace LibPlot2D
+
+#endif// DATA_STREAM_H_
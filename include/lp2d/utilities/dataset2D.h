@@ -19,6 +19,7 @@
 #include <cstdlib>
 #include <vector>
 #include <memory>
+#include <atomic>
 
 // wxWidgets forward declarations
 class wxString;
@@ -50,6 +51,15 @@ public:
 	/// Reverses the order of the data stored in this object.
 	void Reverse();
 
+	/// Adds points to the end of the data.  Unlike other modifications, this
+	/// does not change the base revision.
+	///
+	/// \param x X-values of the points to add.
+	/// \param y Y-values of the points to add.
+	///
+	/// \see GetBaseRevision
+	void Append(const std::vector<double>& x, const std::vector<double>& y);
+
 	/// Computes the mean of the y-data.
 	/// \returns The mean of the y-data.
 	double ComputeYMean() const;
@@ -113,13 +123,28 @@ public:
 	/// \returns A reference to this.
 	Dataset2D& UnwrapData(const double& rolloverPoint);
 
+	/// Gets a value which changes each time the data is modified, so
+	/// objects which cache information derived from the data can tell when
+	/// it is stale.  Revisions are unique across all data sets and are
+	/// copied along with the data, so equal revisions imply equal data.
+	/// \returns The revision of the data.
+	unsigned long long GetRevision() const { return mRevision; }
+
+	/// Gets a value which changes each time the data is modified other than
+	/// by Append().  While the base revision is unchanged, information
+	/// derived from the first N points remains valid, so it may be extended
+	/// over the points added since instead of being re-computed.
+	/// \returns The base revision of the data.
+	unsigned long long GetBaseRevision() const { return mBaseRevision; }
+
 	/// \name Private data accessors
+	/// Obtaining non-const access to the data counts as a modification.
 	/// @{
 
 	const std::vector<double>& GetX() const { return mXData; };
 	const std::vector<double>& GetY() const { return mYData; };
-	std::vector<double>& GetX() { return mXData; };
-	std::vector<double>& GetY() { return mYData; };
+	std::vector<double>& GetX() { MarkModified(); return mXData; };
+	std::vector<double>& GetY() { MarkModified(); return mYData; };
 
 	/// @}
 
@@ -198,6 +223,11 @@ public:
 private:
 	std::vector<double> mXData, mYData;
 
+	static std::atomic<unsigned long long> mNextRevision;
+	unsigned long long mRevision = 0;
+	unsigned long long mBaseRevision = 0;
+	inline void MarkModified() { mRevision = ++mNextRevision; mBaseRevision = mRevision; }
+
 	static void GetOverlappingOnSameTimebase(const Dataset2D &d1,
 		const Dataset2D &d2, Dataset2D &d1Out, Dataset2D &d2Out);
 };
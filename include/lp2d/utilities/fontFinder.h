@@ -21,13 +21,33 @@ class wxString;
 // Local headers
 #include "lp2d/utilities/machineDefinitions.h"
 
+// Standard C++ headers
+#include <string>
+#include <map>
+#include <vector>
+#include <utility>
+#include <future>
+#include <mutex>
+#include <ctime>
+
 namespace LibPlot2D
 {
 
-/// Class for finding TrueType font files in a cross-platform way.
+/// Class for finding TrueType font files in a cross-platform way.  On Linux,
+/// fontconfig is used when available (define LP2D_USE_FONTCONFIG).
+/// Otherwise, names are looked up in an index of the system font directory,
+/// which is saved to the user's data directory and re-built only when the
+/// modification time of one of the font directories changes.
 class FontFinder
 {
 public:
+	/// Starts loading (or building) the font index on a background thread.
+	/// Calling this early during application start-up allows the index to be
+	/// ready by the time the first plot is created; if it is not called, the
+	/// index is prepared on the first call to GetFontFileName().  When
+	/// fontconfig is used, no index is needed and this does nothing.
+	static void BeginIndexing();
+
 	/// Gets the name of a font given an encoding and a list of preferred
 	/// fonts.  Using a list of preferred fonts allows calling code to specify
 	/// the names of multiple fonts, some of which may be more likely to exist
@@ -100,6 +120,35 @@ private:
 	static const unsigned int mSubFamilyNameRecordId;
 	static const unsigned int mFullNameRecordId;
 
+	static const std::string mIndexFileName;
+	static const std::string mIndexFileHeader;
+
+	/// Map of lower-case font names to font files (UTF-8), along with the
+	/// directories that were searched to build it and their modification
+	/// times.
+	struct FontIndex
+	{
+		std::map<std::string, std::string> files;
+		std::vector<std::pair<std::string, std::time_t>> directories;
+	};
+
+	static std::shared_future<FontIndex> mIndex;
+	static std::mutex mIndexMutex;
+
+	static std::shared_future<FontIndex> GetIndex();
+	static wxString GetFontDirectory();
+	static wxString GetIndexFilePath();
+	static FontIndex PrepareIndex(const wxString& fontDirectory,
+		const wxString& indexFile);
+	static FontIndex BuildIndex(const wxString& fontDirectory);
+	static bool ReadIndex(const wxString& indexFile, FontIndex& index);
+	static void WriteIndex(const wxString& indexFile, const FontIndex& index);
+	static bool IndexIsCurrent(const FontIndex& index);
+
+#ifdef LP2D_USE_FONTCONFIG
+	static wxString FindWithFontconfig(const wxString &fontName);
+#endif
+
 	// TTF file header
 	struct TT_OFFSET_TABLE
 	{
@@ -0,0 +1,181 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  jobQueue.h
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Pool of worker threads for executing long-running jobs, with support
+//        for progress reporting, cancellation and delivery of results to the
+//        main thread.
+
+#ifndef JOB_QUEUE_H_
+#define JOB_QUEUE_H_
+
+// wxWidgets headers
+#include <wx/wx.h>
+
+// Standard C++ headers
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace LibPlot2D
+{
+
+/// Class for executing jobs on a pool of worker threads.  Jobs communicate
+/// with the main (GUI) thread only through their Context:  progress and
+/// cancellation status are shared via thread-safe members, and anything that
+/// must touch the GUI (adding curves, displaying messages, etc.) is posted
+/// to the main thread and executed the next time ProcessPending() is called.
+class JobQueue
+{
+private:
+	struct Job;
+
+public:
+	/// Constructor.
+	///
+	/// \param threadCount Number of worker threads to create.  Use zero to
+	///                    select the number of threads based on the hardware.
+	explicit JobQueue(const unsigned int& threadCount = 0);
+
+	/// Destructor.  Cancels all jobs and waits for the worker threads to
+	/// exit.  Functions posted to the main thread which have not yet been
+	/// executed (including cancellation notifications) are discarded.
+	~JobQueue();
+
+	JobQueue(const JobQueue&) = delete;
+	JobQueue& operator=(const JobQueue&) = delete;
+
+	/// Interface provided to running jobs.  Methods of this class may be
+	/// called from the worker thread.
+	class Context
+	{
+	public:
+		/// Reports the progress of the job.
+		///
+		/// \param fraction Fraction of the job that has been completed (0 to
+		///                 1).
+		void SetProgress(const double& fraction);
+
+		/// Checks to see if the job was cancelled.  Long running jobs should
+		/// call this periodically and return early if it returns true.
+		///
+		/// \returns True if the job was cancelled.
+		bool IsCancelled() const;
+
+		/// Queues a function for execution on the main thread.  If the job is
+		/// cancelled before the function is executed, it is discarded.
+		///
+		/// \param function Function to execute.
+		void PostToMainThread(std::function<void()> function);
+
+		/// Queues a message to be displayed (via wxMessageBox) on the main
+		/// thread.
+		///
+		/// \param message Text of the message.
+		/// \param caption Caption of the message box.
+		/// \param style   Style flags for the message box.
+		void ShowMessage(const wxString& message, const wxString& caption,
+			const long& style);
+
+	private:
+		friend class JobQueue;
+		Context(JobQueue& queue, const std::shared_ptr<Job>& job)
+			: mQueue(queue), mJob(job) {}
+
+		JobQueue& mQueue;
+		const std::shared_ptr<Job> mJob;
+	};
+
+	/// Function representing the work to be done by a job.
+	typedef std::function<void(Context&)> Work;
+
+	/// Adds a job to the queue.
+	///
+	/// \param description Text describing the job (for display to the user).
+	/// \param work        Function to execute on a worker thread.
+	/// \param onCancelled Function to execute on the main thread (from
+	///                    ProcessPending()) if the job is cancelled, once
+	///                    nothing more from the job will be executed.
+	///
+	/// \returns Identifier of the new job.
+	unsigned int Submit(const wxString& description, Work work,
+		std::function<void()> onCancelled = nullptr);
+
+	/// Requests that the specified job be cancelled.  Jobs which have not yet
+	/// started are removed from the queue; running jobs are notified via
+	/// Context::IsCancelled().  In either case, nothing more from the job will
+	/// be executed on the main thread.
+	///
+	/// \param id Identifier of the job to cancel.
+	void Cancel(const unsigned int& id);
+
+	/// Requests that all jobs be cancelled.
+	void CancelAll();
+
+	/// Structure describing the state of a job.
+	struct JobStatus
+	{
+		unsigned int id;///< Identifier of the job.
+		wxString description;///< Text describing the job.
+		double progress;///< Fraction of the job that has been completed.
+		bool running;///< True if the job has been started by a worker.
+	};
+
+	/// Gets the state of all jobs that have not yet completed.
+	/// \returns List of job states, in order of submission.
+	std::vector<JobStatus> GetStatus() const;
+
+	/// Checks to see if any jobs have not yet completed.
+	/// \returns True if there are no incomplete jobs.
+	bool IsIdle() const;
+
+	/// Executes any functions posted to the main thread and removes finished
+	/// jobs.  Must be called periodically from the main thread.
+	void ProcessPending();
+
+private:
+	struct Job
+	{
+		unsigned int id;
+		wxString description;
+		Work work;
+		std::function<void()> onCancelled;
+
+		std::atomic<double> progress{ 0.0 };
+		std::atomic<bool> cancelled{ false };
+		bool running = false;
+		bool finished = false;
+	};
+
+	typedef std::pair<std::shared_ptr<Job>, std::function<void()>>
+		PendingFunction;
+
+	std::vector<std::thread> mThreads;
+
+	mutable std::mutex mMutex;
+	std::condition_variable mJobAvailable;
+	std::deque<std::shared_ptr<Job>> mWaitingJobs;
+	std::vector<std::shared_ptr<Job>> mJobs;
+	std::deque<PendingFunction> mPendingFunctions;
+	unsigned int mNextId = 0;
+	bool mStopping = false;
+
+	void WorkerLoop();
+	void Post(const std::shared_ptr<Job>& job, std::function<void()> function);
+};
+
+}// namespace LibPlot2D
+
+#endif// JOB_QUEUE_H_
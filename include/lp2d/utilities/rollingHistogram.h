@@ -0,0 +1,109 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  rollingHistogram.h
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Distribution of the most recent samples of a quantity, with bins
+//        which double in width (for timing and size measurements).
+
+#ifndef ROLLING_HISTOGRAM_H_
+#define ROLLING_HISTOGRAM_H_
+
+// Standard C++ headers
+#include <vector>
+
+namespace LibPlot2D
+{
+
+/// Keeps the most recent samples of a quantity and sorts them into bins.  The
+/// upper limit of the first bin is specified, and each subsequent bin is
+/// twice as wide as the previous one; the last bin has no upper limit.  This
+/// suits quantities like frame times, where the interesting range spans
+/// several orders of magnitude.  Once the capacity is reached, each new
+/// sample replaces the oldest one.
+class RollingHistogram
+{
+public:
+	/// Constructor.
+	///
+	/// \param capacity      Number of samples to keep.
+	/// \param firstBinLimit Upper limit of the first bin.
+	/// \param binCount      Number of bins.
+	RollingHistogram(const unsigned int& capacity,
+		const double& firstBinLimit, const unsigned int& binCount);
+
+	/// Adds a sample, discarding the oldest sample if the histogram is full.
+	///
+	/// \param value Value of the sample.
+	void Add(const double& value);
+
+	/// Discards all samples.
+	void Clear();
+
+	/// \name Statistics of the retained samples
+	/// @{
+
+	/// Gets the number of samples currently retained.
+	/// \returns The number of samples.
+	unsigned int GetSampleCount() const { return mSamples.size(); }
+
+	/// Gets the most recently added sample.
+	/// \returns The last sample, or zero if there are no samples.
+	double GetLast() const;
+
+	double GetMean() const;
+	double GetMaximum() const;
+
+	/// Gets the value below which the specified fraction of the samples lie.
+	///
+	/// \param fraction Fraction of samples (0.5 for the median).
+	///
+	/// \returns The percentile value, or zero if there are no samples.
+	double GetPercentile(const double& fraction) const;
+
+	/// @}
+
+	/// \name Bin accessors
+	/// @{
+
+	unsigned int GetBinCount() const { return mBinCounts.size(); }
+
+	/// Gets the upper limit of the specified bin.  Samples equal to the limit
+	/// fall into the next bin.
+	///
+	/// \param bin Index of the bin.
+	///
+	/// \returns The upper limit (infinity for the last bin).
+	double GetBinUpperLimit(const unsigned int& bin) const;
+
+	/// Gets the number of retained samples which fall into the specified bin.
+	///
+	/// \param bin Index of the bin.
+	///
+	/// \returns The number of samples.
+	unsigned int GetBinSampleCount(const unsigned int& bin) const
+	{ return mBinCounts[bin]; }
+
+	/// @}
+
+private:
+	const unsigned int mCapacity;
+	const double mFirstBinLimit;
+
+	std::vector<double> mSamples;
+	unsigned int mNext = 0;///< Index of the slot to receive the next sample.
+
+	std::vector<unsigned int> mBinCounts;
+
+	unsigned int GetBin(const double& value) const;
+};
+
+}// namespace LibPlot2D
+
+#endif// ROLLING_HISTOGRAM_H_
@@ -0,0 +1,96 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  threadPool.h
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Pool of worker threads for splitting short, CPU-bound loops (such as
+//        building curve geometry) across all available cores.
+
+#ifndef THREAD_POOL_H_
+#define THREAD_POOL_H_
+
+// Standard C++ headers
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <exception>
+
+namespace LibPlot2D
+{
+
+/// Executes the iterations of a loop in parallel.  Unlike JobQueue, which
+/// runs long jobs in the background, ParallelFor() blocks until all of the
+/// iterations are complete; the calling thread also executes iterations.
+/// Only one loop runs on the pool at a time.  Nested calls (or calls made
+/// while the pool is busy) execute the loop serially on the calling thread,
+/// so it is always safe to call ParallelFor() from within a loop body.
+class ThreadPool
+{
+public:
+	/// Constructor.
+	///
+	/// \param workerCount Number of worker threads to create (in addition to
+	///                    the thread calling ParallelFor()).
+	explicit ThreadPool(const unsigned int& workerCount);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/// Calls \p function once for each index from zero to \p count - 1, in
+	/// no particular order, and waits for all calls to complete.  If any
+	/// call throws, the first exception is re-thrown (after all calls have
+	/// completed or been skipped).
+	///
+	/// \param count    Number of iterations.
+	/// \param function Loop body, taking the iteration index.
+	void ParallelFor(const unsigned int& count,
+		const std::function<void(const unsigned int&)>& function);
+
+	/// Gets the number of threads which execute loop iterations.
+	/// \returns The number of workers plus one (for the calling thread).
+	unsigned int GetThreadCount() const { return mThreads.size() + 1; }
+
+	/// Gets the pool shared by all renderers, having one thread per core.
+	/// \returns Reference to the shared pool.
+	static ThreadPool& GetSharedPool();
+
+private:
+	std::vector<std::thread> mThreads;
+
+	std::mutex mRunMutex;///< Held for the duration of each loop.
+	std::mutex mMutex;///< Protects the loop state below.
+	std::condition_variable mWorkCondition;
+	std::condition_variable mDoneCondition;
+
+	const std::function<void(const unsigned int&)>* mFunction = nullptr;
+	unsigned int mCount = 0;
+	std::atomic<unsigned int> mNext{ 0 };
+	unsigned int mBusyWorkers = 0;
+	unsigned long long mGeneration = 0;
+	bool mStopping = false;
+
+	std::exception_ptr mException;
+	std::atomic<bool> mFailed{ false };
+
+	/// True on threads which are executing loop iterations (including all
+	/// worker threads), so nested calls run serially without contending for
+	/// mRunMutex (which the thread may already hold).
+	static thread_local bool mInsideLoop;
+
+	void WorkerLoop();
+	void RunIterations();
+};
+
+}// namespace LibPlot2D
+
+#endif// THREAD_POOL_H_
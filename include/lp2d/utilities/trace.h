@@ -0,0 +1,138 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  trace.h
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Records timed events from all threads for viewing in the Chrome
+//        trace viewer (chrome://tracing or Perfetto).
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <ostream>
+#include <cstddef>
+
+/// Records the time spent in the enclosing scope while tracing is enabled.
+/// \p category and \p name must be string literals.  Defining
+/// LP2D_DISABLE_TRACE removes all trace points at compile time.
+#ifdef LP2D_DISABLE_TRACE
+#define LP2D_TRACE_SCOPE(category, name)
+#else
+#define LP2D_TRACE_CONCATENATE_(a, b) a##b
+#define LP2D_TRACE_CONCATENATE(a, b) LP2D_TRACE_CONCATENATE_(a, b)
+#define LP2D_TRACE_SCOPE(category, name) const LibPlot2D::Trace::Scope \
+	LP2D_TRACE_CONCATENATE(lp2dTraceScope, __LINE__)(category, name)
+#endif// LP2D_DISABLE_TRACE
+
+namespace LibPlot2D
+{
+
+/// Process-wide collection of timed events.  Trace points are placed with
+/// the LP2D_TRACE_SCOPE macro; while tracing is disabled (the default), each
+/// one costs a single flag check.  Once enabled, events from all threads are
+/// collected until they are written with WriteChromeTrace() or discarded with
+/// Clear().  The number of retained events is limited, so tracing may be
+/// left enabled for long sessions; further events are discarded once the
+/// limit is reached.
+class Trace
+{
+public:
+	typedef std::chrono::steady_clock Clock;
+
+	/// Enables or disables the collection of events.  Disabling tracing
+	/// does not discard events which were already collected.
+	///
+	/// \param enabled True to start collecting events.
+	static void SetEnabled(const bool& enabled);
+	static inline bool IsEnabled()
+	{ return mEnabled.load(std::memory_order_relaxed); }
+
+	/// Discards all collected events.
+	static void Clear();
+
+	/// Sets the name which identifies the calling thread in the trace.
+	///
+	/// \param name Name of the thread.
+	static void SetThreadName(const std::string& name);
+
+	/// Writes the collected events in Chrome trace (JSON) format.
+	///
+	/// \param fileName Path and name of the file to write.
+	///
+	/// \returns True if the file was written successfully.
+	static bool WriteChromeTrace(const std::string& fileName);
+
+	/// Writes the collected events in Chrome trace (JSON) format.
+	///
+	/// \param stream Stream to which the events are written.
+	static void WriteChromeTrace(std::ostream& stream);
+
+	/// Records one event spanning the lifetime of this object.  Use the
+	/// LP2D_TRACE_SCOPE macro instead of creating these directly.
+	class Scope
+	{
+	public:
+		/// Constructor.
+		///
+		/// \param category Category of the event (a string literal).
+		/// \param name     Name of the event (a string literal).
+		Scope(const char* category, const char* name)
+			: mCategory(category), mName(name), mActive(IsEnabled())
+		{ if (mActive) mStart = Clock::now(); }
+
+		~Scope() { if (mActive) Record(mCategory, mName, mStart); }
+
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+
+	private:
+		const char* const mCategory;
+		const char* const mName;
+		const bool mActive;
+		Clock::time_point mStart;
+	};
+
+private:
+	static const std::size_t mMaxEventCount;
+	static const Clock::time_point mEpoch;
+
+	/// Information describing a completed scope.
+	struct Event
+	{
+		const char* category;
+		const char* name;
+		Clock::time_point start;
+		Clock::duration duration;
+		unsigned int threadId;
+	};
+
+	static std::atomic<bool> mEnabled;
+	static std::atomic<unsigned int> mNextThreadId;
+
+	static std::mutex mMutex;///< Protects the event list and thread names.
+	static std::vector<Event> mEvents;
+	static std::map<unsigned int, std::string> mThreadNames;
+
+	static unsigned int GetThreadId();
+	static void Record(const char* category, const char* name,
+		const Clock::time_point& start);
+
+	static std::string EscapeString(const std::string& s);
+};
+
+}// namespace LibPlot2D
+
+#endif// TRACE_H_
@@ -20,6 +20,12 @@ else
 	libName="Plot2d_d"
 fi
 
+# Link against fontconfig if the library was built with it (see makefile.inc)
+requires="freetype2,glew,gl"
+if pkg-config --exists fontconfig ; then
+	requires="$requires,fontconfig"
+fi
+
 # It seems that pkg-config does not support backtick execution.  Would be nicer
 # to have backticks executed by make instead of by this script, but I haven't
 # found a solution yet.
@@ -33,7 +39,7 @@ echo Name: LibPlot2D>> $outputFile
 echo URL: https://github.com/KerryL/LibPlot2D>> $outputFile
 echo Description: Lightweight 2D plotting library.>> $outputFile
 echo Version: $version>> $outputFile
-echo Requires: freetype2,glew,gl>> $outputFile
+echo Requires: $requires>> $outputFile
 echo Requires.private: >> $outputFile
 echo Libs: -L\${libdir} -l$libName `wx-config --version=3.1 $debug_flag --libs all`>> $outputFile
 echo Libs.private: >> $outputFile
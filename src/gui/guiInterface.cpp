@@ -35,6 +35,8 @@
 #include "lp2d/utilities/signals/fft.h"
 #include "lp2d/utilities/signals/filter.h"
 #include "lp2d/utilities/guiUtilities.h"
+#include "lp2d/utilities/fontFinder.h"
+#include "lp2d/utilities/trace.h"
 #include "lp2d/libPlot2D.h"
 
 // wxWidgets headers
@@ -44,15 +46,35 @@
 // Standard C++ headers
 #include <map>
 #include <algorithm>
+#include <numeric>
 
 namespace LibPlot2D
 {
 
+//=============================================================================
+// Class:			GuiInterface
+// Function:		Constant declarations
+//
+// Description:		Constant declarations for GuiInterface class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const int GuiInterface::mStreamDrainInterval(33);// [msec]
+
 //=============================================================================
 // Class:			GuiInterface
 // Function:		GuiInterface
 //
-// Description:		Constructor for GuiInterface class.
+// Description:		Constructor for GuiInterface class.  Starts locating fonts
+//					so they are ready by the time the first plot is created.
 //
 // Input Arguments:
 //		owner	= wxFrame*
@@ -66,6 +88,37 @@ namespace LibPlot2D
 //=============================================================================
 GuiInterface::GuiInterface(wxFrame* owner) : mOwner(owner)
 {
+	FontFinder::BeginIndexing();
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		~GuiInterface
+//
+// Description:		Destructor for GuiInterface class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+GuiInterface::~GuiInterface()
+{
+	mStreamTimer.Stop();
+	for (auto& stream : mStreams)
+		stream.stream->Close();
+
+	mJobQueue.CancelAll();
+	if (mJobProgressDialog)
+	{
+		mJobProgressDialog->Stop();
+		mJobProgressDialog->Destroy();
+	}
 }
 
 //=============================================================================
@@ -76,28 +129,98 @@ GuiInterface::GuiInterface(wxFrame* owner) : mOwner(owner)
 //
 // Input Arguments:
 //		fileList	= const wxArrayString&
+//		onLoaded	= LoadCallback
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		true for files successfully loaded, false otherwise
+//		true if loading was started, false otherwise
 //
 //=============================================================================
-bool GuiInterface::LoadFiles(const wxArrayString &fileList)
+bool GuiInterface::LoadFiles(const wxArrayString &fileList,
+	LoadCallback onLoaded)
 {
-	unsigned int i, j;
-	std::vector<bool> loaded(fileList.size());
 	std::vector<std::unique_ptr<DataFile>> files(fileList.size());
+	unsigned int i;
+	for (i = 0; i < fileList.Count(); ++i)
+		files[i] = mFileTypeManager.GetDataFile(fileList[i]);
+
+	wxArrayString sourceNames;
+	for (const auto& fileName : fileList)
+		sourceNames.Add(GuiUtilities::ExtractFileNameFromPath(fileName));
+
+	// Copy the list, because fileList may refer to mLastFilesLoaded
+	return LoadDataFiles(files, sourceNames,
+		[this, fileList, sourceNames, onLoaded](const bool& loaded)
+	{
+		if (loaded)
+		{
+			if (mOwner)
+			{
+				if (fileList.Count() > 1)
+					mOwner->SetTitle(_T("Multiple Files - ") + mApplicationTitle);
+				else
+					mOwner->SetTitle(sourceNames[0] + _T("- ") + mApplicationTitle);
+			}
+
+			mLastFilesLoaded = fileList;
+		}
+
+		if (onLoaded)
+			onLoaded(loaded);
+	});
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		LoadDataFiles
+//
+// Description:		Prompts the user for extraction options and starts a
+//					background job to load the specified data files.  The
+//					resulting curves are added to the plot (on the main
+//					thread) as data becomes available, or once all files have
+//					been loaded if progressive loading is not possible.
+//					Shared by the file- and text-based loading methods.
+//
+// Input Arguments:
+//		files		= std::vector<std::unique_ptr<DataFile>>& (null entries
+//					  are skipped)
+//		sourceNames	= const wxArrayString& used to distinguish curves when
+//					  more than one source is loaded
+//		onComplete	= LoadCallback executed once loading is complete (only
+//					  if loading is started)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		true if loading was started, false otherwise
+//
+//=============================================================================
+bool GuiInterface::LoadDataFiles(std::vector<std::unique_ptr<DataFile>>& files,
+	const wxArrayString& sourceNames, LoadCallback onComplete)
+{
+	assert(files.size() == sourceNames.size());
+
+	std::shared_ptr<LoadRequest> request(std::make_shared<LoadRequest>());
+	request->sourceNames = sourceNames;
+	request->selections.resize(files.size());
+	request->lazy.resize(files.size());
+	request->loaded.resize(files.size());
+	request->progressiveInterval = mProgressiveLoadInterval;
+	request->progressiveCurves.resize(files.size());
+	request->onComplete = std::move(onComplete);
+
+	unsigned int i;
 	typedef std::map<wxArrayString, DataFile::SelectionData,
 		ArrayStringCompare> SelectionMap;
 	SelectionMap selectionInfoMap;
 	SelectionMap::const_iterator it;
 	DataFile::SelectionData selectionInfo;
-	bool atLeastOneFileLoaded(false);
-	for (i = 0; i < fileList.Count(); ++i)
+	bool atLeastOneFileSelected(false);
+	for (i = 0; i < files.size(); ++i)
 	{
-		files[i] = mFileTypeManager.GetDataFile(fileList[i]);
 		if (!files[i])
 		{
 			// TODO:  Error message?
@@ -132,109 +255,272 @@ bool GuiInterface::LoadFiles(const wxArrayString &fileList)
 		else
 			selectionInfo = it->second;
 
-		loaded[i] = selectionInfo.selections.Count() > 0 && files[i]->Load(selectionInfo);
-		atLeastOneFileLoaded = atLeastOneFileLoaded || loaded[i];
+		request->selections[i] = selectionInfo;
+		request->lazy[i] = mLazyLoading && files[i]->SupportsLazyLoad();
+		atLeastOneFileSelected = atLeastOneFileSelected ||
+			selectionInfo.selections.Count() > 0;
 	}
 
-	if (!atLeastOneFileLoaded)
+	if (!atLeastOneFileSelected)
 		return false;
 
-	if (selectionInfo.removeExisting)
-		ClearAllCurves();
+	request->files = std::move(files);
 
-	wxString curveName;
-	for (i = 0; i < fileList.Count(); ++i)
-	{
-		if (!loaded[i])
-			continue;
+	wxString description;
+	if (sourceNames.Count() > 1)
+		description.Printf(_T("Loading %u files"),
+			static_cast<unsigned int>(sourceNames.Count()));
+	else
+		description = _T("Loading ") + sourceNames[0];
 
-		for (j = 0; j < files[i]->GetDataCount(); ++j)
+	StartJob(description, [this, request](JobQueue::Context& context)
+	{
+		const unsigned int count(request->files.size());
+		unsigned int j;
+		for (j = 0; j < count; ++j)
 		{
-			if (fileList.Count() > 1)
-				curveName = files[i]->GetDescription(j + 1) + _T(" : ") + GuiUtilities::ExtractFileNameFromPath(fileList[i]);
+			auto& file(request->files[j]);
+			if (!file || request->selections[j].selections.Count() == 0)
+				continue;
+
+			file->SetJobContext(&context, static_cast<double>(j) / count,
+				1.0 / count);
+			if (request->lazy[j])
+				request->loaded[j] = file->LoadIndex(request->selections[j]);
 			else
-				curveName = files[i]->GetDescription(j + 1);
-			AddCurve(std::move(files[i]->GetDataset(j)), curveName);
+			{
+				if (request->progressiveInterval > 0 &&
+					file->SupportsProgressiveLoad())
+				{
+					file->SetPartialDataCallback([this, request, j, &context](
+						std::vector<std::unique_ptr<Dataset2D>> data)
+					{
+						// Wrapped because std::function must be copyable
+						auto sharedData(std::make_shared<
+							std::vector<std::unique_ptr<Dataset2D>>>(std::move(data)));
+						context.PostToMainThread([this, request, j, sharedData]()
+						{
+							AppendLoadedData(*request, j, *sharedData);
+						});
+					}, request->progressiveInterval);
+				}
+
+				request->loaded[j] = file->Load(request->selections[j]);
+				file->SetPartialDataCallback(nullptr, 0);
+			}
+			file->SetJobContext(nullptr);
+
+			if (context.IsCancelled())
+				return;
+		}
+
+		context.PostToMainThread([this, request]()
+		{
+			AddLoadedFiles(*request);
+		});
+	}, [request]()
+	{
+		ReportLoadComplete(*request, false);
+	});
+
+	return true;
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		AddLoadedFiles
+//
+// Description:		Adds the curves from the files loaded by a background job
+//					to the plot.  Must be called from the main thread.
+//
+// Input Arguments:
+//		request	= LoadRequest&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GuiInterface::AddLoadedFiles(LoadRequest& request)
+{
+	auto& files(request.files);
+	unsigned int i, j, lastLoaded(0);
+	bool atLeastOneFileLoaded(false), removedPartialCurves(false);
+	for (i = 0; i < files.size(); ++i)
+	{
+		// Curves from files which were progressively loaded are complete
+		for (const auto& curve : request.progressiveCurves[i])
+		{
+			if (mLoadingCurves.erase(curve) == 0 || request.loaded[i])
+				continue;
+
+			// Loading failed part way through - discard the partial data
+			for (j = 0; j < mPlotList.GetCount(); ++j)
+			{
+				if (mPlotList[j].get() == curve)
+				{
+					RemoveCurve(j);
+					removedPartialCurves = true;
+					break;
+				}
+			}
+		}
+
+		if (request.loaded[i])
+		{
+			atLeastOneFileLoaded = true;
+			lastLoaded = i;
 		}
 	}
 
-	if (mOwner)
+	if (removedPartialCurves)
+		mRenderer->UpdateDisplay();
+
+	if (!atLeastOneFileLoaded)
 	{
-		if (fileList.Count() > 1)
-			mOwner->SetTitle(_T("Multiple Files - ") + mApplicationTitle);
-		else
-			mOwner->SetTitle(GuiUtilities::ExtractFileNameFromPath(fileList[0]) + _T("- ") + mApplicationTitle);
+		ReportLoadComplete(request, false);
+		return;
 	}
 
+	const DataFile::SelectionData& selectionInfo(request.selections[lastLoaded]);
+	PrepareForLoadedCurves(request, lastLoaded);
+
+	// Lazily loaded files are handed off to the channel cache below
 	mGenericXAxisLabel = files[0]->GetDescription(0);
+	mLastDescriptions = files[files.size() - 1]->GetAllDescriptions();
+
+	for (i = 0; i < files.size(); ++i)
+	{
+		if (!request.loaded[i])
+			continue;
+
+		// Files which were progressively loaded have no remaining datasets
+		wxArrayString curveNames;
+		std::vector<std::unique_ptr<Dataset2D>> datasets;
+		for (j = 0; j < files[i]->GetDataCount(); ++j)
+		{
+			curveNames.Add(GetLoadedCurveName(request, i, j));
+			datasets.push_back(std::move(files[i]->GetDataset(j)));
+		}
+
+		if (request.lazy[i])
+		{
+			std::vector<Dataset2D*> channels;
+			for (const auto& dataset : datasets)
+				channels.push_back(dataset.get());
+			mChannelCache.AddSource(std::move(files[i]), channels);
+		}
+
+		for (j = 0; j < datasets.size(); ++j)
+			AddCurve(std::move(datasets[j]), curveNames[j], !request.lazy[i] || j == 0);
+	}
+
 	SetXDataLabel(mGenericXAxisLabel);
 	mRenderer->SaveCurrentZoom();
 
-	// Because fileList is a reference (and may refer to lastFilesLoaded), we need to check for self-assignment
-	if (&fileList != &mLastFilesLoaded)
-		mLastFilesLoaded = fileList;
 	mLastSelectionInfo = selectionInfo;
-	mLastDescriptions = files[files.size() - 1]->GetAllDescriptions();
 
-	return true;
+	ReportLoadComplete(request, true);
 }
 
 //=============================================================================
 // Class:			GuiInterface
-// Function:		LoadText
+// Function:		ReportLoadComplete
 //
-// Description:		Public method for loading a single object from text.
-//					This writes the text to a temporary file, then tries to
-//					open it using normal methods.
+// Description:		Executes the completion function for a load request.  The
+//					function is executed at most once, even if the request is
+//					cancelled after it completes.
 //
 // Input Arguments:
-//		textData	= const wxString&
+//		request	= LoadRequest&
+//		loaded	= const bool& true if curves were added to the plot
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		true for file successfully loaded, false otherwise
+//		None
 //
 //=============================================================================
-bool GuiInterface::LoadText(const wxString &textData)
+void GuiInterface::ReportLoadComplete(LoadRequest& request, const bool& loaded)
 {
-	wxString tempFileName(GenerateTemporaryFileName());
-	while (wxFile::Exists(tempFileName))
-		tempFileName = GenerateTemporaryFileName();
+	LoadCallback onComplete(std::move(request.onComplete));
+	request.onComplete = nullptr;
+	if (onComplete)
+		onComplete(loaded);
+}
 
-	std::ofstream tempFile(tempFileName.mb_str(), std::ios::out);
-	if (!tempFile.good() || !tempFile.is_open())
+//=============================================================================
+// Class:			GuiInterface
+// Function:		AppendLoadedData
+//
+// Description:		Handles partial data delivered while a file is being
+//					loaded by a background job.  The first delivery adds the
+//					curves; subsequent deliveries are appended to the existing
+//					curves.  Must be called from the main thread.
+//
+// Input Arguments:
+//		request	= LoadRequest&
+//		file	= const unsigned int& index of the file within the request
+//		data	= std::vector<std::unique_ptr<Dataset2D>>& new rows for
+//				  each channel
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GuiInterface::AppendLoadedData(LoadRequest& request,
+	const unsigned int& file, std::vector<std::unique_ptr<Dataset2D>>& data)
+{
+	auto& curves(request.progressiveCurves[file]);
+	unsigned int i;
+	if (curves.empty())
 	{
-		tempFile.close();
-		if (remove(tempFileName.mb_str()) != 0)
-			wxMessageBox(_T("Error deleting temporary file '") + tempFileName + _T("'."),
-			_T("Could Not Delete File"), wxICON_ERROR, mOwner);
-		return false;
-	}
+		PrepareForLoadedCurves(request, file);
+
+		for (i = 0; i < data.size(); ++i)
+		{
+			curves.push_back(data[i].get());
+			mLoadingCurves.insert(data[i].get());
+			AddCurve(std::move(data[i]), GetLoadedCurveName(request, file, i));
+		}
 
-	tempFile << textData;
-	tempFile.close();
+		mGenericXAxisLabel = request.files[file]->GetDescription(0);
+		SetXDataLabel(mGenericXAxisLabel);
+		return;
+	}
 
-	bool fileLoaded = LoadFiles(wxArrayString(1, &tempFileName));
-	if (remove(tempFileName.mb_str()) != 0)
-		wxMessageBox(_T("Error deleting temporary file '") + tempFileName + _T("'."),
-		_T("Could Not Delete File"), wxICON_ERROR, mOwner);
+	assert(curves.size() == data.size());
+	for (i = 0; i < curves.size(); ++i)
+	{
+		// Skip curves which were removed by the user while loading
+		if (mLoadingCurves.find(curves[i]) == mLoadingCurves.end())
+			continue;
 
-	if (fileLoaded && mOwner)
-		mOwner->SetTitle(_T("Clipboard Data - ") + mApplicationTitle);
+		std::vector<double>& x(curves[i]->GetX());
+		std::vector<double>& y(curves[i]->GetY());
+		x.insert(x.end(), data[i]->GetX().begin(), data[i]->GetX().end());
+		y.insert(y.end(), data[i]->GetY().begin(), data[i]->GetY().end());
+	}
 
-	return fileLoaded;
+	mRenderer->UpdateDisplay();
 }
 
 //=============================================================================
 // Class:			GuiInterface
-// Function:		ReloadData
+// Function:		PrepareForLoadedCurves
 //
-// Description:		Reloads the data from the last set of files loaded.
+// Description:		Removes existing curves (if requested by the user) prior
+//					to adding the first curves from a load request.
 //
 // Input Arguments:
-//		None
+//		request	= LoadRequest&
+//		file	= const unsigned int& index of the file within the request
 //
 // Output Arguments:
 //		None
@@ -243,23 +529,29 @@ bool GuiInterface::LoadText(const wxString &textData)
 //		None
 //
 //=============================================================================
-void GuiInterface::ReloadData()
+void GuiInterface::PrepareForLoadedCurves(LoadRequest& request,
+	const unsigned int& file)
 {
-	if (mLastFilesLoaded.IsEmpty())
+	if (request.curvesCleared)
 		return;
 
-	LoadFiles(mLastFilesLoaded);
+	if (request.selections[file].removeExisting)
+		ClearAllCurves();
+	request.curvesCleared = true;
 }
 
 //=============================================================================
 // Class:			GuiInterface
-// Function:		GenerateTemporaryFileName
+// Function:		GetLoadedCurveName
 //
-// Description:		Generates a random string of characters to use as a file
-//					name (always ends with .tmp).
+// Description:		Builds the name for a curve from a load request.  When
+//					more than one source is loaded, the source name is
+//					appended to distinguish the curves.
 //
 // Input Arguments:
-//		length	= const unsigned int&
+//		request	= const LoadRequest&
+//		file	= const unsigned int& index of the file within the request
+//		channel	= const unsigned int& index of the selected channel
 //
 // Output Arguments:
 //		None
@@ -268,33 +560,84 @@ void GuiInterface::ReloadData()
 //		wxString
 //
 //=============================================================================
-wxString GuiInterface::GenerateTemporaryFileName(const unsigned int &length) const
+wxString GuiInterface::GetLoadedCurveName(const LoadRequest& request,
+	const unsigned int& file, const unsigned int& channel)
 {
-	wxString name;
-	unsigned int i;
-	for (i = 0; i < length; ++i)
-		name.Append((char)((rand() % 52) + 65));
-
-	// Remove illegal characters
-#ifdef __WXMSW__
-	name.Replace(_T("?"), _T(""));
-	name.Replace(_T("\""), _T(""));
-	name.Replace(_T("\\"), _T(""));
-	name.Replace(_T("/"), _T(""));
-	name.Replace(_T(":"), _T(""));
-	name.Replace(_T("*"), _T(""));
-	name.Replace(_T("|"), _T(""));
-	name.Replace(_T("<"), _T(""));
-	name.Replace(_T(">"), _T(""));
-#else
-	name.Replace(_T("/"), _T(""));
-#endif
-
-	name.Append(_T(".tmp"));
+	const wxString name(request.files[file]->GetDescription(channel + 1));
+	if (request.files.size() > 1)
+		return name + _T(" : ") + request.sourceNames[file];
 
 	return name;
 }
 
+//=============================================================================
+// Class:			GuiInterface
+// Function:		LoadText
+//
+// Description:		Public method for loading a single object from text.
+//					The text is parsed directly from memory (no temporary
+//					file is written), using the first registered file type
+//					which recognizes its contents.
+//
+// Input Arguments:
+//		textData	= const wxString&
+//		onLoaded	= LoadCallback
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		true if loading was started, false otherwise
+//
+//=============================================================================
+bool GuiInterface::LoadText(const wxString &textData, LoadCallback onLoaded)
+{
+	const wxString sourceName(_T("Clipboard Data"));
+	std::vector<std::unique_ptr<DataFile>> files;
+	files.push_back(mFileTypeManager.GetDataFileFromBuffer(
+		textData.ToStdString(), sourceName));
+
+	return LoadDataFiles(files, wxArrayString(1, &sourceName),
+		[this, sourceName, onLoaded](const bool& loaded)
+	{
+		if (loaded)
+		{
+			if (mOwner)
+				mOwner->SetTitle(sourceName + _T(" - ") + mApplicationTitle);
+
+			// There is nothing on disk to reload
+			mLastFilesLoaded.Clear();
+		}
+
+		if (onLoaded)
+			onLoaded(loaded);
+	});
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		ReloadData
+//
+// Description:		Reloads the data from the last set of files loaded.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GuiInterface::ReloadData()
+{
+	if (mLastFilesLoaded.IsEmpty())
+		return;
+
+	LoadFiles(mLastFilesLoaded);
+}
+
 //=============================================================================
 // Class:			GuiInterface
 // Function:		ClearAllCurves
@@ -344,6 +687,9 @@ void GuiInterface::AddCurve(wxString mathString, wxString name,
 	if (mathString.IsEmpty())
 		return;
 
+	// Make sure lazily loaded data referenced by the expression is available
+	EnsureCurvesLoaded(GetReferencedCurves(mathString));
+
 	// Parse string and determine what the new dataset should look like
 	ExpressionTree expression(&mPlotList);
 	std::unique_ptr<Dataset2D> mathChannel(std::make_unique<Dataset2D>());
@@ -408,6 +754,72 @@ void GuiInterface::AddCurve(std::unique_ptr<Dataset2D> data, wxString name, cons
 	mRenderer->UpdateDisplay();
 }
 
+//=============================================================================
+// Class:			GuiInterface
+// Function:		AddStream
+//
+// Description:		Adds an empty curve and returns a stream through which
+//					data may be appended to the curve from another thread.
+//
+// Input Arguments:
+//		name		= const wxString& specifying the label for the curve
+//		capacity	= const unsigned int& maximum number of buffered samples
+//		policy		= const DataStream::OverflowPolicy&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::shared_ptr<DataStream>
+//
+//=============================================================================
+std::shared_ptr<DataStream> GuiInterface::AddStream(const wxString& name,
+	const unsigned int& capacity, const DataStream::OverflowPolicy& policy)
+{
+	StreamCurve streamCurve;
+	streamCurve.stream = std::make_shared<DataStream>(capacity, policy);
+
+	std::unique_ptr<Dataset2D> data(std::make_unique<Dataset2D>());
+	streamCurve.data = data.get();
+	mStreams.push_back(streamCurve);
+	AddCurve(std::move(data), name);
+
+	if (!mStreamTimer.IsRunning())
+		mStreamTimer.Start(mStreamDrainInterval);
+
+	return streamCurve.stream;
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		DrainStreams
+//
+// Description:		Appends the data from each stream to the associated curve
+//					and updates the display if anything was added.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GuiInterface::DrainStreams()
+{
+	bool dataAdded(false);
+	for (auto& stream : mStreams)
+	{
+		if (stream.stream->Drain(*stream.data) > 0)
+			dataAdded = true;
+	}
+
+	if (dataAdded)
+		mRenderer->UpdateDisplay();
+}
+
 //=============================================================================
 // Class:			GuiInterface
 // Function:		HideAllCurves
@@ -464,6 +876,22 @@ void GuiInterface::RemoveCurve(const unsigned int &i)
 	}
 
 	mRenderer->RemoveCurve(i);
+	mChannelCache.Remove(mPlotList[i].get());
+	mLoadingCurves.erase(mPlotList[i].get());
+
+	auto stream(std::find_if(mStreams.begin(), mStreams.end(),
+		[this, &i](const StreamCurve& s)
+	{
+		return s.data == mPlotList[i].get();
+	}));
+	if (stream != mStreams.end())
+	{
+		stream->stream->Close();
+		mStreams.erase(stream);
+		if (mStreams.empty())
+			mStreamTimer.Stop();
+	}
+
 	mPlotList.Remove(i);
 
 	UpdateCurveQuality();
@@ -706,6 +1134,10 @@ void GuiInterface::ExportData()
 		return;
 	}
 
+	std::vector<unsigned int> allCurves(mPlotList.GetCount());
+	std::iota(allCurves.begin(), allCurves.end(), 0);
+	EnsureCurvesLoaded(allCurves);
+
 	unsigned int i, j(0);
 	wxString temp;
 	for (i = 1; i < mPlotList.GetCount() + 1; ++i)
@@ -808,24 +1240,50 @@ void GuiInterface::GenerateFRF()
 	if (dialog.ShowModal() != wxID_OK)
 		return;
 
-	std::unique_ptr<Dataset2D> amplitude(std::make_unique<Dataset2D>()), phase, coherence;
+	std::vector<unsigned int> inputOutput;
+	inputOutput.push_back(dialog.GetInputIndex());
+	inputOutput.push_back(dialog.GetOutputIndex());
+	EnsureCurvesLoaded(inputOutput);
+
+	// Shared pointers are used so that the results can be captured by the
+	// functions passed to the job queue
+	std::shared_ptr<Dataset2D> amplitude(std::make_shared<Dataset2D>()), phase, coherence;
 
 	if (dialog.GetComputePhase())
-		phase = std::make_unique<Dataset2D>();
+		phase = std::make_shared<Dataset2D>();
 	if (dialog.GetComputeCoherence())
-		coherence = std::make_unique<Dataset2D>();
+		coherence = std::make_shared<Dataset2D>();
 
 	if (!PlotMath::XDataConsistentlySpaced(*mPlotList[dialog.GetInputIndex()]) ||
 		!PlotMath::XDataConsistentlySpaced(*mPlotList[dialog.GetOutputIndex()]))
 		wxMessageBox(_T("Warning:  X-data is not consistently spaced.  Results may be unreliable."),
 			_T("Accuracy Warning"), wxICON_WARNING, mOwner);
 
-	FastFourierTransform::ComputeFRF(*mPlotList[dialog.GetInputIndex()],
-		*mPlotList[dialog.GetOutputIndex()], dialog.GetNumberOfAverages(),
-		FastFourierTransform::WindowType::Hann, dialog.GetModuloPhase(), *amplitude, phase.get(), coherence.get());
-
-	AddFFTCurves(factor, std::move(amplitude), std::move(phase), std::move(coherence), wxString::Format("[%u] to [%u]",
+	// Copy the inputs so the curves can be safely removed while the job runs
+	std::shared_ptr<const Dataset2D> input(
+		std::make_shared<Dataset2D>(*mPlotList[dialog.GetInputIndex()]));
+	std::shared_ptr<const Dataset2D> output(
+		std::make_shared<Dataset2D>(*mPlotList[dialog.GetOutputIndex()]));
+	const unsigned int averages(dialog.GetNumberOfAverages());
+	const bool moduloPhase(dialog.GetModuloPhase());
+	const wxString namePortion(wxString::Format("[%u] to [%u]",
 		dialog.GetInputIndex(), dialog.GetOutputIndex()));
+
+	StartJob(_T("Computing FRF ") + namePortion, [=](JobQueue::Context& context)
+	{
+		FastFourierTransform::ComputeFRF(*input, *output, averages,
+			FastFourierTransform::WindowType::Hann, moduloPhase, *amplitude,
+			phase.get(), coherence.get());
+
+		context.PostToMainThread([=]()
+		{
+			AddFFTCurves(factor,
+				std::make_unique<Dataset2D>(std::move(*amplitude)),
+				phase ? std::make_unique<Dataset2D>(std::move(*phase)) : nullptr,
+				coherence ? std::make_unique<Dataset2D>(std::move(*coherence)) : nullptr,
+				namePortion);
+		});
+	});
 }
 
 //=============================================================================
@@ -854,6 +1312,7 @@ void GuiInterface::CreateSignal()
 	if (mPlotList.GetCount() > 0)
 	{
 		GetXAxisScalingFactor(factor);
+		EnsureCurvesLoaded(std::vector<unsigned int>(1, 0));
 
 		// Use first curve to pull time and frequency information
 		sampleRate = 1.0 / PlotMath::GetAverageXSpacing(*mPlotList[0]) * factor;
@@ -1035,6 +1494,10 @@ void GuiInterface::ScaleXData(const wxArrayInt& selectedRows)
 	if (selectedRows.Count() == 1 && selectedRows[0] == 0)
 	{
 		unsigned int stopIndex(mPlotList.GetCount());
+		std::vector<unsigned int> allCurves(stopIndex);
+		std::iota(allCurves.begin(), allCurves.end(), 0);
+		EnsureCurvesLoaded(allCurves);
+
 		unsigned int i;
 		for (i = 0; i < stopIndex; ++i)
 		{
@@ -1062,6 +1525,8 @@ void GuiInterface::ScaleXData(const wxArrayInt& selectedRows)
 	// If applied to any other row, apply only to that row (by duplicating curve)
 	else
 	{
+		EnsureCurvesLoaded(selectedRows);
+
 		for (const auto& row : selectedRows)
 		{
 			std::unique_ptr<Dataset2D> scaledData(std::make_unique<Dataset2D>(*mPlotList[row - 1]));
@@ -1092,6 +1557,8 @@ void GuiInterface::ScaleXData(const wxArrayInt& selectedRows)
 void GuiInterface::PlotDerivative(const wxArrayInt& selectedRows)
 {
 	// Create new dataset containing the derivative of dataset and add it to the plot
+	EnsureCurvesLoaded(selectedRows);
+
 	for (const auto& row : selectedRows)
 	{
 		std::unique_ptr<Dataset2D> newData(std::make_unique<Dataset2D>(
@@ -1122,6 +1589,8 @@ void GuiInterface::PlotDerivative(const wxArrayInt& selectedRows)
 void GuiInterface::PlotIntegral(const wxArrayInt& selectedRows)
 {
 	// Create new dataset containing the integral of dataset and add it to the plot
+	EnsureCurvesLoaded(selectedRows);
+
 	for (const auto& row : selectedRows)
 	{
 		std::unique_ptr<Dataset2D> newData(std::make_unique<Dataset2D>(
@@ -1152,6 +1621,8 @@ void GuiInterface::PlotIntegral(const wxArrayInt& selectedRows)
 void GuiInterface::PlotRMS(const wxArrayInt& selectedRows)
 {
 	// Create new dataset containing the RMS of dataset and add it to the plot
+	EnsureCurvesLoaded(selectedRows);
+
 	for (const auto& row : selectedRows)
 	{
 		std::unique_ptr<Dataset2D> newData(std::make_unique<Dataset2D>(
@@ -1181,15 +1652,48 @@ void GuiInterface::PlotRMS(const wxArrayInt& selectedRows)
 //=============================================================================
 void GuiInterface::PlotFFT(const wxArrayInt& selectedRows)
 {
+	EnsureCurvesLoaded(selectedRows);
+
+	double factor;
+	if (!GetXAxisScalingFactor(factor))
+		// Warn the user if we cannot determine the time units, but create the plot anyway
+		wxMessageBox(_T("Warning:  Unable to identify X-axis units!  Frequency may be incorrectly scaled!"),
+			_T("Accuracy Warning"), wxICON_WARNING, mOwner);
+
 	for (const auto& row : selectedRows)
 	{
-		std::unique_ptr<Dataset2D> newData(GetFFTData(mPlotList[row - 1]));
-		if (!newData)
+		const std::unique_ptr<const Dataset2D>& data(mPlotList[row - 1]);
+		FFTDialog dialog(mOwner, data->GetNumberOfPoints(),
+			data->GetNumberOfZoomedPoints(mRenderer->GetXMin(), mRenderer->GetXMax()),
+			data->GetAverageDeltaX() / factor);
+
+		if (dialog.ShowModal() != wxID_OK)
 			continue;
 
-		wxString name(_T("FFT(") + mGrid->GetCellValue(row, static_cast<int>(PlotListGrid::Column::Name)) + _T(")"));
-		AddCurve(std::move(newData), name);
-		SetMarkerSize(mGrid->GetNumberRows() - 2, 0);
+		if (!PlotMath::XDataConsistentlySpaced(*data))
+			wxMessageBox(_T("Warning:  X-data is not consistently spaced.  Results may be unreliable."),
+				_T("Accuracy Warning"), wxICON_WARNING, mOwner);
+
+		// Copy the input so the curve can be safely removed while the job runs
+		std::shared_ptr<Dataset2D> input;
+		if (dialog.GetUseZoomedData())
+			input = GetXZoomedDataset(data);
+		else
+			input = std::make_shared<Dataset2D>(*data);
+
+		const FastFourierTransform::WindowType window(dialog.GetFFTWindow());
+		const unsigned int windowSize(dialog.GetWindowSize());
+		const double overlap(dialog.GetOverlap());
+		const bool subtractMean(dialog.GetSubtractMean());
+		const wxString name(_T("FFT(") + mGrid->GetCellValue(row, static_cast<int>(PlotListGrid::Column::Name)) + _T(")"));
+
+		StartJob(_T("Computing ") + name, [=](JobQueue::Context& context)
+		{
+			std::unique_ptr<Dataset2D> newData(FastFourierTransform::ComputeFFT(
+				std::move(*input), window, windowSize, overlap, subtractMean));
+			newData->MultiplyXData(factor);
+			PostCurve(context, std::move(newData), name, false);
+		});
 	}
 }
 
@@ -1223,6 +1727,8 @@ void GuiInterface::BitMask(const wxArrayInt& selectedRows)
 		return;
 	}
 
+	EnsureCurvesLoaded(selectedRows);
+
 	for (const auto& row : selectedRows)
 	{
 		std::unique_ptr<Dataset2D> newData(std::make_unique<Dataset2D>(
@@ -1263,6 +1769,8 @@ void GuiInterface::TimeShift(const wxArrayInt& selectedRows)
 		return;
 
 	// Create new dataset containing the RMS of dataset and add it to the plot
+	EnsureCurvesLoaded(selectedRows);
+
 	for (const auto& row : selectedRows)
 	{
 		std::unique_ptr<Dataset2D> newData(
@@ -1299,6 +1807,8 @@ void GuiInterface::UnwrapData(const wxArrayInt& selectedRows)
 		return;
 
 	const double rolloverPoint(dialog.GetRolloverPoint());
+	EnsureCurvesLoaded(selectedRows);
+
 	for (const auto& row : selectedRows)
 	{
 		std::unique_ptr<Dataset2D> newData(
@@ -1334,6 +1844,8 @@ void GuiInterface::WrapData(const wxArrayInt& selectedRows)
 		return;
 
 	const double rolloverPoint(dialog.GetRolloverPoint());
+	EnsureCurvesLoaded(selectedRows);
+
 	for (const auto& row : selectedRows)
 	{
 		std::unique_ptr<Dataset2D> newData(
@@ -1369,16 +1881,29 @@ void GuiInterface::FilterCurves(const wxArrayInt& selectedRows)
 	if (filterParameters.order == 0)
 		return;
 
-	// Create new dataset containing the FFT of dataset and add it to the plot
+	double factor;
+	if (!GetXAxisScalingFactor(factor))
+		wxMessageBox(_T("Warning:  Unable to identify X-axis units!  Cutoff frequency may be incorrect!"),
+			_T("Accuracy Warning"), wxICON_WARNING, mOwner);
+
+	// Create new dataset containing the filtered data and add it to the plot
+	EnsureCurvesLoaded(selectedRows);
+
 	for (const auto& row : selectedRows)
 	{
-		std::unique_ptr<Dataset2D> newData(std::make_unique<Dataset2D>(*mPlotList[row - 1]));
-
-		ApplyFilter(filterParameters, newData);
+		std::shared_ptr<Dataset2D> newData(std::make_shared<Dataset2D>(*mPlotList[row - 1]));
+		if (!PlotMath::XDataConsistentlySpaced(*newData))
+			wxMessageBox(_T("Warning:  X-data is not consistently spaced.  Results may be unreliable."),
+				_T("Accuracy Warning"), wxICON_WARNING, mOwner);
 
-		wxString name = FilterDialog::GetFilterNamePrefix(filterParameters)
+		const wxString name = FilterDialog::GetFilterNamePrefix(filterParameters)
 			+ _T(" (") + mGrid->GetCellValue(row, static_cast<int>(PlotListGrid::Column::Name)) + _T(")");
-		AddCurve(std::move(newData), name);
+
+		StartJob(_T("Filtering ") + name, [=](JobQueue::Context& context)
+		{
+			ApplyFilter(filterParameters, factor, *newData);
+			PostCurve(context, std::make_unique<Dataset2D>(std::move(*newData)), name);
+		});
 	}
 }
 
@@ -1417,13 +1942,19 @@ void GuiInterface::FitCurves(const wxArrayInt& selectedRows)
 		return;
 	}
 
+	EnsureCurvesLoaded(selectedRows);
+
 	for (const auto& row : selectedRows)
 	{
-		wxString name;
-		std::unique_ptr<Dataset2D> newData(GetCurveFitData(
-			order, mPlotList[row - 1], name, row));
-
-		AddCurve(std::move(newData), name);
+		std::shared_ptr<const Dataset2D> data(std::make_shared<Dataset2D>(*mPlotList[row - 1]));
+		StartJob(wxString::Format(_T("Fitting curve [%i]"), row),
+			[this, data, order, row](JobQueue::Context& context)
+		{
+			wxString name;
+			std::unique_ptr<Dataset2D> newData(GetCurveFitData(
+				order, *data, name, row));
+			PostCurve(context, std::move(newData), name);
+		});
 	}
 }
 
@@ -1436,7 +1967,7 @@ void GuiInterface::FitCurves(const wxArrayInt& selectedRows)
 //
 // Input Arguments:
 //		order	= const unsigned int&
-//		data	= const std::unique_ptr<const Dataset2D>&
+//		data	= const Dataset2D&
 //		row		= const unsigned int&
 //
 // Output Arguments:
@@ -1447,11 +1978,11 @@ void GuiInterface::FitCurves(const wxArrayInt& selectedRows)
 //
 //=============================================================================
 std::unique_ptr<Dataset2D> GuiInterface::GetCurveFitData(const unsigned int &order,
-	const std::unique_ptr<const Dataset2D>& data, wxString &name, const unsigned int& row) const
+	const Dataset2D& data, wxString &name, const unsigned int& row) const
 {
-	CurveFit::PolynomialFit fitData = CurveFit::DoPolynomialFit(*data, order);
+	CurveFit::PolynomialFit fitData = CurveFit::DoPolynomialFit(data, order);
 
-	std::unique_ptr<Dataset2D> newData(std::make_unique<Dataset2D>(*data));
+	std::unique_ptr<Dataset2D> newData(std::make_unique<Dataset2D>(data));
 	unsigned int i;
 	for (i = 0; i < newData->GetNumberOfPoints(); ++i)
 		newData->GetY()[i] = CurveFit::EvaluateFit(newData->GetX()[i], fitData);
@@ -1622,10 +2153,13 @@ FilterParameters GuiInterface::DisplayFilterDialog()
 // Function:		ApplyFilter
 //
 // Description:		Applies the specified filter to the specified dataset.
+//					Does not interact with the GUI, so this may be called
+//					from a worker thread.
 //
 // Input Arguments:
 //		parameters	= const FilterParameters&
-//		data		= const std::unique_ptr<Dataset2D>&
+//		xFactor		= const double& for converting x-data to seconds
+//		data		= Dataset2D&
 //
 // Output Arguments:
 //		None
@@ -1635,31 +2169,24 @@ FilterParameters GuiInterface::DisplayFilterDialog()
 //
 //=============================================================================
 void GuiInterface::ApplyFilter(const FilterParameters &parameters,
-	const std::unique_ptr<Dataset2D>& data)
+	const double& xFactor, Dataset2D& data) const
 {
-	double factor;
-	if (!GetXAxisScalingFactor(factor))
-		wxMessageBox(_T("Warning:  Unable to identify X-axis units!  Cutoff frequency may be incorrect!"),
-			_T("Accuracy Warning"), wxICON_WARNING, mOwner);
-
-	if (!PlotMath::XDataConsistentlySpaced(*data))
-		wxMessageBox(_T("Warning:  X-data is not consistently spaced.  Results may be unreliable."),
-			_T("Accuracy Warning"), wxICON_WARNING, mOwner);
+	LP2D_TRACE_SCOPE("signal", "GuiInterface::ApplyFilter");
 
 	std::unique_ptr<Filter> filter(GetFilter(
-		parameters, factor / data->GetAverageDeltaX(), data->GetY()[0]));
+		parameters, xFactor / data.GetAverageDeltaX(), data.GetY()[0]));
 
-	for (auto &y : data->GetY())
+	for (auto &y : data.GetY())
 		y = filter->Apply(y);
 
 	// For phaseless filter, re-apply the same filter backwards
 	if (parameters.phaseless)
 	{
-		data->Reverse();
-		filter->Initialize(data->GetY()[0]);
-		for (auto &y : data->GetY())
+		data.Reverse();
+		filter->Initialize(data.GetY()[0]);
+		for (auto &y : data.GetY())
 			y = filter->Apply(y);
-		data->Reverse();
+		data.Reverse();
 	}
 }
 
@@ -1765,8 +2292,9 @@ void GuiInterface::SetMarkerSize(const unsigned int &curve, const int &size)
 // Class:			GuiInterface
 // Function:		UpdateCurveQuality
 //
-// Description:		Sets curve quality according to how many lines need to
-//					be rendered.
+// Description:		Sets curve quality.  Curves are drawn at high quality,
+//					unless the plot cannot be re-drawn quickly enough during
+//					interactions.
 //
 // Input Arguments:
 //		None
@@ -1780,11 +2308,8 @@ void GuiInterface::SetMarkerSize(const unsigned int &curve, const int &size)
 //=============================================================================
 void GuiInterface::UpdateCurveQuality()
 {
-	//if (mRenderer->GetTotalPointCount() > highQualityCurvePointLimit)
-		mRenderer->SetCurveQuality(LibPlot2D::PlotRenderer::CurveQuality::HighWrite);
-	/*else
-		mRenderer->SetCurveQuality(static_cast<PlotRenderer::CurveQuality>(
-		PlotRenderer::CurveQuality::HighStatic | PlotRenderer::CurveQuality::HighWrite));*/// TODO:  Fix this after line rendering is improved
+	mRenderer->SetCurveQuality(PlotRenderer::CurveQuality::AlwaysHigh
+		| PlotRenderer::CurveQuality::Adaptive);
 }
 
 //=============================================================================
@@ -1832,57 +2357,6 @@ bool GuiInterface::UnitStringToFactor(const wxString &unit, double &factor)
 	return true;
 }
 
-//=============================================================================
-// Class:			GuiInterface
-// Function:		GetFFTData
-//
-// Description:		Returns a dataset containing an FFT of the specified data.
-//
-// Input Arguments:
-//		data	= const std::unique_ptr<const Dataset2D>&
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		std::unique_ptr<Dataset2D>
-//
-//=============================================================================
-std::unique_ptr<Dataset2D> GuiInterface::GetFFTData(
-	const std::unique_ptr<const Dataset2D>& data)
-{
-	double factor;
-	if (!GetXAxisScalingFactor(factor))
-		// Warn the user if we cannot determine the time units, but create the plot anyway
-		wxMessageBox(_T("Warning:  Unable to identify X-axis units!  Frequency may be incorrectly scaled!"),
-			_T("Accuracy Warning"), wxICON_WARNING, mOwner);
-
-	LibPlot2D::FFTDialog dialog(mOwner, data->GetNumberOfPoints(),
-		data->GetNumberOfZoomedPoints(mRenderer->GetXMin(), mRenderer->GetXMax()),
-		data->GetAverageDeltaX() / factor);
-
-	if (dialog.ShowModal() != wxID_OK)
-		return nullptr;
-
-	if (!LibPlot2D::PlotMath::XDataConsistentlySpaced(*data))
-		wxMessageBox(_T("Warning:  X-data is not consistently spaced.  Results may be unreliable."),
-			_T("Accuracy Warning"), wxICON_WARNING, mOwner);
-
-	std::unique_ptr<Dataset2D> newData(std::move(
-		FastFourierTransform::ComputeFFT([&dialog, &data, this]()
-	{
-		if (dialog.GetUseZoomedData())
-			return *GetXZoomedDataset(data);
-		else
-			return *data;
-	}(), dialog.GetFFTWindow(), dialog.GetWindowSize(), dialog.GetOverlap(),
-		dialog.GetSubtractMean())));
-
-	newData->MultiplyXData(factor);
-
-	return newData;
-}
-
 //=============================================================================
 // Class:			GuiInterface
 // Function:		GetXZoomedDataset
@@ -2233,6 +2707,9 @@ void GuiInterface::UpdateCurveProperties(const unsigned int &index,
 	if (!mGrid)// TODO:  Eliminate need for this check
 		return;
 
+	if (visible)
+		EnsureCurvesLoaded(std::vector<unsigned int>(1, index));
+
 	double lineSize;
 	long markerSize;
 	mGrid->GetCellValue(index + 1, static_cast<int>(PlotListGrid::Column::LineSize)).ToDouble(&lineSize);
@@ -2244,6 +2721,173 @@ void GuiInterface::UpdateCurveProperties(const unsigned int &index,
 	mRenderer->SaveCurrentZoom();
 }
 
+//=============================================================================
+// Class:			GuiInterface
+// Function:		StartJob
+//
+// Description:		Submits a job to the background queue and ensures that the
+//					queue is being monitored.
+//
+// Input Arguments:
+//		description	= const wxString&
+//		work		= JobQueue::Work
+//		onCancelled	= std::function<void()>
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GuiInterface::StartJob(const wxString& description, JobQueue::Work work,
+	std::function<void()> onCancelled)
+{
+	mJobQueue.Submit(description, std::move(work), std::move(onCancelled));
+
+	if (!mJobProgressDialog)
+		mJobProgressDialog = new JobProgressDialog(mOwner, mJobQueue);
+	mJobProgressDialog->Start();
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		PostCurve
+//
+// Description:		Posts the specified data to the main thread to be added as
+//					a new curve.  May be called from a worker thread.
+//
+// Input Arguments:
+//		context		= JobQueue::Context&
+//		data		= std::unique_ptr<Dataset2D>
+//		name		= const wxString&
+//		showMarkers	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GuiInterface::PostCurve(JobQueue::Context& context,
+	std::unique_ptr<Dataset2D> data, const wxString& name,
+	const bool& showMarkers)
+{
+	// std::function must be copyable, so we can't capture the std::unique_ptr
+	std::shared_ptr<Dataset2D> sharedData(std::move(data));
+	context.PostToMainThread([this, sharedData, name, showMarkers]()
+	{
+		AddCurve(std::make_unique<Dataset2D>(std::move(*sharedData)), name);
+		if (!showMarkers && mGrid)
+			SetMarkerSize(mPlotList.GetCount() - 1, 0);
+	});
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		EnsureCurvesLoaded
+//
+// Description:		Ensures that data for the specified curves (and for all
+//					visible curves) is available.  Only has an effect for
+//					curves which were loaded lazily.
+//
+// Input Arguments:
+//		curves	= const std::vector<unsigned int>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GuiInterface::EnsureCurvesLoaded(const std::vector<unsigned int>& curves)
+{
+	if (mChannelCache.IsEmpty())
+		return;
+
+	std::vector<const Dataset2D*> required;
+	unsigned int i;
+	for (i = 0; i < mPlotList.GetCount(); ++i)
+	{
+		if (std::find(curves.begin(), curves.end(), i) != curves.end() ||
+			(mGrid && CurveIsVisible(i)))
+			required.push_back(mPlotList[i].get());
+	}
+
+	wxBusyCursor busyCursor;
+	mChannelCache.Load(required);
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		EnsureCurvesLoaded
+//
+// Description:		Ensures that data for the curves in the specified grid
+//					rows is available.
+//
+// Input Arguments:
+//		selectedRows	= const wxArrayInt&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GuiInterface::EnsureCurvesLoaded(const wxArrayInt& selectedRows)
+{
+	std::vector<unsigned int> curves;
+	for (const auto& row : selectedRows)
+	{
+		if (row > 0)
+			curves.push_back(row - 1);
+	}
+
+	EnsureCurvesLoaded(curves);
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		GetReferencedCurves
+//
+// Description:		Returns the indices of the curves referenced by the
+//					specified math expression (i.e. [1] refers to curve 0).
+//					The time reference [0] uses the first curve.
+//
+// Input Arguments:
+//		mathString	= const wxString&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<unsigned int>
+//
+//=============================================================================
+std::vector<unsigned int> GuiInterface::GetReferencedCurves(
+	const wxString& mathString)
+{
+	std::vector<unsigned int> curves;
+	size_t start(mathString.find('['));
+	while (start != wxString::npos)
+	{
+		const size_t end(mathString.find(']', start));
+		if (end == wxString::npos)
+			break;
+
+		unsigned long index;
+		if (mathString.Mid(start + 1, end - start - 1).ToULong(&index))
+			curves.push_back(index > 0 ? index - 1 : 0);
+
+		start = mathString.find('[', end);
+	}
+
+	return curves;
+}
+
 //=============================================================================
 // Class:			GuiInterface
 // Function:		Copy
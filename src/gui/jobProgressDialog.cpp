@@ -0,0 +1,347 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  jobProgressDialog.cpp
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Non-modal dialog for displaying the progress of background jobs.
+
+// Local headers
+#include "lp2d/gui/jobProgressDialog.h"
+
+// wxWidgets headers
+#include <wx/wx.h>
+#include <wx/sizer.h>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			JobProgressDialog
+// Function:		Constant declarations
+//
+// Description:		Constant declarations for JobProgressDialog class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const int JobProgressDialog::mTimerInterval(100);// [msec]
+const unsigned int JobProgressDialog::mShowDelayTicks(5);
+const int JobProgressDialog::mGaugeRange(1000);
+
+//=============================================================================
+// Class:			JobProgressDialog
+// Function:		JobProgressDialog
+//
+// Description:		Constructor for JobProgressDialog class.
+//
+// Input Arguments:
+//		parent	= wxWindow* that owns this object
+//		jobs	= JobQueue&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+JobProgressDialog::JobProgressDialog(wxWindow* parent, JobQueue& jobs)
+	: wxDialog(parent, wxID_ANY, _T("Working"), wxDefaultPosition,
+	wxDefaultSize, wxCAPTION | wxCLOSE_BOX | wxRESIZE_BORDER), mJobs(jobs),
+	mTimer(this, idTimer)
+{
+	CreateControls();
+}
+
+//=============================================================================
+// Class:			JobProgressDialog
+// Function:		Event Table
+//
+// Description:		Event table for JobProgressDialog class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+BEGIN_EVENT_TABLE(JobProgressDialog, wxDialog)
+	EVT_TIMER(idTimer,			JobProgressDialog::OnTimer)
+	EVT_BUTTON(idCancelAll,		JobProgressDialog::OnCancelAllButton)
+	EVT_BUTTON(wxID_ANY,		JobProgressDialog::OnCancelButton)
+	EVT_CLOSE(JobProgressDialog::OnClose)
+END_EVENT_TABLE()
+
+//=============================================================================
+// Class:			JobProgressDialog
+// Function:		CreateControls
+//
+// Description:		Creates the dialog controls.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void JobProgressDialog::CreateControls()
+{
+	wxBoxSizer *topSizer = new wxBoxSizer(wxVERTICAL);
+	wxBoxSizer *mainSizer = new wxBoxSizer(wxVERTICAL);
+	topSizer->Add(mainSizer, 1, wxALL | wxEXPAND, 8);
+
+	wxFlexGridSizer* jobSizer = new wxFlexGridSizer(3, 5, 5);
+	jobSizer->AddGrowableCol(1);
+	mJobSizer = jobSizer;
+	mainSizer->Add(mJobSizer, 1, wxEXPAND);
+	mainSizer->AddSpacer(10);
+	mainSizer->Add(new wxButton(this, idCancelAll, _T("Cancel All")), 0,
+		wxALIGN_RIGHT);
+
+	SetSizerAndFit(topSizer);
+	Center();
+}
+
+//=============================================================================
+// Class:			JobProgressDialog
+// Function:		Start
+//
+// Description:		Begins monitoring the queue.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void JobProgressDialog::Start()
+{
+	if (!mTimer.IsRunning())
+	{
+		mActiveTicks = 0;
+		mTimer.Start(mTimerInterval);
+	}
+}
+
+//=============================================================================
+// Class:			JobProgressDialog
+// Function:		Stop
+//
+// Description:		Stops monitoring the queue and hides the dialog.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void JobProgressDialog::Stop()
+{
+	mTimer.Stop();
+	mHiddenByUser = false;
+	Hide();
+}
+
+//=============================================================================
+// Class:			JobProgressDialog
+// Function:		OnTimer
+//
+// Description:		Delivers results from the queue to the main thread and
+//					updates the progress display.
+//
+// Input Arguments:
+//		event	= wxTimerEvent&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void JobProgressDialog::OnTimer(wxTimerEvent& WXUNUSED(event))
+{
+	mJobs.ProcessPending();
+
+	if (mJobs.IsIdle())
+	{
+		Stop();
+		UpdateJobControls(std::vector<JobQueue::JobStatus>());
+		return;
+	}
+
+	UpdateJobControls(mJobs.GetStatus());
+	if (!IsShown() && !mHiddenByUser && ++mActiveTicks > mShowDelayTicks)
+		Show();
+}
+
+//=============================================================================
+// Class:			JobProgressDialog
+// Function:		UpdateJobControls
+//
+// Description:		Updates the controls to reflect the specified job status.
+//					Controls are only re-created when the set of jobs changes.
+//
+// Input Arguments:
+//		status	= const std::vector<JobQueue::JobStatus>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void JobProgressDialog::UpdateJobControls(
+	const std::vector<JobQueue::JobStatus>& status)
+{
+	bool jobsChanged(status.size() != mJobControls.size());
+	unsigned int i;
+	for (i = 0; i < status.size() && !jobsChanged; ++i)
+		jobsChanged = status[i].id != mJobControls[i].id;
+
+	if (jobsChanged)
+	{
+		mJobSizer->Clear(true);
+		mJobControls.clear();
+		for (const auto& job : status)
+		{
+			JobControls controls;
+			controls.id = job.id;
+			controls.description = new wxStaticText(this, wxID_ANY,
+				job.description);
+			controls.gauge = new wxGauge(this, wxID_ANY, mGaugeRange,
+				wxDefaultPosition, wxSize(200, -1));
+			controls.cancelButton = new wxButton(this, wxID_ANY, _T("Cancel"));
+
+			mJobSizer->Add(controls.description, 0, wxALIGN_CENTER_VERTICAL);
+			mJobSizer->Add(controls.gauge, 1, wxEXPAND | wxALIGN_CENTER_VERTICAL);
+			mJobSizer->Add(controls.cancelButton);
+			mJobControls.push_back(controls);
+		}
+
+		GetSizer()->Fit(this);
+	}
+
+	for (i = 0; i < status.size(); ++i)
+	{
+		if (status[i].running && status[i].progress == 0.0)
+			mJobControls[i].gauge->Pulse();
+		else
+			mJobControls[i].gauge->SetValue(
+				static_cast<int>(status[i].progress * mGaugeRange));
+	}
+}
+
+//=============================================================================
+// Class:			JobProgressDialog
+// Function:		OnCancelButton
+//
+// Description:		Cancels the job associated with the clicked button.
+//
+// Input Arguments:
+//		event	= wxCommandEvent&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void JobProgressDialog::OnCancelButton(wxCommandEvent& event)
+{
+	for (const auto& controls : mJobControls)
+	{
+		if (controls.cancelButton == event.GetEventObject())
+		{
+			mJobs.Cancel(controls.id);
+			controls.cancelButton->Enable(false);
+			return;
+		}
+	}
+}
+
+//=============================================================================
+// Class:			JobProgressDialog
+// Function:		OnCancelAllButton
+//
+// Description:		Cancels all jobs.
+//
+// Input Arguments:
+//		event	= wxCommandEvent&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void JobProgressDialog::OnCancelAllButton(wxCommandEvent& WXUNUSED(event))
+{
+	mJobs.CancelAll();
+	for (const auto& controls : mJobControls)
+		controls.cancelButton->Enable(false);
+}
+
+//=============================================================================
+// Class:			JobProgressDialog
+// Function:		OnClose
+//
+// Description:		Hides the dialog instead of destroying it.  Jobs continue
+//					to run in the background.
+//
+// Input Arguments:
+//		event	= wxCloseEvent&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void JobProgressDialog::OnClose(wxCloseEvent& event)
+{
+	if (!event.CanVeto())
+	{
+		event.Skip();
+		return;
+	}
+
+	event.Veto();
+	mHiddenByUser = true;
+	Hide();
+}
+
+}// namespace LibPlot2D
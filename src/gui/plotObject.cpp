@@ -1959,6 +1959,7 @@ void PlotObject::FormatCurves()
 	{
 		plot->SetModified();
 		plot->SetPretty(mPretty);
+		plot->SetDraft(mDraft);
 	}
 }
 
@@ -2158,7 +2159,7 @@ void PlotObject::UpdateScissorArea() const
 	int width, height;
 	mRenderer.GetSize(&width, &height);
 	glEnable(GL_SCISSOR_TEST);
-	glScissor(mAxisLeft->GetOffsetFromWindowEdge(),
+	mRenderer.SetScissorArea(mAxisLeft->GetOffsetFromWindowEdge(),
 		mAxisBottom->GetOffsetFromWindowEdge(),
 		width - mAxisRight->GetOffsetFromWindowEdge() - mAxisLeft->GetOffsetFromWindowEdge(),
 		height - mAxisTop->GetOffsetFromWindowEdge() - mAxisBottom->GetOffsetFromWindowEdge());
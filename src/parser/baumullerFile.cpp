@@ -44,9 +44,54 @@ bool BaumullerFile::IsType(const wxString &fileName)
 		return false;
 	}
 
+	return HasIdentifier(file);
+}
+
+//=============================================================================
+// Class:			BaumullerFile
+// Function:		IsBufferType
+//
+// Description:		Method for determining if the specified in-memory
+//					contents are this type of file.
+//
+// Input Arguments:
+//		buffer	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if this object can process the specified contents,
+//		false otherwise
+//
+//=============================================================================
+bool BaumullerFile::IsBufferType(const std::string &buffer)
+{
+	MemoryStream stream(buffer);
+	return HasIdentifier(stream);
+}
+
+//=============================================================================
+// Class:			BaumullerFile
+// Function:		HasIdentifier
+//
+// Description:		Checks the first line of the stream for the identifier
+//					written by WinBassII and ProDrive.
+//
+// Input Arguments:
+//		file	= std::istream&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the identifier is found, false otherwise
+//
+//=============================================================================
+bool BaumullerFile::HasIdentifier(std::istream &file)
+{
 	std::string nextLine;
 	std::getline(file, nextLine);// Read first line
-	file.close();
 
 	// Wrap in wxString for robustness against varying line endings
 	if (wxString(nextLine).Trim().Cmp(_T("WinBASS_II_Oscilloscope_Data")) == 0)
@@ -78,8 +123,8 @@ bool BaumullerFile::IsType(const wxString &fileName)
 wxArrayString BaumullerFile::GetCurveInformation(unsigned int &headerLineCount,
 	std::vector<double> &factors, wxArrayInt &/*nonNumericColumns*/) const
 {
-	std::ifstream file(mFileName.mb_str(), std::ios::in);
-	if (!file.is_open())
+	std::unique_ptr<std::istream> file(OpenStream());
+	if (!file->good())
 	{
 		wxMessageBox(_T("Could not open file '") + mFileName + _T("'!"),
 			_T("Error Reading File"), wxICON_ERROR);
@@ -88,11 +133,10 @@ wxArrayString BaumullerFile::GetCurveInformation(unsigned int &headerLineCount,
 
 	std::string nextLine;
 	wxArrayString previousLines, names;
-	while (std::getline(file, nextLine))
+	while (std::getline(*file, nextLine))
 	{
-		if (ConstructNames(nextLine, file, names, previousLines))
+		if (ConstructNames(nextLine, *file, names, previousLines))
 		{
-			file.close();
 			factors.resize(names.size(), 1.0);
 			names[0] = _T("Time [msec]");
 			headerLineCount = previousLines.size() + 5;// Extra two for min/max rows
@@ -100,7 +144,6 @@ wxArrayString BaumullerFile::GetCurveInformation(unsigned int &headerLineCount,
 		}
 	}
 
-	file.close();
 
 	names.Empty();
 	return names;
@@ -124,7 +167,7 @@ wxArrayString BaumullerFile::GetCurveInformation(unsigned int &headerLineCount,
 //		wxArrayString containing the descriptions
 //
 //=============================================================================
-bool BaumullerFile::ConstructNames(std::string &nextLine, std::ifstream &file,
+bool BaumullerFile::ConstructNames(std::string &nextLine, std::istream &file,
 	wxArrayString &names, wxArrayString &previousLines) const
 {
 	wxArrayString delimitedLine = ParseLineIntoColumns(nextLine, mDelimiter);
@@ -0,0 +1,311 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  channelCache.cpp
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Manages lazily loaded data channels, extracting data on demand and
+//        releasing the least recently used data to stay within a memory
+//        budget.
+
+// Local headers
+#include "lp2d/parser/channelCache.h"
+#include "lp2d/parser/dataFile.h"
+#include "lp2d/utilities/dataset2D.h"
+
+// wxWidgets headers
+#include <wx/wx.h>
+
+// Standard C++ headers
+#include <algorithm>
+#include <cassert>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			ChannelCache
+// Function:		AddSource
+//
+// Description:		Adds the specified file and its channels to the cache.
+//
+// Input Arguments:
+//		file		= std::unique_ptr<DataFile>
+//		channels	= const std::vector<Dataset2D*>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void ChannelCache::AddSource(std::unique_ptr<DataFile> file,
+	const std::vector<Dataset2D*>& channels)
+{
+	assert(file);
+	std::shared_ptr<DataFile> sharedFile(std::move(file));
+
+	unsigned int i;
+	for (i = 0; i < channels.size(); ++i)
+	{
+		Channel channel;
+		channel.file = sharedFile;
+		channel.index = i;
+		channel.dataset = channels[i];
+		mChannels[channels[i]] = channel;
+	}
+}
+
+//=============================================================================
+// Class:			ChannelCache
+// Function:		Remove
+//
+// Description:		Removes the specified dataset from the cache.  The file is
+//					released along with the last of its channels.
+//
+// Input Arguments:
+//		dataset	= const Dataset2D*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void ChannelCache::Remove(const Dataset2D* dataset)
+{
+	mChannels.erase(dataset);
+}
+
+//=============================================================================
+// Class:			ChannelCache
+// Function:		Load
+//
+// Description:		Ensures that the specified datasets are populated.  If any
+//					data was extracted, unused data is then released until
+//					the memory budget is satisfied.
+//
+// Input Arguments:
+//		required	= const std::vector<const Dataset2D*>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if any dataset was populated
+//
+//=============================================================================
+bool ChannelCache::Load(const std::vector<const Dataset2D*>& required)
+{
+	std::vector<Channel*> toExtract;
+	for (const auto& dataset : required)
+	{
+		auto it(mChannels.find(dataset));
+		if (it == mChannels.end())
+			continue;
+
+		it->second.lastUsed = ++mUseCounter;
+		if (!it->second.loaded)
+			toExtract.push_back(&it->second);
+	}
+
+	// Only release data to make room for newly extracted data; this allows
+	// callers to operate on a set of curves without them being released
+	// part way through
+	if (!Extract(toExtract))
+		return false;
+
+	ReleaseUnused(required);
+	return true;
+}
+
+//=============================================================================
+// Class:			ChannelCache
+// Function:		Extract
+//
+// Description:		Populates the specified channels.  Channels from the same
+//					file are extracted together so that the file is only
+//					parsed once.
+//
+// Input Arguments:
+//		channels	= const std::vector<Channel*>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if any channel was populated
+//
+//=============================================================================
+bool ChannelCache::Extract(const std::vector<Channel*>& channels)
+{
+	std::map<DataFile*, std::vector<Channel*>> fileMap;
+	for (const auto& channel : channels)
+		fileMap[channel->file.get()].push_back(channel);
+
+	bool extracted(false);
+	for (const auto& file : fileMap)
+	{
+		std::vector<unsigned int> indices;
+		std::vector<Dataset2D*> targets;
+		for (const auto& channel : file.second)
+		{
+			indices.push_back(channel->index);
+			targets.push_back(channel->dataset);
+		}
+
+		wxString errorString;
+		if (!file.first->ExtractChannels(indices, targets, errorString))
+		{
+			for (auto& target : targets)
+				Release(*target);
+
+			wxMessageBox(_T("Error during data extraction:\n") + errorString,
+				_T("Error Reading File"), wxICON_ERROR);
+			continue;
+		}
+
+		for (auto& channel : file.second)
+			channel->loaded = true;
+		extracted = true;
+	}
+
+	return extracted;
+}
+
+//=============================================================================
+// Class:			ChannelCache
+// Function:		ReleaseUnused
+//
+// Description:		Releases data for the least recently used channels until
+//					the memory usage falls within the budget.  Channels which
+//					are required are never released.
+//
+// Input Arguments:
+//		required	= const std::vector<const Dataset2D*>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if any channel was released
+//
+//=============================================================================
+bool ChannelCache::ReleaseUnused(const std::vector<const Dataset2D*>& required)
+{
+	if (mMemoryBudget == 0)
+		return false;
+
+	unsigned long long usage(GetMemoryUsage());
+	if (usage <= mMemoryBudget)
+		return false;
+
+	std::vector<Channel*> candidates;
+	for (auto& channel : mChannels)
+	{
+		if (channel.second.loaded && std::find(required.begin(),
+			required.end(), channel.first) == required.end())
+			candidates.push_back(&channel.second);
+	}
+
+	std::sort(candidates.begin(), candidates.end(),
+		[](const Channel* a, const Channel* b)
+	{
+		return a->lastUsed < b->lastUsed;
+	});
+
+	bool released(false);
+	for (auto& channel : candidates)
+	{
+		if (usage <= mMemoryBudget)
+			break;
+
+		usage -= GetSize(*channel->dataset);
+		Release(*channel->dataset);
+		channel->loaded = false;
+		released = true;
+	}
+
+	return released;
+}
+
+//=============================================================================
+// Class:			ChannelCache
+// Function:		GetMemoryUsage
+//
+// Description:		Computes the memory used by populated datasets.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned long long [bytes]
+//
+//=============================================================================
+unsigned long long ChannelCache::GetMemoryUsage() const
+{
+	unsigned long long usage(0);
+	for (const auto& channel : mChannels)
+	{
+		if (channel.second.loaded)
+			usage += GetSize(*channel.second.dataset);
+	}
+
+	return usage;
+}
+
+//=============================================================================
+// Class:			ChannelCache
+// Function:		GetSize
+//
+// Description:		Returns the memory used by the specified dataset.
+//
+// Input Arguments:
+//		dataset	= const Dataset2D&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned long long [bytes]
+//
+//=============================================================================
+unsigned long long ChannelCache::GetSize(const Dataset2D& dataset)
+{
+	return (dataset.GetX().capacity() + dataset.GetY().capacity())
+		* sizeof(double);
+}
+
+//=============================================================================
+// Class:			ChannelCache
+// Function:		Release
+//
+// Description:		Frees the memory used by the specified dataset.
+//
+// Input Arguments:
+//		dataset	= Dataset2D&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void ChannelCache::Release(Dataset2D& dataset)
+{
+	std::vector<double>().swap(dataset.GetX());
+	std::vector<double>().swap(dataset.GetY());
+}
+
+}// namespace LibPlot2D
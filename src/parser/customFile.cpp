@@ -42,6 +42,54 @@ bool CustomFile::IsType(const wxString &fileName)
 	return format.IsCustomFormat() && !format.IsXML();
 }
 
+//=============================================================================
+// Class:			CustomFile
+// Function:		IsBufferType
+//
+// Description:		Method for determining if the specified in-memory contents
+//					are this type of file.
+//
+// Input Arguments:
+//		buffer	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if this object can process the specified contents,
+//		false otherwise
+//
+//=============================================================================
+bool CustomFile::IsBufferType(const std::string &buffer)
+{
+	CustomFileFormat format(wxEmptyString, buffer);
+	return format.IsCustomFormat() && !format.IsXML();
+}
+
+//=============================================================================
+// Class:			CustomFile
+// Function:		UseBuffer
+//
+// Description:		Causes this object's contents to be read from the
+//					specified buffer and identifies the format from the buffer
+//					(instead of from file).
+//
+// Input Arguments:
+//		buffer	= std::string
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void CustomFile::UseBuffer(std::string buffer)
+{
+	DataFile::UseBuffer(std::move(buffer));
+	mFileFormat = CustomFileFormat(mFileName, mBuffer);
+}
+
 //=============================================================================
 // Class:			CustomFile
 // Function:		CreateDelimiterList
@@ -105,7 +153,7 @@ unsigned int CustomFile::GetRawDataSize(const unsigned int &selectedCount) const
 //					and time-formatted data as special cases.
 //
 // Input Arguments:
-//		file		= std::ifstream& previously opened input stream to read from
+//		file		= std::istream& previously opened input stream to read from
 //		choices		= const wxArrayInt& indicating the user's choices
 //		factors		= std::vector<double>& containing the list of scaling factors
 //
@@ -117,7 +165,7 @@ unsigned int CustomFile::GetRawDataSize(const unsigned int &selectedCount) const
 //		bool, true for success, false otherwise
 //
 //=============================================================================
-bool CustomFile::ExtractData(std::ifstream &file, const wxArrayInt &choices,
+bool CustomFile::ExtractData(std::istream &file, const wxArrayInt &choices,
 	std::vector<std::vector<double>>& rawData, std::vector<double> &factors,
 	wxString &errorString) const
 {
@@ -199,7 +247,7 @@ wxArrayString CustomFile::GetCurveInformation(unsigned int &headerLineCount,
 //					special cases of asynchronous and time-formatted data.
 //
 // Input Arguments:
-//		file		= std::ifstream& previously opened input stream to read from
+//		file		= std::istream& previously opened input stream to read from
 //		choices		= const wxArrayInt& indicating the user's choices
 //		factors		= std::vector<double>& containing the list of scaling factors
 //
@@ -211,7 +259,7 @@ wxArrayString CustomFile::GetCurveInformation(unsigned int &headerLineCount,
 //		bool, true for success, false otherwise
 //
 //=============================================================================
-bool CustomFile::ExtractSpecialData(std::ifstream &file,
+bool CustomFile::ExtractSpecialData(std::istream &file,
 	const wxArrayInt &choices, std::vector<std::vector<double>>& rawData,
 	std::vector<double> &factors, wxString &errorString) const
 {
@@ -223,14 +271,16 @@ bool CustomFile::ExtractSpecialData(std::ifstream &file,
 
 	while (std::getline(file, nextLine))
 	{
-		++lineNumber;
+		if (++lineNumber % mProgressLineInterval == 0 && !UpdateProgress(file))
+			return false;
+
 		parsed = ParseLineIntoColumns(nextLine, mDelimiter);
 		if (parsed.size() < curveCount && parsed.size() > 0)
 		{
 			if (!file.eof() &&
 				(mFileFormat.GetEndIdentifier().IsEmpty() ||
 				parsed[0].Cmp(mFileFormat.GetEndIdentifier()) != 0))
-				wxMessageBox(_T("Terminating data extraction prior to reaching end-of-file."),
+				ShowMessage(_T("Terminating data extraction prior to reaching end-of-file."),
 					_T("Column Count Mismatch"), wxICON_WARNING);
 			return true;
 		}
@@ -17,9 +17,11 @@
 
 // wxWidgets headers
 #include <wx/xml/xml.h>
+#include <wx/mstream.h>
 
 // Local headers
 #include "lp2d/parser/customFileFormat.h"
+#include "lp2d/parser/dataFile.h"
 
 namespace LibPlot2D
 {
@@ -61,6 +63,53 @@ const unsigned long CustomFileFormat::mCustomFormatsVersion = 1;
 //
 //=============================================================================
 CustomFileFormat::CustomFileFormat(const wxString &mPathAndFileName) : mPathAndFileName(mPathAndFileName)
+{
+	ReadFormatDefinitions();
+}
+
+//=============================================================================
+// Class:			CustomFileFormat
+// Function:		CustomFileFormat
+//
+// Description:		Constructor for CustomFileFormat class, for data held in
+//					memory.
+//
+// Input Arguments:
+//		sourceName	= const wxString&
+//		buffer		= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+CustomFileFormat::CustomFileFormat(const wxString &sourceName,
+	const std::string &buffer) : mPathAndFileName(sourceName), mBuffer(&buffer)
+{
+	ReadFormatDefinitions();
+	mBuffer = nullptr;
+}
+
+//=============================================================================
+// Class:			CustomFileFormat
+// Function:		ReadFormatDefinitions
+//
+// Description:		Reads the custom format definitions file and searches for
+//					a format matching the data.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void CustomFileFormat::ReadFormatDefinitions()
 {
 	wxXmlDocument customFormatDefinitions;
 	if (!wxFileExists(mCustomFormatsXMLFileName) ||
@@ -129,7 +178,7 @@ bool CustomFileFormat::ReadFormatTag(wxXmlNode &formatNode)
 		return false;
 
 	mIsXML = formatNode.GetAttribute(_T("XML"), "FALSE").CmpNoCase("TRUE") == 0;
-	if (IsFormat(mPathAndFileName, id))
+	if (IsFormat(id))
 	{
 		mDelimiter = formatNode.GetAttribute(_T("DELIMITER"), wxEmptyString);
 		mEndIdentifier = formatNode.GetAttribute(_T("END_IDENTIFIER"), wxEmptyString);
@@ -288,11 +337,10 @@ bool CustomFileFormat::ReadAdditionalXMLProperties(wxXmlNode &formatNode)
 // Class:			CustomFileFormat
 // Function:		IsFormat
 //
-// Description:		Determines if the specified file matches the identifier.
+// Description:		Determines if the data matches the identifier.
 //
 // Input Arguments:
-//		pathAndFileName	= const wxString&
-//		id				= const Identifier&
+//		id	= const Identifier&
 //
 // Output Arguments:
 //		None
@@ -301,31 +349,28 @@ bool CustomFileFormat::ReadAdditionalXMLProperties(wxXmlNode &formatNode)
 //		bool, true for match, false otherwise
 //
 //=============================================================================
-bool CustomFileFormat::IsFormat(const wxString &pathAndFileName, const Identifier &id)
+bool CustomFileFormat::IsFormat(const Identifier &id)
 {
-	std::ifstream dataFile(pathAndFileName.mb_str(), std::ios::in);
-	if (!dataFile.is_open() || !dataFile.good())
-	{
-		dataFile.close();
+	std::unique_ptr<std::istream> dataFile(OpenStream());
+	if (!dataFile->good())
 		return false;
-	}
 
 	bool formatMatches(false);
 	wxXmlDocument document;
 	switch (id.location)
 	{
 	case Identifier::Location::BOF:
-		formatMatches = MatchNextLine(dataFile, id);
+		formatMatches = MatchNextLine(*dataFile, id);
 		break;
 
 	case Identifier::Location::BOL:
-		formatMatches = MatchSpecifiedLine(dataFile, id);
+		formatMatches = MatchSpecifiedLine(*dataFile, id);
 		break;
 
 	case Identifier::Location::ROOT:
 		formatMatches = mIsXML &&
-			MatchNextLine(dataFile, _T("<?xml")) &&
-			document.Load(mPathAndFileName) &&
+			MatchNextLine(*dataFile, _T("<?xml")) &&
+			LoadDocument(document) &&
 			document.GetRoot()->GetName().Cmp(id.textToMatch) == 0;
 		break;
 
@@ -335,10 +380,63 @@ bool CustomFileFormat::IsFormat(const wxString &pathAndFileName, const Identifie
 		return false;
 	}
 
-	dataFile.close();
 	return formatMatches;
 }
 
+//=============================================================================
+// Class:			CustomFileFormat
+// Function:		OpenStream
+//
+// Description:		Opens a stream for reading the data being identified,
+//					either from file or from the in-memory buffer.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::unique_ptr<std::istream>
+//
+//=============================================================================
+std::unique_ptr<std::istream> CustomFileFormat::OpenStream() const
+{
+	if (mBuffer)
+		return std::make_unique<DataFile::MemoryStream>(*mBuffer);
+
+	return std::make_unique<std::ifstream>(mPathAndFileName.mb_str(),
+		std::ios::in);
+}
+
+//=============================================================================
+// Class:			CustomFileFormat
+// Function:		LoadDocument
+//
+// Description:		Parses the data being identified as an XML document,
+//					either from file or from the in-memory buffer.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		document	= wxXmlDocument&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//=============================================================================
+bool CustomFileFormat::LoadDocument(wxXmlDocument &document) const
+{
+	if (mBuffer)
+	{
+		wxMemoryInputStream stream(mBuffer->data(), mBuffer->size());
+		return document.Load(stream);
+	}
+
+	return document.Load(mPathAndFileName);
+}
+
 //=============================================================================
 // Class:			CustomFileFormat
 // Function:		MatchNextLine
@@ -346,7 +444,7 @@ bool CustomFileFormat::IsFormat(const wxString &pathAndFileName, const Identifie
 // Description:		Determines if the next line matches the specified identifier.
 //
 // Input Arguments:
-//		inFile	= std::ifstream&
+//		inFile	= std::istream&
 //		id		= const Identifier&
 //
 // Output Arguments:
@@ -356,7 +454,7 @@ bool CustomFileFormat::IsFormat(const wxString &pathAndFileName, const Identifie
 //		bool, true for match, false otherwise
 //
 //=============================================================================
-bool CustomFileFormat::MatchNextLine(std::ifstream &inFile, const Identifier &id) const
+bool CustomFileFormat::MatchNextLine(std::istream &inFile, const Identifier &id) const
 {
 	return MatchNextLine(inFile, id.textToMatch, id.matchCase);
 }
@@ -368,7 +466,7 @@ bool CustomFileFormat::MatchNextLine(std::ifstream &inFile, const Identifier &id
 // Description:		Determines if the next line matches the specified text.
 //
 // Input Arguments:
-//		inFile		= std::ifstream&
+//		inFile		= std::istream&
 //		textTomatch	= const wxString&
 //		matchCase	= const bool&
 //
@@ -379,7 +477,7 @@ bool CustomFileFormat::MatchNextLine(std::ifstream &inFile, const Identifier &id
 //		bool, true for match, false otherwise
 //
 //=============================================================================
-bool CustomFileFormat::MatchNextLine(std::ifstream &inFile, const wxString &textToMatch, const bool &matchCase) const
+bool CustomFileFormat::MatchNextLine(std::istream &inFile, const wxString &textToMatch, const bool &matchCase) const
 {
 	std::string nextLine;
 	std::getline(inFile, nextLine);
@@ -588,7 +686,7 @@ bool CustomFileFormat::ProcessLocationID(const wxString &value, Identifier &id)
 // Description:		Attempts to match the file to the specified line text.
 //
 // Input Arguments:
-//		inFile	= std::ifstream&
+//		inFile	= std::istream&
 //		id		= const Identifier&
 //
 // Output Arguments:
@@ -598,7 +696,7 @@ bool CustomFileFormat::ProcessLocationID(const wxString &value, Identifier &id)
 //		bool true if the line matches, false otherwise
 //
 //=============================================================================
-bool CustomFileFormat::MatchSpecifiedLine(std::ifstream &inFile, const Identifier &id) const
+bool CustomFileFormat::MatchSpecifiedLine(std::istream &inFile, const Identifier &id) const
 {
 	if (id.bolNumber < 0)
 	{
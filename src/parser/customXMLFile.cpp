@@ -14,6 +14,9 @@
 // Local headers
 #include "lp2d/parser/customXMLFile.h"
 
+// wxWidgets headers
+#include <wx/mstream.h>
+
 namespace LibPlot2D
 {
 
@@ -40,6 +43,54 @@ bool CustomXMLFile::IsType(const wxString &fileName)
 	return format.IsCustomFormat() && format.IsXML();
 }
 
+//=============================================================================
+// Class:			CustomXMLFile
+// Function:		IsBufferType
+//
+// Description:		Method for determining if the specified in-memory contents
+//					are this type of file.
+//
+// Input Arguments:
+//		buffer	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if this object can process the specified contents,
+//		false otherwise
+//
+//=============================================================================
+bool CustomXMLFile::IsBufferType(const std::string &buffer)
+{
+	CustomFileFormat format(wxEmptyString, buffer);
+	return format.IsCustomFormat() && format.IsXML();
+}
+
+//=============================================================================
+// Class:			CustomXMLFile
+// Function:		UseBuffer
+//
+// Description:		Causes this object's contents to be read from the
+//					specified buffer and identifies the format from the buffer
+//					(instead of from file).
+//
+// Input Arguments:
+//		buffer	= std::string
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void CustomXMLFile::UseBuffer(std::string buffer)
+{
+	DataFile::UseBuffer(std::move(buffer));
+	mFileFormat = CustomFileFormat(mFileName, mBuffer);
+}
+
 //=============================================================================
 // Class:			CustomXMLFile
 // Function:		CreateDelimiterList
@@ -77,7 +128,7 @@ wxArrayString CustomXMLFile::CreateDelimiterList() const
 //					the data the user selected for display.
 //
 // Input Arguments:
-//		file	= std::ifstream& previously opened input stream to read from
+//		file	= std::istream& previously opened input stream to read from
 //		choices	= const wxArrayInt& indicating the user's choices
 //		factors	= std::vector<double>& containing the list of scaling factors
 //
@@ -89,14 +140,15 @@ wxArrayString CustomXMLFile::CreateDelimiterList() const
 //		bool, true for success, false otherwise
 //
 //=============================================================================
-bool CustomXMLFile::ExtractData(std::ifstream& WXUNUSED(file),
+bool CustomXMLFile::ExtractData(std::istream& WXUNUSED(file),
 	const wxArrayInt &choices, std::vector<std::vector<double>>& rawData,
 	std::vector<double> &factors, wxString &errorString) const
 {
 	if (!ExtractXData(rawData, factors, errorString))
 		return false;
 
-	wxXmlDocument document(mFileName);
+	wxXmlDocument document;
+	LoadDocument(document);
 	unsigned int channelCount(0), set(1);
 	wxXmlNode *node = FollowNodePath(document,
 		mFileFormat.GetXMLChannelParentNode());
@@ -151,7 +203,8 @@ bool CustomXMLFile::ExtractData(std::ifstream& WXUNUSED(file),
 bool CustomXMLFile::ExtractXData(std::vector<std::vector<double>>& rawData,
 	std::vector<double> &factors, wxString& errorString) const
 {
-	wxXmlDocument document(mFileName);
+	wxXmlDocument document;
+	LoadDocument(document);
 	wxXmlNode *node = FollowNodePath(document, mFileFormat.GetXMLXDataNode());
 	if (!node)
 	{
@@ -247,7 +300,8 @@ wxArrayString CustomXMLFile::GetCurveInformation(unsigned int &headerLineCount,
 	wxArrayString names;
 	headerLineCount = 0;// Unused for XML types
 
-	wxXmlDocument document(mFileName);
+	wxXmlDocument document;
+	LoadDocument(document);
 	wxXmlNode *channel, *channelParent = FollowNodePath(document,
 		mFileFormat.GetXMLChannelParentNode());
 	if (!channelParent)
@@ -281,6 +335,35 @@ wxArrayString CustomXMLFile::GetCurveInformation(unsigned int &headerLineCount,
 	return names;
 }
 
+//=============================================================================
+// Class:			CustomXMLFile
+// Function:		LoadDocument
+//
+// Description:		Parses this object's contents as an XML document, either
+//					from file or from the in-memory buffer.  Failures are
+//					detected when following paths within the document.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		document	= wxXmlDocument&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//=============================================================================
+bool CustomXMLFile::LoadDocument(wxXmlDocument &document) const
+{
+	if (mUseBuffer)
+	{
+		wxMemoryInputStream stream(mBuffer.data(), mBuffer.size());
+		return document.Load(stream);
+	}
+
+	return document.Load(mFileName);
+}
+
 //=============================================================================
 // Class:			CustomXMLFile
 // Function:		FollowNodePath
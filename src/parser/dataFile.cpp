@@ -13,16 +13,38 @@
 
 // Standard C++ headers
 #include <locale>
+#include <thread>
+#include <algorithm>
 
 // Local headers
 #include "lp2d/parser/dataFile.h"
 #include "lp2d/gui/multiChoiceDialog.h"
 #include "lp2d/gui/guiInterface.h"
 #include "lp2d/utilities/dataset2D.h"
+#include "lp2d/utilities/trace.h"
 
 namespace LibPlot2D
 {
 
+//=============================================================================
+// Class:			DataFile
+// Function:		Constant declarations
+//
+// Description:		Constant declarations for DataFile class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const unsigned int DataFile::mMinimumRowsPerThread(10000);
+const unsigned int DataFile::mProgressLineInterval(1000);
+
 //=============================================================================
 // Class:			DataFile
 // Function:		DataFile
@@ -43,6 +65,168 @@ DataFile::DataFile(const wxString& fileName) : mFileName(fileName)
 {
 }
 
+//=============================================================================
+// Class:			DataFile
+// Function:		OpenStream
+//
+// Description:		Opens a stream for reading this object's contents.  If
+//					this object was created from an in-memory buffer, the
+//					stream reads directly from the buffer, otherwise the file
+//					is opened.
+//
+// Input Arguments:
+//		mode	= const std::ios::openmode& (ignored for in-memory buffers)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::unique_ptr<std::istream>
+//
+//=============================================================================
+std::unique_ptr<std::istream> DataFile::OpenStream(
+	const std::ios::openmode& mode) const
+{
+	if (mUseBuffer)
+		return std::make_unique<MemoryStream>(mBuffer);
+
+	return std::make_unique<std::ifstream>(mFileName.mb_str(), mode);
+}
+
+//=============================================================================
+// Class:			DataFile
+// Function:		UseBuffer
+//
+// Description:		Causes this object's contents to be read from the
+//					specified buffer instead of from file.
+//
+// Input Arguments:
+//		buffer	= std::string
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void DataFile::UseBuffer(std::string buffer)
+{
+	mBuffer = std::move(buffer);
+	mUseBuffer = true;
+}
+
+//=============================================================================
+// Class:			DataFile::MemoryStream
+// Function:		MemoryStream
+//
+// Description:		Constructor for MemoryStream class.
+//
+// Input Arguments:
+//		buffer	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+DataFile::MemoryStream::MemoryStream(const std::string& buffer)
+	: std::istream(nullptr), mReadBuffer(buffer)
+{
+	rdbuf(&mReadBuffer);
+}
+
+//=============================================================================
+// Class:			DataFile::MemoryStream::ReadBuffer
+// Function:		ReadBuffer
+//
+// Description:		Constructor for ReadBuffer class.  Exposes the buffer's
+//					contents as the get area; the contents are never modified.
+//
+// Input Arguments:
+//		buffer	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+DataFile::MemoryStream::ReadBuffer::ReadBuffer(const std::string& buffer)
+{
+	char* begin(const_cast<char*>(buffer.data()));
+	setg(begin, begin, begin + buffer.size());
+}
+
+//=============================================================================
+// Class:			DataFile::MemoryStream::ReadBuffer
+// Function:		seekoff
+//
+// Description:		Repositions the get pointer relative to the specified
+//					location.
+//
+// Input Arguments:
+//		offset		= off_type
+//		direction	= std::ios::seekdir
+//		mode		= std::ios::openmode
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		pos_type indicating the new position, or -1 on failure
+//
+//=============================================================================
+DataFile::MemoryStream::ReadBuffer::pos_type
+	DataFile::MemoryStream::ReadBuffer::seekoff(off_type offset,
+	std::ios::seekdir direction, std::ios::openmode mode)
+{
+	if ((mode & std::ios::in) == 0)
+		return pos_type(off_type(-1));
+
+	off_type position;
+	if (direction == std::ios::beg)
+		position = offset;
+	else if (direction == std::ios::cur)
+		position = gptr() - eback() + offset;
+	else
+		position = egptr() - eback() + offset;
+
+	if (position < 0 || position > egptr() - eback())
+		return pos_type(off_type(-1));
+
+	setg(eback(), eback() + position, egptr());
+	return pos_type(position);
+}
+
+//=============================================================================
+// Class:			DataFile::MemoryStream::ReadBuffer
+// Function:		seekpos
+//
+// Description:		Repositions the get pointer to the specified absolute
+//					location.
+//
+// Input Arguments:
+//		position	= pos_type
+//		mode		= std::ios::openmode
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		pos_type indicating the new position, or -1 on failure
+//
+//=============================================================================
+DataFile::MemoryStream::ReadBuffer::pos_type
+	DataFile::MemoryStream::ReadBuffer::seekpos(pos_type position,
+	std::ios::openmode mode)
+{
+	return seekoff(off_type(position), std::ios::beg, mode);
+}
+
 //=============================================================================
 // Class:			DataFile
 // Function:		Initialize
@@ -61,6 +245,8 @@ DataFile::DataFile(const wxString& fileName) : mFileName(fileName)
 //=============================================================================
 void DataFile::Initialize()
 {
+	LP2D_TRACE_SCOPE("io", "DataFile::Initialize");
+
 	mDelimiter = DetermineBestDelimiter();
 	DoTypeSpecificLoadTasks();
 	mDescriptions = GetCurveInformation(mHeaderLines, mScales,
@@ -194,34 +380,476 @@ unsigned int DataFile::AdjustForSkippedColumns(const unsigned int &i) const
 //=============================================================================
 bool DataFile::Load(const SelectionData &selectionInfo)
 {
+	LP2D_TRACE_SCOPE("io", "DataFile::Load");
+
 	mSelectedDescriptions = RemoveUnwantedDescriptions(mDescriptions,
 		selectionInfo.selections);
 
-	std::ifstream file(mFileName.mb_str(), std::ios::in);
-	if (!file.is_open())
+	std::unique_ptr<std::istream> file(OpenStream());
+	if (!file->good())
 	{
-		wxMessageBox(_T("Could not open file '") + mFileName + _T("'!"),
+		ShowMessage(_T("Could not open file '") + mFileName + _T("'!"),
 			_T("Error Reading File"), wxICON_ERROR);
 		return false;
 	}
-	SkipLines(file, mHeaderLines);
+
+	if (mJobContext)
+	{
+		file->seekg(0, std::ios::end);
+		mStreamSize = file->tellg();
+		file->seekg(0, std::ios::beg);
+	}
+
+	SkipLines(*file, mHeaderLines);
 	DoTypeSpecificProcessTasks();
+	mNextPublishPosition = mPartialDataInterval;
 
 	std::vector<std::vector<double>> rawData(GetRawDataSize(
 		selectionInfo.selections.size()));
 	wxString errorString;
-	if (!ExtractData(file, selectionInfo.selections, rawData, mScales, errorString))
+	if (!ExtractData(*file, selectionInfo.selections, rawData, mScales, errorString))
 	{
-		wxMessageBox(_T("Error during data extraction:\n") + errorString,
+		if (!mJobContext || !mJobContext->IsCancelled())
+			ShowMessage(_T("Error during data extraction:\n") + errorString,
+				_T("Error Reading File"), wxICON_ERROR);
+		return false;
+	}
+
+	if (mPartialDataCallback)
+		Publish(rawData, mScales);
+	else
+		AssembleDatasets(rawData);
+
+	return true;
+}
+
+//=============================================================================
+// Class:			DataFile
+// Function:		LoadIndex
+//
+// Description:		Prepares for lazy loading by recording the location of
+//					each data row and creating an empty dataset for each
+//					selected channel.  The file is opened in binary mode so
+//					that the recorded offsets are exact on all platforms.
+//
+// Input Arguments:
+//		selectionInfo	= const SelectionData&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//=============================================================================
+bool DataFile::LoadIndex(const SelectionData &selectionInfo)
+{
+	LP2D_TRACE_SCOPE("io", "DataFile::LoadIndex");
+
+	assert(SupportsLazyLoad());
+
+	mSelectedDescriptions = RemoveUnwantedDescriptions(mDescriptions,
+		selectionInfo.selections);
+	mSelections = selectionInfo.selections;
+
+	std::unique_ptr<std::istream> file(OpenStream(
+		std::ios::in | std::ios::binary));
+	if (!file->good())
+	{
+		ShowMessage(_T("Could not open file '") + mFileName + _T("'!"),
 			_T("Error Reading File"), wxICON_ERROR);
 		return false;
 	}
 
-	AssembleDatasets(rawData);
+	if (mJobContext)
+	{
+		file->seekg(0, std::ios::end);
+		mStreamSize = file->tellg();
+		file->seekg(0, std::ios::beg);
+	}
+
+	SkipLines(*file, mHeaderLines);
+	DoTypeSpecificProcessTasks();
+
+	mRowOffsets.clear();
+	std::streamoff offset(file->tellg());
+	std::string nextLine;
+	while (std::getline(*file, nextLine))
+	{
+		// Same as ExtractData(), stop at the first blank line
+		if (wxString(nextLine).Trim().IsEmpty())
+			break;
+
+		mRowOffsets.push_back(offset);
+		offset += nextLine.length() + 1;
+
+		if (mRowOffsets.size() % mProgressLineInterval == 0 &&
+			!UpdateProgress(*file))
+			return false;
+	}
+
+	mData.clear();
+	for (unsigned int i = 0; i < mSelections.size(); ++i)
+		mData.push_back(std::make_unique<Dataset2D>());
+
+	return true;
+}
+
+//=============================================================================
+// Class:			DataFile
+// Function:		ExtractChannels
+//
+// Description:		Extracts the specified channels from a file previously
+//					indexed with LoadIndex().  The rows are split into blocks
+//					which are parsed concurrently, each with its own stream.
+//
+// Input Arguments:
+//		channels	= const std::vector<unsigned int>&
+//		targets		= const std::vector<Dataset2D*>&
+//
+// Output Arguments:
+//		errorString	= wxString&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//=============================================================================
+bool DataFile::ExtractChannels(const std::vector<unsigned int>& channels,
+	const std::vector<Dataset2D*>& targets, wxString& errorString) const
+{
+	assert(channels.size() == targets.size());
+	if (channels.empty())
+		return true;
+
+	std::vector<unsigned int> columns(channels.size());
+	unsigned int i;
+	for (i = 0; i < channels.size(); ++i)
+	{
+		assert(channels[i] < mSelections.size());
+		columns[i] = mSelections[channels[i]] + 1;// +1 for time column
+	}
+
+	const unsigned int rowCount(mRowOffsets.size());
+	for (auto& target : targets)
+		target->Resize(rowCount);
+
+	const unsigned int threadCount(std::max(1U,
+		std::min(std::thread::hardware_concurrency(),
+		rowCount / mMinimumRowsPerThread)));
+	std::vector<wxString> errors(threadCount);
+	std::atomic<unsigned int> validRows(rowCount);
+
+	std::vector<std::thread> threads;
+	for (i = 1; i < threadCount; ++i)
+		threads.push_back(std::thread(&DataFile::ExtractRows, this,
+			rowCount * i / threadCount, rowCount * (i + 1) / threadCount,
+			std::cref(columns), std::cref(targets), std::ref(validRows),
+			std::ref(errors[i])));
+	ExtractRows(0, rowCount / threadCount, columns, targets, validRows,
+		errors[0]);
+
+	for (auto& thread : threads)
+		thread.join();
+
+	for (const auto& error : errors)
+	{
+		if (!error.IsEmpty())
+		{
+			errorString = error;
+			return false;
+		}
+	}
+
+	for (i = 0; i < targets.size(); ++i)
+	{
+		targets[i]->Resize(validRows);
+		if (i > 0)
+			targets[i]->GetX() = targets[0]->GetX();
+		*targets[i] *= mScales[columns[i]];
+	}
 
 	return true;
 }
 
+//=============================================================================
+// Class:			DataFile
+// Function:		ExtractRows
+//
+// Description:		Worker method for ExtractChannels().  Parses the specified
+//					block of rows.  X-data is stored in the first target only.
+//					If a row contains too few columns, \p validRows is reduced
+//					so that data extraction ends prior to that row (same as
+//					ExtractData()).
+//
+// Input Arguments:
+//		start		= const unsigned int& first row to parse
+//		end			= const unsigned int& one past the last row to parse
+//		columns		= const std::vector<unsigned int>& file columns to extract
+//		targets		= const std::vector<Dataset2D*>&
+//
+// Output Arguments:
+//		validRows	= std::atomic<unsigned int>&
+//		errorString	= wxString&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void DataFile::ExtractRows(const unsigned int& start, const unsigned int& end,
+	const std::vector<unsigned int>& columns,
+	const std::vector<Dataset2D*>& targets,
+	std::atomic<unsigned int>& validRows, wxString& errorString) const
+{
+	auto truncateAt([&validRows](const unsigned int& row)
+	{
+		unsigned int current(validRows);
+		while (row < current && !validRows.compare_exchange_weak(current, row))
+		{
+		}
+	});
+
+	if (start >= end)
+		return;
+
+	std::unique_ptr<std::istream> file(OpenStream(
+		std::ios::in | std::ios::binary));
+	if (!file->good() || !file->seekg(mRowOffsets[start]))
+	{
+		errorString = _T("Could not open file '") + mFileName + _T("'.");
+		return;
+	}
+
+	const unsigned int maxColumn(*std::max_element(columns.begin(),
+		columns.end()));
+	std::string nextLine;
+	wxArrayString parsed;
+	double value;
+	unsigned int row, i;
+	for (row = start; row < end && row < validRows; ++row)
+	{
+		if (!std::getline(*file, nextLine))
+		{
+			truncateAt(row);
+			return;
+		}
+
+		parsed = ParseLineIntoColumns(nextLine, mDelimiter);
+		if (parsed.size() <= maxColumn)
+		{
+			truncateAt(row);
+			return;
+		}
+
+		if (!parsed[0].ToDouble(&value))
+		{
+			errorString.Printf("Failed to convert entry at row %i, column %i, to a number.",
+				mHeaderLines + row + 1, 1);
+			return;
+		}
+		targets[0]->GetX()[row] = value;
+
+		for (i = 0; i < columns.size(); ++i)
+		{
+			if (!parsed[columns[i]].ToDouble(&value))
+			{
+				errorString.Printf("Failed to convert entry at row %i, column %i, to a number.",
+					mHeaderLines + row + 1, columns[i] + 1);
+				return;
+			}
+			targets[i]->GetY()[row] = value;
+		}
+	}
+}
+
+//=============================================================================
+// Class:			DataFile
+// Function:		SetJobContext
+//
+// Description:		Associates this object with a background job.
+//
+// Input Arguments:
+//		context			= JobQueue::Context*
+//		progressStart	= const double&
+//		progressWeight	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void DataFile::SetJobContext(JobQueue::Context* context,
+	const double& progressStart, const double& progressWeight)
+{
+	mJobContext = context;
+	mProgressStart = progressStart;
+	mProgressWeight = progressWeight;
+}
+
+//=============================================================================
+// Class:			DataFile
+// Function:		SetPartialDataCallback
+//
+// Description:		Enables (or disables) progressive loading.
+//
+// Input Arguments:
+//		callback	= PartialDataCallback
+//		interval	= const std::streamoff& [bytes]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void DataFile::SetPartialDataCallback(PartialDataCallback callback,
+	const std::streamoff& interval)
+{
+	assert(!callback || SupportsProgressiveLoad());
+	mPartialDataCallback = std::move(callback);
+	mPartialDataInterval = interval;
+}
+
+//=============================================================================
+// Class:			DataFile
+// Function:		ShowMessage
+//
+// Description:		Displays a message to the user, either directly or via the
+//					associated job.
+//
+// Input Arguments:
+//		message	= const wxString&
+//		caption	= const wxString&
+//		style	= const long&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void DataFile::ShowMessage(const wxString& message, const wxString& caption,
+	const long& style) const
+{
+	if (mJobContext)
+		mJobContext->ShowMessage(message, caption, style);
+	else
+		wxMessageBox(message, caption, style);
+}
+
+//=============================================================================
+// Class:			DataFile
+// Function:		UpdateProgress
+//
+// Description:		Reports the position within the stream as the progress of
+//					the associated job.
+//
+// Input Arguments:
+//		file	= std::istream&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, false if the associated job was cancelled
+//
+//=============================================================================
+bool DataFile::UpdateProgress(std::istream& file) const
+{
+	if (!mJobContext)
+		return true;
+
+	const std::streamoff position(file.tellg());
+	if (mStreamSize > 0 && position >= 0)
+		mJobContext->SetProgress(mProgressStart + mProgressWeight
+			* static_cast<double>(position) / mStreamSize);
+
+	return !mJobContext->IsCancelled();
+}
+
+//=============================================================================
+// Class:			DataFile
+// Function:		PublishPartialData
+//
+// Description:		Passes the rows extracted so far to the partial data
+//					callback if enough of the stream has been parsed since
+//					the previous call.
+//
+// Input Arguments:
+//		file	= std::istream&
+//		rawData	= std::vector<std::vector<double>>&
+//		factors	= const std::vector<double>&
+//
+// Output Arguments:
+//		rawData	= std::vector<std::vector<double>>&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void DataFile::PublishPartialData(std::istream& file,
+	std::vector<std::vector<double>>& rawData,
+	const std::vector<double>& factors) const
+{
+	if (!mPartialDataCallback)
+		return;
+
+	const std::streamoff position(file.tellg());
+	if (position < mNextPublishPosition)
+		return;
+
+	mNextPublishPosition = position + mPartialDataInterval;
+	Publish(rawData, factors);
+}
+
+//=============================================================================
+// Class:			DataFile
+// Function:		Publish
+//
+// Description:		Builds datasets from the specified rows (in the same way
+//					as AssembleDatasets()), passes them to the partial data
+//					callback and removes the rows from rawData.  The capacity
+//					of rawData is retained for the following rows.
+//
+// Input Arguments:
+//		rawData	= std::vector<std::vector<double>>&
+//		factors	= const std::vector<double>&
+//
+// Output Arguments:
+//		rawData	= std::vector<std::vector<double>>&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void DataFile::Publish(std::vector<std::vector<double>>& rawData,
+	const std::vector<double>& factors) const
+{
+	if (rawData.empty() || rawData[0].empty())
+		return;
+
+	std::vector<std::unique_ptr<Dataset2D>> datasets;
+	unsigned int i;
+	for (i = 1; i < rawData.size(); ++i)
+	{
+		assert(rawData[i].size() == rawData[0].size());
+		std::unique_ptr<Dataset2D> dataset(
+			std::make_unique<Dataset2D>(rawData[0].size()));
+		std::copy(rawData[0].begin(), rawData[0].end(), dataset->GetX().begin());
+		std::copy(rawData[i].begin(), rawData[i].end(), dataset->GetY().begin());
+		*dataset *= factors[i];
+		datasets.push_back(std::move(dataset));
+	}
+
+	for (auto& column : rawData)
+		column.clear();
+
+	mPartialDataCallback(std::move(datasets));
+}
+
 //=============================================================================
 // Class:			DataFile
 // Function:		DetermineBestDelimiter
@@ -247,15 +875,15 @@ wxString DataFile::DetermineBestDelimiter() const
 
 	if (delimiterList.size() == 1)
 		return delimiterList[0];
-	std::ifstream file(mFileName.mb_str(), std::ios::in);
-	if (!file.is_open())
+	std::unique_ptr<std::istream> file(OpenStream());
+	if (!file->good())
 	{
 		wxMessageBox(_T("Could not open file '") + mFileName + _T("'!"),
 			_T("Error Reading File"), wxICON_ERROR);
 		return wxEmptyString;
 	}
 
-	while (std::getline(file, nextLine))
+	while (std::getline(*file, nextLine))
 	{
 		for (const auto& delimiter : delimiterList)// Try all delimiters until we find one that works
 		{
@@ -266,7 +894,6 @@ wxString DataFile::DetermineBestDelimiter() const
 				if (IsDataRow(delimitedLine)
 					&& columnCount == delimitedLine.size())// Number of number columns == number of text columns
 				{
-					file.close();
 					return delimiter;
 				}
 				else
@@ -275,7 +902,6 @@ wxString DataFile::DetermineBestDelimiter() const
 		}
 	}
 
-	file.close();
 	return wxEmptyString;
 }
 
@@ -338,8 +964,8 @@ wxArrayString DataFile::CreateDelimiterList() const
 wxArrayString DataFile::GetCurveInformation(unsigned int &headerLineCount,
 	std::vector<double> &factors, wxArrayInt &nonNumericColumns) const
 {
-	std::ifstream file(mFileName.mb_str(), std::ios::in);
-	if (!file.is_open())
+	std::unique_ptr<std::istream> file(OpenStream());
+	if (!file->good())
 	{
 		wxMessageBox(_T("Could not open file '") + mFileName + _T("'!"),
 			_T("Error Reading File"), wxICON_ERROR);
@@ -348,7 +974,7 @@ wxArrayString DataFile::GetCurveInformation(unsigned int &headerLineCount,
 
 	std::string nextLine;
 	wxArrayString delimitedLine, previousLines, names;
-	while (std::getline(file, nextLine))
+	while (std::getline(*file, nextLine))
 	{
 		delimitedLine = ParseLineIntoColumns(nextLine, mDelimiter);
 		if (delimitedLine.size() > 1)
@@ -360,7 +986,6 @@ wxArrayString DataFile::GetCurveInformation(unsigned int &headerLineCount,
 				if (names.size() == 0)
 					names = GenerateDummyNames(delimitedLine, nonNumericColumns);
 				factors.resize(names.size() + nonNumericColumns.size(), 1.0);
-				file.close();
 				return names;
 			}
 		}
@@ -368,7 +993,6 @@ wxArrayString DataFile::GetCurveInformation(unsigned int &headerLineCount,
 	}
 
 	names.Empty();
-	file.close();
 	return names;
 }
 
@@ -594,7 +1218,7 @@ unsigned int DataFile::GetRawDataSize(const unsigned int &selectedCount) const
 //					the data the user selected for display.
 //
 // Input Arguments:
-//		file		= std::ifstream& previously opened input stream to read from
+//		file		= std::istream& previously opened input stream to read from
 //		choices		= const wxArrayInt& indicating the user's choices
 //		factors		= std::vector<double>& containing the list of scaling factors
 //
@@ -606,7 +1230,7 @@ unsigned int DataFile::GetRawDataSize(const unsigned int &selectedCount) const
 //		bool, true for success, false otherwise
 //
 //=============================================================================
-bool DataFile::ExtractData(std::ifstream &file, const wxArrayInt &choices,
+bool DataFile::ExtractData(std::istream &file, const wxArrayInt &choices,
 	std::vector<std::vector<double>>& rawData, std::vector<double> &factors,
 	wxString &errorString) const
 {
@@ -618,13 +1242,20 @@ bool DataFile::ExtractData(std::ifstream &file, const wxArrayInt &choices,
 	std::vector<double> newFactors(choices.size() + 1, 1.0);
 	while (std::getline(file, nextLine))
 	{
-		++lineNumber;
+		if (++lineNumber % mProgressLineInterval == 0)
+		{
+			if (!UpdateProgress(file))
+				return false;
+			PublishPartialData(file, rawData, newFactors);
+		}
+
 		parsed = ParseLineIntoColumns(nextLine, mDelimiter);
 		if (parsed.size() < curveCount)
 		{
 			if (!file.eof())
-				wxMessageBox(_T("Terminating data extraction prior to reaching end-of-file."),
+				ShowMessage(_T("Terminating data extraction prior to reaching end-of-file."),
 					_T("Column Count Mismatch"), wxICON_WARNING);
+			factors = newFactors;
 			return true;
 		}
 
@@ -726,7 +1357,7 @@ void DataFile::AssembleDatasets(
 //					the file.
 //
 // Input Arguments:
-//		file	= std::ifstream&
+//		file	= std::istream&
 //		count	= const unsigned int&
 //
 // Output Arguments:
@@ -736,7 +1367,7 @@ void DataFile::AssembleDatasets(
 //		None
 //
 //=============================================================================
-void DataFile::SkipLines(std::ifstream &file, const unsigned int &count)
+void DataFile::SkipLines(std::istream &file, const unsigned int &count)
 {
 	std::string nextLine;
 	unsigned int i;
@@ -13,6 +13,10 @@
 
 // Local headers
 #include "lp2d/parser/fileTypeManager.h"
+#include "lp2d/utilities/trace.h"
+
+// Standard C++ headers
+#include <utility>
 
 namespace LibPlot2D
 {
@@ -38,7 +42,39 @@ namespace LibPlot2D
 void FileTypeManager::RegisterFileType(TypeCheckFunction typeFunction,
 	FileFactory fileFactory)
 {
-	mRegisteredTypes.push_back(std::make_pair(typeFunction, fileFactory));
+	RegisterFileType(typeFunction, fileFactory, nullptr, nullptr);
+}
+
+//=============================================================================
+// Class:			FileTypeManager
+// Function:		RegisterFileType
+//
+// Description:		Adds the specified file type to the list of registered
+//					formats, including support for in-memory contents.
+//
+// Input Arguments:
+//		typeFunction		= TypeCheckFunction
+//		fileFactory			= FileFactory
+//		bufferTypeFunction	= BufferTypeCheckFunction
+//		bufferFactory		= BufferFactory
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		void
+//
+//=============================================================================
+void FileTypeManager::RegisterFileType(TypeCheckFunction typeFunction,
+	FileFactory fileFactory, BufferTypeCheckFunction bufferTypeFunction,
+	BufferFactory bufferFactory)
+{
+	FileType type;
+	type.typeFunction = typeFunction;
+	type.fileFactory = fileFactory;
+	type.bufferTypeFunction = bufferTypeFunction;
+	type.bufferFactory = bufferFactory;
+	mRegisteredTypes.push_back(type);
 }
 
 //=============================================================================
@@ -61,10 +97,47 @@ void FileTypeManager::RegisterFileType(TypeCheckFunction typeFunction,
 //=============================================================================
 std::unique_ptr<DataFile> FileTypeManager::GetDataFile(const wxString &fileName)
 {
+	LP2D_TRACE_SCOPE("io", "FileTypeManager::GetDataFile");
+
+	for (const auto& type : mRegisteredTypes)
+	{
+		if (type.typeFunction(fileName))
+			return type.fileFactory(fileName);
+	}
+
+	return nullptr;
+}
+
+//=============================================================================
+// Class:			FileTypeManager
+// Function:		GetDataFileFromBuffer
+//
+// Description:		Determines the correct DataFile object to use for the
+//					specified in-memory contents, and returns a pointer to an
+//					instance of that object.  Types are checked in the same
+//					order as for files, skipping those which were registered
+//					without support for in-memory contents.
+//
+// Input Arguments:
+//		buffer		= std::string
+//		sourceName	= const wxString&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::unique_ptr<DataFile>
+//
+//=============================================================================
+std::unique_ptr<DataFile> FileTypeManager::GetDataFileFromBuffer(
+	std::string buffer, const wxString &sourceName)
+{
+	LP2D_TRACE_SCOPE("io", "FileTypeManager::GetDataFileFromBuffer");
+
 	for (const auto& type : mRegisteredTypes)
 	{
-		if (type.first(fileName))
-			return type.second(fileName);
+		if (type.bufferTypeFunction && type.bufferTypeFunction(buffer))
+			return type.bufferFactory(std::move(buffer), sourceName);
 	}
 
 	return nullptr;
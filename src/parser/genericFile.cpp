@@ -39,4 +39,27 @@ bool GenericFile::IsType(const wxString& WXUNUSED(fileName))
 	return true;
 }
 
+//=============================================================================
+// Class:			GenericFile
+// Function:		IsBufferType
+//
+// Description:		Method for determining if the specified in-memory contents
+//					are this type of file.
+//
+// Input Arguments:
+//		buffer	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if this object can process the specified contents,
+//		false otherwise
+//
+//=============================================================================
+bool GenericFile::IsBufferType(const std::string& WXUNUSED(buffer))
+{
+	return true;
+}
+
 }// namespace LibPlot2D
@@ -44,11 +44,56 @@ bool KollmorgenFile::IsType(const wxString &testFile)
 		return false;
 	}
 
+	return HasIdentifier(file);
+}
+
+//=============================================================================
+// Class:			KollmorgenFile
+// Function:		IsBufferType
+//
+// Description:		Method for determining if the specified in-memory
+//					contents are this type of file.
+//
+// Input Arguments:
+//		buffer	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if this object can process the specified contents,
+//		false otherwise
+//
+//=============================================================================
+bool KollmorgenFile::IsBufferType(const std::string &buffer)
+{
+	MemoryStream stream(buffer);
+	return HasIdentifier(stream);
+}
+
+//=============================================================================
+// Class:			KollmorgenFile
+// Function:		HasIdentifier
+//
+// Description:		Checks the second line of the stream for the identifier
+//					written by S600 series drive software.
+//
+// Input Arguments:
+//		file	= std::istream&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the identifier is found, false otherwise
+//
+//=============================================================================
+bool KollmorgenFile::HasIdentifier(std::istream &file)
+{
 	SkipLines(file, 1);
 
 	std::string nextLine;
 	std::getline(file, nextLine);// Read second line
-	file.close();
 
 	// Kollmorgen format from S600 series drives
 	// There may be a better way to check this, but I haven't found it
@@ -82,25 +127,24 @@ bool KollmorgenFile::IsType(const wxString &testFile)
 wxArrayString KollmorgenFile::GetCurveInformation(unsigned int& headerLineCount,
 	std::vector<double> &factors, wxArrayInt &/*nonNumericColumns*/) const
 {
-	std::ifstream file(mFileName.mb_str(), std::ios::in);
-	if (!file.is_open())
+	std::unique_ptr<std::istream> file(OpenStream());
+	if (!file->good())
 	{
 		wxMessageBox(_T("Could not open file '") + mFileName + _T("'!"),
 			_T("Error Reading File"), wxICON_ERROR);
 		return mDescriptions;
 	}
 
-	SkipLines(file, 3);
+	SkipLines(*file, 3);
 	headerLineCount = 4;
 
 	std::string nextLine;
-	std::getline(file, nextLine);// The fourth line contains the data set labels
+	std::getline(*file, nextLine);// The fourth line contains the data set labels
 	wxArrayString names = ParseLineIntoColumns(nextLine, mDelimiter);
 	names.Insert(_T("Time [sec]"), 0);
 
 	factors.resize(names.size(), 1.0);
 
-	file.close();
 	return names;
 }
 
@@ -122,8 +166,8 @@ wxArrayString KollmorgenFile::GetCurveInformation(unsigned int& headerLineCount,
 //=============================================================================
 void KollmorgenFile::DoTypeSpecificLoadTasks()
 {
-	std::ifstream file(mFileName.mb_str(), std::ios::in);
-	if (!file.is_open())
+	std::unique_ptr<std::istream> file(OpenStream());
+	if (!file->good())
 	{
 		wxMessageBox(_T("Could not determine sample rate!  Using 1 Hz."),
 			_T("Error Reading File"), wxICON_ERROR);
@@ -131,16 +175,15 @@ void KollmorgenFile::DoTypeSpecificLoadTasks()
 		return;
 	}
 
-	SkipLines(file, 2);
+	SkipLines(*file, 2);
 
 	std::string nextLine;
-	std::getline(file, nextLine);
+	std::getline(*file, nextLine);
 
 	// The third line contains the number of data points and the sampling period in msec
 	// We use this information to generate the time series (file does not contain a time series)
 	mTimeStep = atof(nextLine.substr(nextLine.find_first_of(mDelimiter) + 1).c_str()) / 1000.0;// [sec]
 
-	file.close();
 }
 
 //=============================================================================
@@ -152,7 +195,7 @@ void KollmorgenFile::DoTypeSpecificLoadTasks()
 //					series based on timeStep.
 //
 // Input Arguments:
-//		file	= std::ifstream& previously opened input stream to read from
+//		file	= std::istream& previously opened input stream to read from
 //		choices	= const wxArrayInt& indicating the user's choices
 //		factors	= std::vector<double>& containing the list of scaling factors
 //
@@ -164,7 +207,7 @@ void KollmorgenFile::DoTypeSpecificLoadTasks()
 //		bool, true for success, false otherwise
 //
 //=============================================================================
-bool KollmorgenFile::ExtractData(std::ifstream &file, const wxArrayInt &choices,
+bool KollmorgenFile::ExtractData(std::istream &file, const wxArrayInt &choices,
 	std::vector<std::vector<double>>& rawData, std::vector<double> &factors, wxString& errorString) const
 {
 	std::string nextLine;
@@ -175,14 +218,20 @@ bool KollmorgenFile::ExtractData(std::ifstream &file, const wxArrayInt &choices,
 
 	while (!file.eof())
 	{
-		++lineNumber;
+		if (++lineNumber % mProgressLineInterval == 0)
+		{
+			if (!UpdateProgress(file))
+				return false;
+			PublishPartialData(file, rawData, factors);
+		}
+
 		std::getline(file, nextLine);
 		parsed = ParseLineIntoColumns(nextLine, mDelimiter);
 		parsed.Insert(wxString::Format("%f", time), 0);
 		if (parsed.size() < curveCount)
 		{
 			if (!file.eof())
-				wxMessageBox(_T("Terminating data extraction prior to reaching end-of-file."),
+				ShowMessage(_T("Terminating data extraction prior to reaching end-of-file."),
 					_T("Column Count Mismatch"), wxICON_WARNING);
 			return true;
 		}
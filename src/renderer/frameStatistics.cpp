@@ -0,0 +1,286 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  frameStatistics.cpp
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Records where the time goes in each frame drawn by a RenderWindow.
+
+// Local headers
+#include "lp2d/renderer/frameStatistics.h"
+
+// Standard C++ headers
+#include <utility>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			FrameStatistics
+// Function:		Constant declarations
+//
+// Description:		Constant declarations for FrameStatistics class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const unsigned int FrameStatistics::mHistoryLength(300);// [frames]
+
+//=============================================================================
+// Class:			FrameStatistics
+// Function:		FrameStatistics
+//
+// Description:		Constructor for FrameStatistics class.  Time bins start at
+//					1/4 msec and size bins at 1 kB; both double from there.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+FrameStatistics::FrameStatistics()
+{
+	unsigned int i;
+	for (i = 0; i < static_cast<unsigned int>(Metric::Count); ++i)
+	{
+		if (static_cast<Metric>(i) == Metric::UploadBytes)
+			mHistograms.emplace_back(mHistoryLength, 1024.0, 16);
+		else
+			mHistograms.emplace_back(mHistoryLength, 0.25, 12);
+	}
+}
+
+//=============================================================================
+// Class:			FrameStatistics
+// Function:		SetEnabled
+//
+// Description:		Enables or disables recording.
+//
+// Input Arguments:
+//		enabled	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FrameStatistics::SetEnabled(const bool& enabled)
+{
+	if (enabled == mEnabled)
+		return;
+
+	mEnabled = enabled;
+	mFrameActive = false;
+	mFrameCount = 0;
+	mPendingPlotUpdateTime = 0.0;
+	mLastFrame = Frame();
+
+	for (auto& histogram : mHistograms)
+		histogram.Clear();
+}
+
+//=============================================================================
+// Class:			FrameStatistics
+// Function:		BeginFrame
+//
+// Description:		Starts collecting measurements for a new frame.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FrameStatistics::BeginFrame()
+{
+	if (!mEnabled)
+		return;
+
+	// Keep the capacity of the primitive list from frame to frame
+	std::vector<PrimitiveTiming> primitives(
+		std::move(mCurrentFrame.primitives));
+	primitives.clear();
+	mCurrentFrame = Frame();
+	mCurrentFrame.primitives = std::move(primitives);
+
+	mCurrentFrame.plotUpdateTime = mPendingPlotUpdateTime;
+	mPendingPlotUpdateTime = 0.0;
+
+	mFrameActive = true;
+	mFrameStart = Clock::now();
+}
+
+//=============================================================================
+// Class:			FrameStatistics
+// Function:		EndFrame
+//
+// Description:		Completes the current frame and adds it to the histograms.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FrameStatistics::EndFrame()
+{
+	if (!IsRecording())
+		return;
+
+	mFrameActive = false;
+	mCurrentFrame.frameTime = mCurrentFrame.plotUpdateTime
+		+ ToMilliseconds(Clock::now() - mFrameStart);
+
+	auto addSample([this](const Metric& metric, const double& value)
+	{
+		mHistograms[static_cast<unsigned int>(metric)].Add(value);
+	});
+
+	addSample(Metric::FrameTime, mCurrentFrame.frameTime);
+	addSample(Metric::PlotUpdateTime, mCurrentFrame.plotUpdateTime);
+	addSample(Metric::PrepareTime, mCurrentFrame.prepareTime);
+	addSample(Metric::UpdateTime, mCurrentFrame.updateTime);
+	addSample(Metric::DrawTime, mCurrentFrame.drawTime);
+	addSample(Metric::UploadBytes,
+		static_cast<double>(mCurrentFrame.uploadBytes));
+
+	std::swap(mCurrentFrame, mLastFrame);
+	++mFrameCount;
+}
+
+//=============================================================================
+// Class:			FrameStatistics
+// Function:		RecordPlotUpdate
+//
+// Description:		Records time spent laying out the plot.
+//
+// Input Arguments:
+//		duration	= const Clock::duration&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FrameStatistics::RecordPlotUpdate(const Clock::duration& duration)
+{
+	if (!mEnabled)
+		return;
+
+	if (mFrameActive)
+		mCurrentFrame.plotUpdateTime += ToMilliseconds(duration);
+	else
+		mPendingPlotUpdateTime += ToMilliseconds(duration);
+}
+
+//=============================================================================
+// Class:			FrameStatistics
+// Function:		RecordPrepare
+//
+// Description:		Records time spent building geometry prior to drawing.
+//
+// Input Arguments:
+//		duration	= const Clock::duration&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FrameStatistics::RecordPrepare(const Clock::duration& duration)
+{
+	if (IsRecording())
+		mCurrentFrame.prepareTime += ToMilliseconds(duration);
+}
+
+//=============================================================================
+// Class:			FrameStatistics
+// Function:		RecordPrimitive
+//
+// Description:		Records the measurements for a primitive which was drawn.
+//
+// Input Arguments:
+//		primitive		= const Primitive&
+//		updateDuration	= const Clock::duration&
+//		drawDuration	= const Clock::duration&
+//		vertexCount		= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FrameStatistics::RecordPrimitive(const Primitive& primitive,
+	const Clock::duration& updateDuration, const Clock::duration& drawDuration,
+	const unsigned int& vertexCount)
+{
+	if (!IsRecording())
+		return;
+
+	PrimitiveTiming timing;
+	timing.primitive = &primitive;
+	timing.updateTime = ToMilliseconds(updateDuration);
+	timing.drawTime = ToMilliseconds(drawDuration);
+	timing.vertexCount = vertexCount;
+	mCurrentFrame.primitives.push_back(timing);
+
+	mCurrentFrame.updateTime += timing.updateTime;
+	mCurrentFrame.drawTime += timing.drawTime;
+	mCurrentFrame.vertexCount += vertexCount;
+}
+
+//=============================================================================
+// Class:			FrameStatistics
+// Function:		ToMilliseconds
+//
+// Description:		Converts the specified duration to milliseconds.
+//
+// Input Arguments:
+//		duration	= const Clock::duration&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//=============================================================================
+double FrameStatistics::ToMilliseconds(const Clock::duration& duration)
+{
+	return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+}// namespace LibPlot2D
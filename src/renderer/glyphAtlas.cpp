@@ -0,0 +1,420 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  glyphAtlas.cpp
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Process-wide cache of rasterized glyphs for a single font and size,
+//        packed into one image for use as a texture.
+
+// Local headers
+#include "lp2d/renderer/glyphAtlas.h"
+
+// Standard C++ headers
+#include <cassert>
+#include <algorithm>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			GlyphAtlas
+// Function:		Constant declarations
+//
+// Description:		Constant declarations for GlyphAtlas class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+std::map<GlyphAtlas::Key, std::weak_ptr<GlyphAtlas>> GlyphAtlas::mAtlases;
+std::map<std::string, bool> GlyphAtlas::mValidFontFiles;
+std::mutex GlyphAtlas::mAtlasMutex;
+unsigned int GlyphAtlas::mNextId(0);
+
+FT_Library GlyphAtlas::mFt;
+unsigned int GlyphAtlas::mFtReferenceCount(0);
+
+// Empty space around each glyph prevents neighbors from bleeding into each
+// other when the texture is sampled with linear filtering
+const unsigned int GlyphAtlas::mPadding(1);// [pixels]
+
+//=============================================================================
+// Class:			GlyphAtlas
+// Function:		GlyphAtlas
+//
+// Description:		Constructor for GlyphAtlas class.  Sizes the image to fit
+//					at least one row of glyphs; it grows as glyphs are added.
+//
+// Input Arguments:
+//		face	= FT_Face (ownership is transferred to this)
+//		id		= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+GlyphAtlas::GlyphAtlas(FT_Face face, const unsigned int& id) : mFace(face),
+	mId(id)
+{
+	const unsigned int cellHeight(
+		static_cast<unsigned int>((mFace->size->metrics.height + 63) >> 6)
+		+ mPadding);
+	mWidth = std::max(256U, NextPowerOfTwo(16 * cellHeight));
+	mHeight = NextPowerOfTwo(cellHeight + mPadding);
+	mPixels.assign(mWidth * mHeight, 0);
+
+	mPenX = mPadding;
+	mPenY = mPadding;
+}
+
+//=============================================================================
+// Class:			GlyphAtlas
+// Function:		~GlyphAtlas
+//
+// Description:		Destructor for GlyphAtlas class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+GlyphAtlas::~GlyphAtlas()
+{
+	std::lock_guard<std::mutex> lock(mAtlasMutex);
+
+	// A new atlas may already have replaced this one in the list
+	auto it(mAtlases.begin());
+	while (it != mAtlases.end())
+	{
+		if (it->second.expired())
+			it = mAtlases.erase(it);
+		else
+			++it;
+	}
+
+	FT_Done_Face(mFace);
+	ReleaseFreeType();
+}
+
+//=============================================================================
+// Class:			GlyphAtlas
+// Function:		Get
+//
+// Description:		Returns the atlas for the specified font and size,
+//					creating it if necessary.
+//
+// Input Arguments:
+//		fontFileName	= const std::string&
+//		width			= const unsigned int&
+//		height			= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::shared_ptr<GlyphAtlas>, nullptr if the font cannot be loaded
+//
+//=============================================================================
+std::shared_ptr<GlyphAtlas> GlyphAtlas::Get(const std::string& fontFileName,
+	const unsigned int& width, const unsigned int& height)
+{
+	std::lock_guard<std::mutex> lock(mAtlasMutex);
+
+	const Key key(fontFileName, width, height);
+	const auto it(mAtlases.find(key));
+	if (it != mAtlases.end())
+	{
+		auto atlas(it->second.lock());
+		if (atlas)
+			return atlas;
+	}
+
+	if (!AcquireFreeType())
+		return nullptr;
+
+	FT_Face face;
+	if (FT_New_Face(mFt, fontFileName.c_str(), 0, &face))
+	{
+		mValidFontFiles[fontFileName] = false;
+		ReleaseFreeType();
+		return nullptr;
+	}
+
+	if (FT_Select_Charmap(face, FT_ENCODING_UNICODE) ||
+		FT_Set_Pixel_Sizes(face, width, height))
+	{
+		FT_Done_Face(face);
+		ReleaseFreeType();
+		return nullptr;
+	}
+
+	std::shared_ptr<GlyphAtlas> atlas(new GlyphAtlas(face, mNextId++));
+	mAtlases[key] = atlas;
+	return atlas;
+}
+
+//=============================================================================
+// Class:			GlyphAtlas
+// Function:		FontFileIsValid
+//
+// Description:		Checks to see if the specified font file can be loaded.
+//
+// Input Arguments:
+//		fontFileName	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the font can be loaded
+//
+//=============================================================================
+bool GlyphAtlas::FontFileIsValid(const std::string& fontFileName)
+{
+	std::lock_guard<std::mutex> lock(mAtlasMutex);
+
+	const auto it(mValidFontFiles.find(fontFileName));
+	if (it != mValidFontFiles.end())
+		return it->second;
+
+	if (!AcquireFreeType())
+		return false;
+
+	FT_Face face;
+	const bool isValid(FT_New_Face(mFt, fontFileName.c_str(), 0, &face) == 0);
+	if (isValid)
+		FT_Done_Face(face);
+
+	ReleaseFreeType();
+	mValidFontFiles[fontFileName] = isValid;
+	return isValid;
+}
+
+//=============================================================================
+// Class:			GlyphAtlas
+// Function:		AcquireFreeType
+//
+// Description:		Initializes the Freetype library (with reference
+//					counting).  Must be called with mAtlasMutex locked.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//=============================================================================
+bool GlyphAtlas::AcquireFreeType()
+{
+	if (mFtReferenceCount == 0)
+	{
+		if (FT_Init_FreeType(&mFt))
+			return false;
+	}
+
+	++mFtReferenceCount;
+	return true;
+}
+
+//=============================================================================
+// Class:			GlyphAtlas
+// Function:		ReleaseFreeType
+//
+// Description:		Frees the Freetype library when it is no longer in use.
+//					Must be called with mAtlasMutex locked.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GlyphAtlas::ReleaseFreeType()
+{
+	assert(mFtReferenceCount > 0);
+	--mFtReferenceCount;
+	if (mFtReferenceCount == 0)
+		FT_Done_FreeType(mFt);
+}
+
+//=============================================================================
+// Class:			GlyphAtlas
+// Function:		GetGlyph
+//
+// Description:		Returns the specified glyph, rasterizing it if it has not
+//					been previously requested.
+//
+// Input Arguments:
+//		code	= const char32_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const Glyph&
+//
+//=============================================================================
+const GlyphAtlas::Glyph& GlyphAtlas::GetGlyph(const char32_t& code)
+{
+	const auto it(mGlyphs.find(code));
+	if (it != mGlyphs.end())
+		return it->second;
+
+	Glyph g;
+	if (FT_Load_Char(mFace, code, FT_LOAD_RENDER) == 0)
+	{
+		const FT_Bitmap& bitmap(mFace->glyph->bitmap);
+		g.xSize = bitmap.width;
+		g.ySize = bitmap.rows;
+		g.xBearing = mFace->glyph->bitmap_left;
+		g.yBearing = mFace->glyph->bitmap_top;
+		g.advance = mFace->glyph->advance.x;
+
+		if (g.xSize > 0 && g.ySize > 0)
+		{
+			Pack(g.xSize, g.ySize, g.x, g.y);
+
+			int row;
+			for (row = 0; row < g.ySize; ++row)
+			{
+				const unsigned char* source(bitmap.buffer + row * bitmap.pitch);
+				std::copy(source, source + g.xSize,
+					mPixels.begin() + (g.y + row) * mWidth + g.x);
+			}
+
+			++mRevision;
+		}
+	}
+
+	// References to elements are not invalidated by subsequent insertions
+	return mGlyphs.emplace(code, g).first->second;
+}
+
+//=============================================================================
+// Class:			GlyphAtlas
+// Function:		Pack
+//
+// Description:		Finds space for a glyph of the specified size, growing the
+//					image if necessary.
+//
+// Input Arguments:
+//		width	= const unsigned int&
+//		height	= const unsigned int&
+//
+// Output Arguments:
+//		x	= unsigned int&
+//		y	= unsigned int&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GlyphAtlas::Pack(const unsigned int& width, const unsigned int& height,
+	unsigned int& x, unsigned int& y)
+{
+	if (width + 2 * mPadding > mWidth)
+		Resize(NextPowerOfTwo(width + 2 * mPadding), mHeight);
+
+	if (mPenX + width + mPadding > mWidth)
+	{
+		mPenX = mPadding;
+		mPenY += mRowHeight + mPadding;
+		mRowHeight = 0;
+	}
+
+	if (mPenY + height + mPadding > mHeight)
+		Resize(mWidth, NextPowerOfTwo(mPenY + height + mPadding));
+
+	x = mPenX;
+	y = mPenY;
+	mPenX += width + mPadding;
+	mRowHeight = std::max(mRowHeight, height);
+}
+
+//=============================================================================
+// Class:			GlyphAtlas
+// Function:		Resize
+//
+// Description:		Enlarges the image without moving existing glyphs.
+//
+// Input Arguments:
+//		width	= const unsigned int&
+//		height	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GlyphAtlas::Resize(const unsigned int& width, const unsigned int& height)
+{
+	assert(width >= mWidth && height >= mHeight);
+
+	std::vector<unsigned char> pixels(width * height, 0);
+	unsigned int row;
+	for (row = 0; row < mHeight; ++row)
+		std::copy(mPixels.begin() + row * mWidth,
+			mPixels.begin() + (row + 1) * mWidth,
+			pixels.begin() + row * width);
+
+	mPixels = std::move(pixels);
+	mWidth = width;
+	mHeight = height;
+}
+
+//=============================================================================
+// Class:			GlyphAtlas
+// Function:		NextPowerOfTwo
+//
+// Description:		Returns the smallest power of two which is greater than or
+//					equal to the specified value.
+//
+// Input Arguments:
+//		value	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//=============================================================================
+unsigned int GlyphAtlas::NextPowerOfTwo(const unsigned int& value)
+{
+	unsigned int power(1);
+	while (power < value)
+		power <<= 1;
+
+	return power;
+}
+
+}// namespace LibPlot2D
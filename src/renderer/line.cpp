@@ -9,18 +9,24 @@
 // File:  line.cpp
 // Date:  4/2/2015
 // Auth:  K. Loux
-// Desc:  Object representing a line, drawn with triangles faded from line
-//        color to background color in order to make the lines prettier, be
-//        more consistent from platform to platofrm and to support sub-pixel
-//        widths.
+// Desc:  Object representing a line, expanded to triangles by a shader and
+//        faded from line color to background color in order to make the
+//        lines prettier, be more consistent from platform to platofrm and to
+//        support sub-pixel widths.
 
 // GLEW headers
 #include <GL/glew.h>
 
 // Local headers
 #include "lp2d/renderer/line.h"
-#include "lp2d/utilities/math/plotMath.h"
 #include "lp2d/renderer/renderWindow.h"
+#include "lp2d/utilities/threadPool.h"
+#include "lp2d/utilities/trace.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace LibPlot2D
 {
@@ -41,7 +47,188 @@ namespace LibPlot2D
 //		None
 //
 //=============================================================================
-const double Line::mFadeDistance(0.05);
+const double Line::mFadeDistance(1.0);// [pixels]
+const unsigned int Line::mParallelChunkSize(65536);// [points]
+
+const std::string Line::mHalfWidthName("halfWidth");
+const std::string Line::mFadeWidthName("fadeWidth");
+const std::string Line::mPixelSizeName("pixelSize");
+const std::string Line::mLineColorName("lineColor");
+const std::string Line::mFadeColorName("fadeColor");
+
+//=============================================================================
+// Class:			Line
+// Function:		mVertexShader
+//
+// Description:		Vertex shader for lines.  Transforms points to screen
+//					coordinates (pixels).
+//
+// Input Arguments:
+//		0	= position
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const std::string Line::mVertexShader(
+	"#version 400\n"
+	"\n"
+	"uniform mat4 modelviewMatrix;\n"
+	"\n"
+	"layout(location = 0) in vec2 position;\n"
+	"\n"
+	"out vec2 screenPosition;\n"
+	"\n"
+	"void main()\n"
+	"{\n"
+	"    screenPosition = (modelviewMatrix * vec4(position, 0.0, 1.0)).xy;\n"
+	"}\n"
+);
+
+//=============================================================================
+// Class:			Line
+// Function:		mGeometryShader
+//
+// Description:		Geometry shader for lines.  Expands each segment into a
+//					quad wide enough to contain the line and its faded edges,
+//					with mitered joints computed in screen coordinates.  The
+//					signed distance from the center of the line is passed to
+//					the fragment shader for anti-aliasing.  Segments with
+//					invalid (NaN or infinite) end points are skipped.
+//					pixelSize is the size of an output pixel in screen
+//					coordinates (less than one when the image is magnified).
+//
+// Input Arguments:
+//		0	= screenPosition (with adjacency)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const std::string Line::mGeometryShader(
+	"#version 400\n"
+	"\n"
+	"layout(lines_adjacency) in;\n"
+	"layout(triangle_strip, max_vertices = 4) out;\n"
+	"\n"
+	"uniform mat4 projectionMatrix;\n"
+	"uniform float halfWidth;\n"
+	"uniform float fadeWidth;\n"
+	"uniform float pixelSize;\n"
+	"\n"
+	"in vec2 screenPosition[];\n"
+	"\n"
+	"out float distance;\n"
+	"\n"
+	"const float miterLimit = 4.0;\n"
+	"\n"
+	"bool IsValid(vec2 p)\n"
+	"{\n"
+	"    return !any(isnan(p)) && !any(isinf(p));\n"
+	"}\n"
+	"\n"
+	"vec2 Direction(vec2 from, vec2 to)\n"
+	"{\n"
+	"    vec2 d = to - from;\n"
+	"    if (!IsValid(d) || dot(d, d) == 0.0)\n"
+	"        return vec2(0.0);\n"
+	"    return normalize(d);\n"
+	"}\n"
+	"\n"
+	"vec2 Normal(vec2 direction)\n"
+	"{\n"
+	"    return vec2(-direction.y, direction.x);\n"
+	"}\n"
+	"\n"
+	"// Offset of unit half-width at the joint between segments with the\n"
+	"// specified directions (zero for the end of the line)\n"
+	"vec2 JointOffset(vec2 before, vec2 after, vec2 normal)\n"
+	"{\n"
+	"    vec2 miter = Normal(before) + Normal(after);\n"
+	"    float miterLength = length(miter);\n"
+	"    if (miterLength < 1.0e-6)\n"
+	"        return normal;\n"
+	"    miter /= miterLength;\n"
+	"    return miter / max(dot(miter, normal), 1.0 / miterLimit);\n"
+	"}\n"
+	"\n"
+	"void EmitPoint(vec2 p, float d)\n"
+	"{\n"
+	"    distance = d;\n"
+	"    gl_Position = projectionMatrix * vec4(p, 0.0, 1.0);\n"
+	"    EmitVertex();\n"
+	"}\n"
+	"\n"
+	"void main()\n"
+	"{\n"
+	"    vec2 p0 = screenPosition[1];\n"
+	"    vec2 p1 = screenPosition[2];\n"
+	"    vec2 direction = Direction(p0, p1);\n"
+	"    if (!IsValid(p0) || !IsValid(p1) || direction == vec2(0.0))\n"
+	"        return;\n"
+	"\n"
+	"    vec2 normal = Normal(direction);\n"
+	"    vec2 offset0 = JointOffset(Direction(screenPosition[0], p0), direction, normal);\n"
+	"    vec2 offset1 = JointOffset(direction, Direction(p1, screenPosition[3]), normal);\n"
+	"\n"
+	"    // Lines narrower than a pixel are drawn one pixel wide and faded\n"
+	"    float edge = max(halfWidth, 0.5 * pixelSize) + fadeWidth;\n"
+	"\n"
+	"    EmitPoint(p0 - offset0 * edge, -edge);\n"
+	"    EmitPoint(p1 - offset1 * edge, -edge);\n"
+	"    EmitPoint(p0 + offset0 * edge, edge);\n"
+	"    EmitPoint(p1 + offset1 * edge, edge);\n"
+	"    EndPrimitive();\n"
+	"}\n"
+);
+
+//=============================================================================
+// Class:			Line
+// Function:		mFragmentShader
+//
+// Description:		Fragment shader for lines.  Computes the fraction of each
+//					pixel covered by the line from the distance to the center
+//					of the line and blends between the line and fade colors.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		outputColor	= vec4
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const std::string Line::mFragmentShader(
+	"#version 400\n"
+	"\n"
+	"uniform float halfWidth;\n"
+	"uniform float fadeWidth;\n"
+	"uniform float pixelSize;\n"
+	"uniform vec4 lineColor;\n"
+	"uniform vec4 fadeColor;\n"
+	"\n"
+	"in float distance;\n"
+	"\n"
+	"out vec4 outputColor;\n"
+	"\n"
+	"void main()\n"
+	"{\n"
+	"    float drawnHalfWidth = max(halfWidth, 0.5 * pixelSize);\n"
+	"    float coverage = 1.0;\n"
+	"    if (fadeWidth > 0.0)\n"
+	"        coverage = clamp((drawnHalfWidth - abs(distance)) / fadeWidth + 0.5, 0.0, 1.0);\n"
+	"    coverage *= min(2.0 * halfWidth / pixelSize, 1.0);\n"
+	"    outputColor = mix(fadeColor, lineColor, coverage);\n"
+	"}\n"
+);
 
 //=============================================================================
 // Class:			Line
@@ -50,7 +237,7 @@ const double Line::mFadeDistance(0.05);
 // Description:		Constructor for Line class.
 //
 // Input Arguments:
-//		renderWindow	= const RenderWindow&
+//		renderWindow	= RenderWindow&
 //
 // Output Arguments:
 //		None
@@ -59,7 +246,7 @@ const double Line::mFadeDistance(0.05);
 //		None
 //
 //=============================================================================
-Line::Line(const RenderWindow& renderWindow) : mRenderWindow(renderWindow),
+Line::Line(RenderWindow& renderWindow) : mRenderWindow(renderWindow),
 	mHint(GL_DYNAMIC_DRAW)
 {
 	SetWidth(1.0);
@@ -77,7 +264,6 @@ Line::Line(const RenderWindow& renderWindow) : mRenderWindow(renderWindow),
 //		y1	= const unsigned int&
 //		x2	= const unsigned int&
 //		y2	= const unsigned int&
-//		update	= const UpdateMethod&
 //
 // Output Arguments:
 //		bufferInfo	= Primitive::BufferInfo&
@@ -88,10 +274,10 @@ Line::Line(const RenderWindow& renderWindow) : mRenderWindow(renderWindow),
 //=============================================================================
 void Line::Build(const unsigned int &x1, const unsigned int &y1,
 	const unsigned int &x2, const unsigned int &y2,
-	Primitive::BufferInfo& bufferInfo, const UpdateMethod& update) const
+	Primitive::BufferInfo& bufferInfo) const
 {
 	Build(static_cast<double>(x1), static_cast<double>(y1),
-		static_cast<double>(x2), static_cast<double>(y2), bufferInfo, update);
+		static_cast<double>(x2), static_cast<double>(y2), bufferInfo);
 }
 
 //=============================================================================
@@ -105,7 +291,6 @@ void Line::Build(const unsigned int &x1, const unsigned int &y1,
 //		y1	= const double&
 //		x2	= const double&
 //		y2	= const double&
-//		update	= const UpdateMethod&
 //
 // Output Arguments:
 //		bufferInfo	= Primitive::BufferInfo&
@@ -115,18 +300,14 @@ void Line::Build(const unsigned int &x1, const unsigned int &y1,
 //
 //=============================================================================
 void Line::Build(const double &x1, const double &y1,const double &x2,
-	const double &y2, Primitive::BufferInfo& bufferInfo,
-	const UpdateMethod& update) const
+	const double &y2, Primitive::BufferInfo& bufferInfo) const
 {
-	if (mPretty)
-	{
-		std::vector<std::pair<double, double>> v;
-		v.push_back(std::make_pair(x1, y1));
-		v.push_back(std::make_pair(x2, y2));
-		DoPrettyDraw(v, update, bufferInfo);
-	}
-	else
-		DoUglyDraw(x1, y1, x2, y2, update, bufferInfo);
+	AllocateBuffer(4, bufferInfo);
+	AssignVertex(0, x1, y1, bufferInfo);
+	AssignVertex(1, x1, y1, bufferInfo);
+	AssignVertex(2, x2, y2, bufferInfo);
+	AssignVertex(3, x2, y2, bufferInfo);
+	Upload(bufferInfo);
 }
 
 //=============================================================================
@@ -137,7 +318,6 @@ void Line::Build(const double &x1, const double &y1,const double &x2,
 //
 // Input Arguments:
 //		points	= const std::vector<std::pair<unsigned int, unsigned int>>&
-//		update	= const UpdateMethod&
 //
 // Output Arguments:
 //		bufferInfo	= Primitive::BufferInfo&
@@ -148,7 +328,7 @@ void Line::Build(const double &x1, const double &y1,const double &x2,
 //=============================================================================
 void Line::Build(
 	const std::vector<std::pair<unsigned int, unsigned int>> &points,
-	Primitive::BufferInfo& bufferInfo, const UpdateMethod& update) const
+	Primitive::BufferInfo& bufferInfo) const
 {
 	std::vector<std::pair<double, double>> dPoints(points.size());
 	unsigned int i;
@@ -158,18 +338,19 @@ void Line::Build(
 		dPoints[i].second = static_cast<double>(points[i].second);
 	}
 	
-	Build(dPoints, bufferInfo, update);
+	Build(dPoints, bufferInfo);
 }
 
 //=============================================================================
 // Class:			Line
 // Function:		Build
 //
-// Description:		Builds the specified line segments.
+// Description:		Builds a line strip from the specified points.  The first
+//					and last points are repeated so each segment has adjacency
+//					information for computing the joints.
 //
 // Input Arguments:
 //		points	= cosnt std::vector<std::pair<double, double>>&
-//		update	= const UpdateMethod&
 //
 // Output Arguments:
 //		bufferInfo	= Primitive::BufferInfo&
@@ -179,27 +360,35 @@ void Line::Build(
 //
 //=============================================================================
 void Line::Build(const std::vector<std::pair<double, double>> &points,
-	Primitive::BufferInfo& bufferInfo, const UpdateMethod& update) const
+	Primitive::BufferInfo& bufferInfo) const
 {
 	if (points.size() < 2)
+	{
+		bufferInfo.vertexCount = 0;
+		bufferInfo.vertexCountModified = false;
 		return;
+	}
+
+	AllocateBuffer(points.size() + 2, bufferInfo);
+	AssignVertex(0, points.front().first, points.front().second, bufferInfo);
 
-	if (mPretty)
-		DoPrettyDraw(points, update, bufferInfo);
-	else
-		DoUglyDraw(points, update, bufferInfo);
+	unsigned int i;
+	for (i = 0; i < points.size(); ++i)
+		AssignVertex(i + 1, points[i].first, points[i].second, bufferInfo);
+
+	AssignVertex(i + 1, points.back().first, points.back().second, bufferInfo);
+	Upload(bufferInfo);
 }
 
 //=============================================================================
 // Class:			Line
 // Function:		Build
 //
-// Description:		Builds the specified line segments.
+// Description:		Builds a line strip from the specified points.
 //
 // Input Arguments:
-//		x		= const std::vector<double>&
-//		y		= const std::vector<double>&
-//		update	= const UpdateMethod&
+//		x	= const std::vector<double>&
+//		y	= const std::vector<double>&
 //
 // Output Arguments:
 //		bufferInfo	= Primitive::BufferInfo&
@@ -209,29 +398,26 @@ void Line::Build(const std::vector<std::pair<double, double>> &points,
 //
 //=============================================================================
 void Line::Build(const std::vector<double>& x, const std::vector<double>& y,
-	Primitive::BufferInfo& bufferInfo,const UpdateMethod& update) const
+	Primitive::BufferInfo& bufferInfo) const
 {
-	assert(x.size() == y.size());
-
-	std::vector<std::pair<double, double>> dPoints(x.size());
-	unsigned int i;
-	for (i = 0; i < dPoints.size(); ++i)
-	{
-		dPoints[i].first = x[i];
-		dPoints[i].second = y[i];
-	}
-	Build(dPoints, bufferInfo, update);
+	BuildVertices(x, y, bufferInfo);
+	if (bufferInfo.vertexCount > 0)
+		Upload(bufferInfo);
 }
 
 //=============================================================================
 // Class:			Line
-// Function:		BuildSegments
+// Function:		BuildVertices
 //
-// Description:		Builds the specified disconnected line segments.
+// Description:		Fills the local vertex buffer with a line strip through
+//					the specified points, without making any OpenGL calls.
+//					The first and last points are repeated so each segment
+//					has adjacency information for computing the joints.  Large
+//					lines are split into chunks which are filled in parallel.
 //
 // Input Arguments:
-//		points	= const std::vector<std::pair<double, double>>
-//		update	= const UpdateMethod&
+//		x	= const std::vector<double>&
+//		y	= const std::vector<double>&
 //
 // Output Arguments:
 //		bufferInfo	= Primitive::BufferInfo&
@@ -240,118 +426,152 @@ void Line::Build(const std::vector<double>& x, const std::vector<double>& y,
 //		None
 //
 //=============================================================================
-void Line::BuildSegments(const std::vector<std::pair<double, double>> &points,
-	Primitive::BufferInfo& bufferInfo, const UpdateMethod& update) const
+void Line::BuildVertices(const std::vector<double>& x,
+	const std::vector<double>& y, Primitive::BufferInfo& bufferInfo) const
 {
-	if (points.size() == 0)
+	LP2D_TRACE_SCOPE("geometry", "Line::BuildVertices");
+
+	assert(x.size() == y.size());
+	if (x.size() < 2)
+	{
+		bufferInfo.vertexCount = 0;
+		bufferInfo.vertexCountModified = false;
 		return;
-	assert(points.size() % 2 == 0);
+	}
+
+	AllocateBuffer(x.size() + 2, bufferInfo);
+	AssignVertex(0, x.front(), y.front(), bufferInfo);
 
-	if (mPretty)
-		DoPrettySegmentDraw(points, update, bufferInfo);
-	else
-		DoUglyDraw(points, update, bufferInfo);
+	const unsigned int chunkCount((x.size() + mParallelChunkSize - 1)
+		/ mParallelChunkSize);
+	ThreadPool::GetSharedPool().ParallelFor(chunkCount,
+		[this, &x, &y, &bufferInfo](const unsigned int& chunk)
+	{
+		const unsigned int end(std::min<unsigned int>(x.size(),
+			(chunk + 1) * mParallelChunkSize));
+		unsigned int i;
+		for (i = chunk * mParallelChunkSize; i < end; ++i)
+			AssignVertex(i + 1, x[i], y[i], bufferInfo);
+	});
+
+	AssignVertex(x.size() + 1, x.back(), y.back(), bufferInfo);
 }
 
 //=============================================================================
 // Class:			Line
-// Function:		ComputeOffsets
+// Function:		Upload
 //
-// Description:		Computes the offsets for the outside vertices based on the
-//					line width and orientation.
+// Description:		Sends the local vertex buffer (filled with
+//					BuildVertices()) to the GPU.  Must be called from the
+//					thread which owns the OpenGL context.
 //
 // Input Arguments:
-//		x1	= const double&
-//		y1	= const double&
-//		x2	= const double&
-//		y2	= const double&
+//		bufferInfo	= Primitive::BufferInfo&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void Line::Upload(Primitive::BufferInfo& bufferInfo) const
+{
+	mRenderWindow.InitializePrimitiveType(*this);
+	bufferInfo.GetOpenGLIndices();
+	UploadBuffer(bufferInfo);
+}
+
+//=============================================================================
+// Class:			Line
+// Function:		Append
+//
+// Description:		Adds the specified points to the end of an existing line
+//					strip.  The repeated end point is overwritten by the
+//					first new point and repeated after the last new point.
+//
+// Input Arguments:
+//		x	= const std::vector<double>&
+//		y	= const std::vector<double>&
 //
 // Output Arguments:
-//		dxLine	= const double&
-//		dyLine	= const double&
-//		dxEdge	= const double&
-//		dyEdge	= const double&
+//		bufferInfo	= Primitive::BufferInfo&
 //
 // Return Value:
 //		None
 //
 //=============================================================================
-void Line::ComputeOffsets(const double &x1, const double &y1, const double &x2,
-	const double &y2, double& dxLine, double& dyLine, double& dxEdge, double& dyEdge) const
+void Line::Append(const std::vector<double>& x, const std::vector<double>& y,
+	Primitive::BufferInfo& bufferInfo) const
 {
-	double miter(atan2((y2 - y1) / mYScale, (x2 - x1) / mXScale) + M_PI * 0.5);
+	assert(x.size() == y.size());
+	assert(bufferInfo.vertexCount > 2);
+	if (x.empty())
+		return;
 
-	dxLine = mHalfWidth * cos(miter) * mXScale;
-	dyLine = mHalfWidth * sin(miter) * mYScale;
+	const unsigned int first(bufferInfo.vertexCount - 1);
+	bufferInfo.vertexCount += x.size();
+	bufferInfo.vertexBuffer.resize(bufferInfo.vertexCount
+		* mRenderWindow.GetVertexDimension());
+
+	unsigned int i;
+	for (i = 0; i < x.size(); ++i)
+		AssignVertex(first + i, x[i], y[i], bufferInfo);
 
-	dxEdge = dxLine * (mHalfWidth + mFadeDistance) / mHalfWidth;
-	dyEdge = dyLine * (mHalfWidth + mFadeDistance) / mHalfWidth;
+	AssignVertex(first + i, x.back(), y.back(), bufferInfo);
+	UploadBuffer(bufferInfo, first);
 }
 
 //=============================================================================
 // Class:			Line
-// Function:		ComputeOffsets
+// Function:		BuildSegments
 //
-// Description:		Computes the offsets for the outside vertices based on the
-//					line width and orientation.
+// Description:		Builds the specified disconnected line segments.  Each end
+//					point is repeated in place of the adjacent point, so the
+//					segment ends are square.
 //
 // Input Arguments:
-//		xPrior	= const double&
-//		yPrior	= const double&
-//		x		= const double&
-//		y		= const double&
-//		xNext	= const double&
-//		yNext	= const double&
+//		points	= const std::vector<std::pair<double, double>>
 //
 // Output Arguments:
-//		dxLine	= const double&
-//		dyLine	= const double&
-//		dxEdge	= const double&
-//		dyEdge	= const double&
+//		bufferInfo	= Primitive::BufferInfo&
 //
 // Return Value:
 //		None
 //
 //=============================================================================
-void Line::ComputeOffsets(const double &xPrior, const double &yPrior,
-	const double &x, const double &y, const double &xNext, const double &yNext,
-	double& dxLine, double& dyLine, double& dxEdge, double& dyEdge) const
+void Line::BuildSegments(const std::vector<std::pair<double, double>> &points,
+	Primitive::BufferInfo& bufferInfo) const
 {
-	const double anglePrior(atan2((y - yPrior) / mYScale,
-		(x - xPrior) / mXScale));
-	const double angleNext(atan2((yNext - y) / mYScale,
-		(xNext - x) / mXScale));
-	double miter(0.5 * (anglePrior + angleNext));
-	
-	if (fabs(angleNext - anglePrior) < M_PI)
-		miter += M_PI * 0.5;
-	else
-		miter -= M_PI * 0.5;
-
-	double miterLength(mHalfWidth), fade(mFadeDistance);
-	const double divisor(sin((M_PI - angleNext + anglePrior) * 0.5));
-	if (!PlotMath::IsZero(divisor))
+	assert(points.size() % 2 == 0);
+	if (points.size() == 0)
 	{
-		miterLength /= fabs(divisor);
-		fade /= fabs(divisor);
+		bufferInfo.vertexCount = 0;
+		bufferInfo.vertexCountModified = false;
+		return;
 	}
 
-	dxLine = miterLength * cos(miter) * mXScale;
-	dyLine = miterLength * sin(miter) * mYScale;
+	AllocateBuffer(points.size() * 2, bufferInfo);
+
+	unsigned int i;
+	for (i = 0; i < points.size(); ++i)
+	{
+		AssignVertex(2 * i, points[i].first, points[i].second, bufferInfo);
+		AssignVertex(2 * i + 1, points[i].first, points[i].second, bufferInfo);
+	}
 
-	dxEdge = dxLine * (miterLength + fade) / miterLength;
-	dyEdge = dyLine * (miterLength + fade) / miterLength;
+	Upload(bufferInfo);
 }
 
 //=============================================================================
 // Class:			Line
 // Function:		AllocateBuffer
 //
-// Description:		Allocated local vertex buffer;
+// Description:		Allocates the local vertex buffer (positions only).  No
+//					OpenGL calls are made here.
 //
 // Input Arguments:
-//		vertexCount		= const unsigned int&
-//		triangleCount	= const unsigned int&
+//		vertexCount	= const unsigned int&
 //
 // Output Arguments:
 //		bufferInfo	= Primitive::BufferInfo&
@@ -361,33 +581,28 @@ void Line::ComputeOffsets(const double &xPrior, const double &yPrior,
 //
 //=============================================================================
 void Line::AllocateBuffer(const unsigned int& vertexCount,
-	const unsigned int& triangleCount, Primitive::BufferInfo& bufferInfo) const
+	Primitive::BufferInfo& bufferInfo) const
 {
-	bufferInfo.GetOpenGLIndices(triangleCount > 0);
-
 	bufferInfo.vertexCount = vertexCount;
 	bufferInfo.vertexBuffer.resize(bufferInfo.vertexCount
-		* (mRenderWindow.GetVertexDimension() + 4));
+		* mRenderWindow.GetVertexDimension());
 	assert(mRenderWindow.GetVertexDimension() == 2);
 
-	if (triangleCount > 0)
-		bufferInfo.indexBuffer.resize(triangleCount * 3);
-
 	bufferInfo.vertexCountModified = false;
 }
 
 //=============================================================================
 // Class:			Line
-// Function:		DoUglyDraw
+// Function:		AssignVertex
 //
-// Description:		Draws a line using OpenGL lines.
+// Description:		Assigns the position of the specified vertex.  Scaling and
+//					the origin are applied in double precision, before the
+//					position is narrowed to the precision of the buffer.
 //
 // Input Arguments:
-//		x1	= const double&
-//		y1	= const double&
-//		x2	= const double&
-//		y2	= const double&
-//		update	= const UpdateMethod&
+//		i	= const unsigned int&
+//		x	= const double&
+//		y	= const double&
 //
 // Output Arguments:
 //		bufferInfo	= Primitive::BufferInfo&
@@ -396,203 +611,96 @@ void Line::AllocateBuffer(const unsigned int& vertexCount,
 //		None
 //
 //=============================================================================
-void Line::DoUglyDraw(const double &x1, const double &y1,
-	const double &x2, const double &y2, const UpdateMethod& update,
-	Primitive::BufferInfo& bufferInfo) const
+void Line::AssignVertex(const unsigned int& i, const double& x,
+	const double& y, Primitive::BufferInfo& bufferInfo) const
 {
-	AllocateBuffer(2, 0, bufferInfo);
-
-	bufferInfo.vertexBuffer[0] = static_cast<float>(x1);
-	bufferInfo.vertexBuffer[1] = static_cast<float>(y1);
-	bufferInfo.vertexBuffer[2] = static_cast<float>(x2);
-	bufferInfo.vertexBuffer[3] = static_cast<float>(y2);
-
-	bufferInfo.vertexBuffer[4] = static_cast<float>(mLineColor.GetRed());
-	bufferInfo.vertexBuffer[5] = static_cast<float>(mLineColor.GetGreen());
-	bufferInfo.vertexBuffer[6] = static_cast<float>(mLineColor.GetBlue());
-	bufferInfo.vertexBuffer[7] = static_cast<float>(mLineColor.GetAlpha());
-
-	bufferInfo.vertexBuffer[8] = static_cast<float>(mLineColor.GetRed());
-	bufferInfo.vertexBuffer[9] = static_cast<float>(mLineColor.GetGreen());
-	bufferInfo.vertexBuffer[10] = static_cast<float>(mLineColor.GetBlue());
-	bufferInfo.vertexBuffer[11] = static_cast<float>(mLineColor.GetAlpha());
-
-	if (update != UpdateMethod::Immediate)
-		return;
-
-	glBindVertexArray(bufferInfo.GetVertexArrayIndex());
-
-	glBindBuffer(GL_ARRAY_BUFFER, bufferInfo.GetVertexBufferIndex());
-	glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * bufferInfo.vertexBuffer.size(),
-		bufferInfo.vertexBuffer.data(), mHint);
-
-	glEnableVertexAttribArray(mRenderWindow.GetDefaultPositionLocation());
-	glVertexAttribPointer(mRenderWindow.GetDefaultPositionLocation(), 2, GL_FLOAT, GL_FALSE, 0, 0);
-
-	glEnableVertexAttribArray(mRenderWindow.GetDefaultColorLocation());
-	glVertexAttribPointer(mRenderWindow.GetDefaultColorLocation(), 4, GL_FLOAT, GL_FALSE, 0,
-		(void*)(sizeof(GLfloat) * mRenderWindow.GetVertexDimension() * bufferInfo.vertexCount));
-
-	glLineWidth(2.0 * mHalfWidth);
-
-	glBindVertexArray(0);
-
-	assert(!RenderWindow::GLHasError());
+	const unsigned int dimension(mRenderWindow.GetVertexDimension());
+	bufferInfo.vertexBuffer[i * dimension] = static_cast<float>(
+		ScaleForAxis(x, mXLogarithmic) - mXOrigin);
+	bufferInfo.vertexBuffer[i * dimension + 1] = static_cast<float>(
+		ScaleForAxis(y, mYLogarithmic) - mYOrigin);
 }
 
 //=============================================================================
 // Class:			Line
-// Function:		DoUglyDraw
+// Function:		ScaleForAxis
 //
-// Description:		Draws a line strip using OpenGL lines.
+// Description:		Applies logarithmic scaling, if required.  Non-positive
+//					values on logarithmic axes become NaN, so the adjacent
+//					segments are skipped by the geometry shader.
 //
 // Input Arguments:
-//		points	= const std::vector<std::pair<double, double>>&
-//		update	= const UpdateMethod&
+//		value		= const double&
+//		logarithmic	= const bool&
 //
 // Output Arguments:
-//		bufferInfo	= Primitive::BufferInfo&
+//		None
 //
 // Return Value:
-//		None
+//		double
 //
 //=============================================================================
-void Line::DoUglyDraw(const std::vector<std::pair<double, double>> &points,
-	const UpdateMethod& update, Primitive::BufferInfo& bufferInfo) const
+double Line::ScaleForAxis(const double& value, const bool& logarithmic)
 {
-	AllocateBuffer(points.size(), 0, bufferInfo);
-
-	const unsigned int dimension(mRenderWindow.GetVertexDimension());
-	const unsigned int start(points.size() * dimension);
-	unsigned int i;
-	for (i = 0; i < points.size(); ++i)
-	{
-		bufferInfo.vertexBuffer[i * dimension] = static_cast<float>(points[i].first);
-		bufferInfo.vertexBuffer[i * dimension + 1] = static_cast<float>(points[i].second);
-
-		bufferInfo.vertexBuffer[start + i * 4] = static_cast<float>(mLineColor.GetRed());
-		bufferInfo.vertexBuffer[start + i * 4 + 1] = static_cast<float>(mLineColor.GetGreen());
-		bufferInfo.vertexBuffer[start + i * 4 + 2] = static_cast<float>(mLineColor.GetBlue());
-		bufferInfo.vertexBuffer[start + i * 4 + 3] = static_cast<float>(mLineColor.GetAlpha());
-	}
-
-	if (update != UpdateMethod::Immediate)
-		return;
-
-	glBindVertexArray(bufferInfo.GetVertexArrayIndex());
-
-	glBindBuffer(GL_ARRAY_BUFFER, bufferInfo.GetVertexBufferIndex());
-	glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * bufferInfo.vertexBuffer.size(),
-		bufferInfo.vertexBuffer.data(), mHint);
-
-	glEnableVertexAttribArray(mRenderWindow.GetDefaultPositionLocation());
-	glVertexAttribPointer(mRenderWindow.GetDefaultPositionLocation(), 2, GL_FLOAT, GL_FALSE, 0, 0);
-
-	glEnableVertexAttribArray(mRenderWindow.GetDefaultColorLocation());
-	glVertexAttribPointer(mRenderWindow.GetDefaultColorLocation(), 4, GL_FLOAT, GL_FALSE, 0,
-		(void*)(sizeof(GLfloat) * mRenderWindow.GetVertexDimension() * bufferInfo.vertexCount));
-
-	glLineWidth(2.0 * mHalfWidth);
-
-	glBindVertexArray(0);
-
-	assert(!RenderWindow::GLHasError());
+	if (!logarithmic)
+		return value;
+	else if (value <= 0.0)
+		return std::numeric_limits<double>::quiet_NaN();
+	return log10(value);
 }
 
 //=============================================================================
 // Class:			Line
-// Function:		DoPrettyDraw
+// Function:		UploadBuffer
 //
-// Description:		Draws a line strip using OpenGL triangles.
+// Description:		Sends the local vertex buffer to the GPU, starting with the
+//					specified vertex.  GPU storage is re-used when possible;
+//					when it must grow, its size is doubled so that repeated
+//					appends only occasionally require re-allocation.
 //
 // Input Arguments:
-//		points	= const std::vector<std::pair<double, double>>&
-//		update	= const UpdateMethod&
+//		bufferInfo	= Primitive::BufferInfo&
+//		firstVertex	= const unsigned int&
 //
 // Output Arguments:
-//		bufferInfo	= Primitive::BufferInfo&
+//		None
 //
 // Return Value:
 //		None
 //
 //=============================================================================
-void Line::DoPrettyDraw(const std::vector<std::pair<double, double>> &points,
-	const UpdateMethod& update, Primitive::BufferInfo& bufferInfo) const
+void Line::UploadBuffer(Primitive::BufferInfo& bufferInfo,
+	const unsigned int& firstVertex) const
 {
-	std::vector<Offsets> offsets(points.size());
-
-	/* Draw the line as follows:
-
-	3+----+7
-	 |\   |
-	 | \  |
-	 |  \ |
-	 |   \|
-	2+----+6
-	 |\   |
-	 | \  | __> Direction of line
-	 |  \ |
-	 |   \|
-	1+----+5
-	 |\   |
-	 | \  |
-	 |  \ |
-	 |   \|
-	0+----+4
-	*/
-
-	AllocateBuffer(points.size() * 4, 6 * (points.size() - 1), bufferInfo);
-	AssignVertexData(points, LineStyle::Continuous, bufferInfo);
-
-	unsigned int i;
-	for (i = 0; i < points.size() - 1; ++i)
-	{
-		bufferInfo.indexBuffer[i * 18] = i * 4;
-		bufferInfo.indexBuffer[i * 18 + 1] = i * 4 + 1;
-		bufferInfo.indexBuffer[i * 18 + 2] = (i + 1) * 4;
-
-		bufferInfo.indexBuffer[i * 18 + 3] = i * 4 + 1;
-		bufferInfo.indexBuffer[i * 18 + 4] = i * 4 + 2;
-		bufferInfo.indexBuffer[i * 18 + 5] = (i + 1) * 4 + 1;
+	LP2D_TRACE_SCOPE("gl", "Line::UploadBuffer");
 
-		bufferInfo.indexBuffer[i * 18 + 6] = i * 4 + 2;
-		bufferInfo.indexBuffer[i * 18 + 7] = i * 4 + 3;
-		bufferInfo.indexBuffer[i * 18 + 8] = (i + 1) * 4 + 2;
+	const unsigned int size(bufferInfo.vertexBuffer.size());
+	unsigned int first(firstVertex * mRenderWindow.GetVertexDimension());
+	assert(first <= size);
 
-		bufferInfo.indexBuffer[i * 18 + 9] = i * 4 + 1;
-		bufferInfo.indexBuffer[i * 18 + 10] = (i + 1) * 4 + 1;
-		bufferInfo.indexBuffer[i * 18 + 11] = (i + 1) * 4;
-
-		bufferInfo.indexBuffer[i * 18 + 12] = i * 4 + 2;
-		bufferInfo.indexBuffer[i * 18 + 13] = (i + 1) * 4 + 2;
-		bufferInfo.indexBuffer[i * 18 + 14] = (i + 1) * 4 + 1;
+	glBindVertexArray(bufferInfo.GetVertexArrayIndex());
+	glBindBuffer(GL_ARRAY_BUFFER, bufferInfo.GetVertexBufferIndex());
 
-		bufferInfo.indexBuffer[i * 18 + 15] = i * 4 + 3;
-		bufferInfo.indexBuffer[i * 18 + 16] = (i + 1) * 4 + 3;
-		bufferInfo.indexBuffer[i * 18 + 17] = (i + 1) * 4 + 2;
+	// Also release storage which is much larger than required
+	if (size > bufferInfo.vertexBufferCapacity ||
+		size < bufferInfo.vertexBufferCapacity / 4)
+	{
+		bufferInfo.vertexBufferCapacity = std::max(size,
+			std::min(2 * bufferInfo.vertexBufferCapacity, 2 * size));
+		glBufferData(GL_ARRAY_BUFFER,
+			sizeof(GLfloat) * bufferInfo.vertexBufferCapacity, nullptr, mHint);
+		first = 0;
 	}
 
-	if (update != UpdateMethod::Immediate)
-		return;
-
-	glBindVertexArray(bufferInfo.GetVertexArrayIndex());
-
-	glBindBuffer(GL_ARRAY_BUFFER, bufferInfo.GetVertexBufferIndex());
-	glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * bufferInfo.vertexBuffer.size(),
-		bufferInfo.vertexBuffer.data(), mHint);
+	glBufferSubData(GL_ARRAY_BUFFER, sizeof(GLfloat) * first,
+		sizeof(GLfloat) * (size - first), bufferInfo.vertexBuffer.data() + first);
+	mRenderWindow.GetFrameStatistics().RecordUpload(
+		sizeof(GLfloat) * (size - first));
 
 	glEnableVertexAttribArray(mRenderWindow.GetDefaultPositionLocation());
 	glVertexAttribPointer(mRenderWindow.GetDefaultPositionLocation(),
 		mRenderWindow.GetVertexDimension(), GL_FLOAT, GL_FALSE, 0, 0);
 
-	glEnableVertexAttribArray(mRenderWindow.GetDefaultColorLocation());
-	glVertexAttribPointer(mRenderWindow.GetDefaultColorLocation(), 4, GL_FLOAT, GL_FALSE, 0,
-		(void*)(sizeof(GLfloat) * mRenderWindow.GetVertexDimension() * 4 * points.size()));
-
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufferInfo.GetIndexBufferIndex());
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * bufferInfo.indexBuffer.size(),
-		bufferInfo.indexBuffer.data(), mHint);
-
 	glBindVertexArray(0);
 
 	assert(!RenderWindow::GLHasError());
@@ -600,187 +708,62 @@ void Line::DoPrettyDraw(const std::vector<std::pair<double, double>> &points,
 
 //=============================================================================
 // Class:			Line
-// Function:		DoPrettySegmentDraw
+// Function:		Draw
 //
-// Description:		Draws disconnected lines using OpenGL triangles.
+// Description:		Draws a line strip created with Build().
 //
 // Input Arguments:
-//		points	= const std::vector<std::pair<double, double>>&
-//		update	= const UpdateMethod&
+//		vertexCount	= const unsigned int&
+//		modelview	= const Eigen::Matrix4d&
 //
 // Output Arguments:
-//		bufferInfo	= Primitive::BufferInfo&
+//		None
 //
 // Return Value:
 //		None
 //
 //=============================================================================
-void Line::DoPrettySegmentDraw(const std::vector<std::pair<double, double>> &points,
-	const UpdateMethod& update, Primitive::BufferInfo& bufferInfo) const
+void Line::Draw(const unsigned int& vertexCount,
+	const Eigen::Matrix4d& modelview) const
 {
-	assert(!RenderWindow::GLHasError());
-	/* Draw the segments as follows:
-
-	3+----+7
-	 |\   |
-	 | \  |
-	 |  \ |
-	 |   \|
-	2+----+6
-	 |\   |
-	 | \  | __> Direction of segment
-	 |  \ |
-	 |   \|
-	1+----+5
-	 |\   |
-	 | \  |
-	 |  \ |
-	 |   \|
-	0+----+4
-	*/
-
-	assert(points.size() % 2 == 0);
-	AllocateBuffer(points.size() * 4, 6 * (points.size() / 2), bufferInfo);
-	AssignVertexData(points, LineStyle::Segments, bufferInfo);
-
-	unsigned int i;
-	for (i = 0; i < points.size() / 2; ++i)
-	{
-		bufferInfo.indexBuffer[i * 18] = i * 8;
-		bufferInfo.indexBuffer[i * 18 + 1] = i * 8 + 1;
-		bufferInfo.indexBuffer[i * 18 + 2] = i * 8 + 4;
-
-		bufferInfo.indexBuffer[i * 18 + 3] = i * 8 + 1;
-		bufferInfo.indexBuffer[i * 18 + 4] = i * 8 + 2;
-		bufferInfo.indexBuffer[i * 18 + 5] = i * 8 + 5;
-
-		bufferInfo.indexBuffer[i * 18 + 6] = i * 8 + 2;
-		bufferInfo.indexBuffer[i * 18 + 7] = i * 8 + 3;
-		bufferInfo.indexBuffer[i * 18 + 8] = i * 8 + 6;
-
-		bufferInfo.indexBuffer[i * 18 + 9] = i * 8 + 1;
-		bufferInfo.indexBuffer[i * 18 + 10] = i * 8 + 5;
-		bufferInfo.indexBuffer[i * 18 + 11] = i * 8 + 4;
-
-		bufferInfo.indexBuffer[i * 18 + 12] = i * 8 + 2;
-		bufferInfo.indexBuffer[i * 18 + 13] = i * 8 + 6;
-		bufferInfo.indexBuffer[i * 18 + 14] = i * 8 + 5;
-
-		bufferInfo.indexBuffer[i * 18 + 15] = i * 8 + 3;
-		bufferInfo.indexBuffer[i * 18 + 16] = i * 8 + 7;
-		bufferInfo.indexBuffer[i * 18 + 17] = i * 8 + 6;
-	}
-
-	if (update != UpdateMethod::Immediate)
-		return;
-
-	glBindVertexArray(bufferInfo.GetVertexArrayIndex());
-
-	glBindBuffer(GL_ARRAY_BUFFER, bufferInfo.GetVertexBufferIndex());
-	glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * bufferInfo.vertexBuffer.size(),
-		bufferInfo.vertexBuffer.data(), mHint);
-
-	glEnableVertexAttribArray(mRenderWindow.GetDefaultPositionLocation());
-	glVertexAttribPointer(mRenderWindow.GetDefaultPositionLocation(),
-		mRenderWindow.GetVertexDimension(), GL_FLOAT, GL_FALSE, 0, 0);
-
-	glEnableVertexAttribArray(mRenderWindow.GetDefaultColorLocation());
-	glVertexAttribPointer(mRenderWindow.GetDefaultColorLocation(), 4, GL_FLOAT, GL_FALSE, 0,
-		(void*)(sizeof(GLfloat) * mRenderWindow.GetVertexDimension() * 4 * points.size()));
-
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufferInfo.GetIndexBufferIndex());
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * bufferInfo.indexBuffer.size(),
-		bufferInfo.indexBuffer.data(), mHint);
-
-	glBindVertexArray(0);
-
-	assert(!RenderWindow::GLHasError());
+	DoDraw(GL_LINE_STRIP_ADJACENCY, vertexCount, modelview);
 }
 
 //=============================================================================
 // Class:			Line
-// Function:		AssignVertexData
+// Function:		DrawSegments
 //
-// Description:		Assigns vertex data to the vertex buffer (pretty lines).
+// Description:		Draws disconnected line segments created with
+//					BuildSegments().
 //
 // Input Arguments:
-//		points	= const std::vector<std::pair<double, double>>&
-//		style	= const LineStyle&
+//		vertexCount	= const unsigned int&
+//		modelview	= const Eigen::Matrix4d&
 //
 // Output Arguments:
-//		bufferInfo	= Primitive::BufferInfo&
+//		None
 //
 // Return Value:
 //		None
 //
 //=============================================================================
-void Line::AssignVertexData(const std::vector<std::pair<double, double>>& points,
-	const LineStyle& style, Primitive::BufferInfo& bufferInfo) const
+void Line::DrawSegments(const unsigned int& vertexCount,
+	const Eigen::Matrix4d& modelview) const
 {
-	std::vector<Offsets> offsets(points.size());
-	const unsigned int dimension(mRenderWindow.GetVertexDimension());
-	const unsigned int colorStart(dimension * 4 * points.size());
-	unsigned int i;
-	for (i = 0; i < points.size(); ++i)
-	{
-		if (i == 0 || (style == LineStyle::Segments && i % 2 == 0))
-			ComputeOffsets(points[i].first, points[i].second, points[i + 1].first,
-				points[i + 1].second, offsets[i].dxLine, offsets[i].dyLine,
-				offsets[i].dxEdge, offsets[i].dyEdge);
-		else if (style == LineStyle::Segments)
-			offsets[i] = offsets[i - 1];
-		else if (i == points.size() - 1)
-			ComputeOffsets(points[i - 1].first, points[i - 1].second, points[i].first,
-				points[i].second, offsets[i].dxLine, offsets[i].dyLine,
-				offsets[i].dxEdge, offsets[i].dyEdge);
-		else
-			ComputeOffsets(points[i - 1].first, points[i - 1].second,
-				points[i].first, points[i].second, points[i + 1].first,
-				points[i + 1].second, offsets[i].dxLine, offsets[i].dyLine,
-				offsets[i].dxEdge, offsets[i].dyEdge);
-
-		bufferInfo.vertexBuffer[i * dimension * 4] = static_cast<float>((points[i].first + offsets[i].dxEdge));
-		bufferInfo.vertexBuffer[i * dimension * 4 + 1] = static_cast<float>((points[i].second + offsets[i].dyEdge));
-
-		bufferInfo.vertexBuffer[i * dimension * 4 + dimension] = static_cast<float>((points[i].first + offsets[i].dxLine));
-		bufferInfo.vertexBuffer[i * dimension * 4 + dimension + 1] = static_cast<float>((points[i].second + offsets[i].dyLine));
-
-		bufferInfo.vertexBuffer[i * dimension * 4 + 2 * dimension] = static_cast<float>((points[i].first - offsets[i].dxLine));
-		bufferInfo.vertexBuffer[i * dimension * 4 + 2 * dimension + 1] = static_cast<float>((points[i].second - offsets[i].dyLine));
-
-		bufferInfo.vertexBuffer[i * dimension * 4 + 3 * dimension] = static_cast<float>((points[i].first - offsets[i].dxEdge));
-		bufferInfo.vertexBuffer[i * dimension * 4 + 3 * dimension + 1] = static_cast<float>((points[i].second - offsets[i].dyEdge));
-
-		bufferInfo.vertexBuffer[colorStart + i * 16] = static_cast<float>(mBackgroundColor.GetRed());
-		bufferInfo.vertexBuffer[colorStart + i * 16 + 1] = static_cast<float>(mBackgroundColor.GetGreen());
-		bufferInfo.vertexBuffer[colorStart + i * 16 + 2] = static_cast<float>(mBackgroundColor.GetBlue());
-		bufferInfo.vertexBuffer[colorStart + i * 16 + 3] = static_cast<float>(mBackgroundColor.GetAlpha());
-
-		bufferInfo.vertexBuffer[colorStart + i * 16 + 4] = static_cast<float>(mLineColor.GetRed());
-		bufferInfo.vertexBuffer[colorStart + i * 16 + 5] = static_cast<float>(mLineColor.GetGreen());
-		bufferInfo.vertexBuffer[colorStart + i * 16 + 6] = static_cast<float>(mLineColor.GetBlue());
-		bufferInfo.vertexBuffer[colorStart + i * 16 + 7] = static_cast<float>(mLineColor.GetAlpha());
-
-		bufferInfo.vertexBuffer[colorStart + i * 16 + 8] = static_cast<float>(mLineColor.GetRed());
-		bufferInfo.vertexBuffer[colorStart + i * 16 + 9] = static_cast<float>(mLineColor.GetGreen());
-		bufferInfo.vertexBuffer[colorStart + i * 16 + 10] = static_cast<float>(mLineColor.GetBlue());
-		bufferInfo.vertexBuffer[colorStart + i * 16 + 11] = static_cast<float>(mLineColor.GetAlpha());
-
-		bufferInfo.vertexBuffer[colorStart + i * 16 + 12] = static_cast<float>(mBackgroundColor.GetRed());
-		bufferInfo.vertexBuffer[colorStart + i * 16 + 13] = static_cast<float>(mBackgroundColor.GetGreen());
-		bufferInfo.vertexBuffer[colorStart + i * 16 + 14] = static_cast<float>(mBackgroundColor.GetBlue());
-		bufferInfo.vertexBuffer[colorStart + i * 16 + 15] = static_cast<float>(mBackgroundColor.GetAlpha());
-	}
+	DoDraw(GL_LINES_ADJACENCY, vertexCount, modelview);
 }
 
 //=============================================================================
 // Class:			Line
-// Function:		DoUglyDraw
+// Function:		DoDraw
 //
-// Description:		Draws a line strip using OpenGL lines.
+// Description:		Sends the line options to the line shader program and
+//					draws the currently bound vertex array.
 //
 // Input Arguments:
+//		mode		= const GLenum&
 //		vertexCount	= const unsigned int&
+//		modelview	= const Eigen::Matrix4d&
 //
 // Output Arguments:
 //		None
@@ -789,64 +772,109 @@ void Line::AssignVertexData(const std::vector<std::pair<double, double>>& points
 //		None
 //
 //=============================================================================
-void Line::DoUglyDraw(const unsigned int& vertexCount)
+void Line::DoDraw(const GLenum& mode, const unsigned int& vertexCount,
+	const Eigen::Matrix4d& modelview) const
 {
 	assert(vertexCount > 0);
-	glDrawArrays(GL_LINE_STRIP, 0, vertexCount);// TODO:  Memory leak here
-	glLineWidth(1.0f);// TODO:  OGL4 Better way to do this? (prevent all lines after this from being drawn at this line's width)  Maybe include in vertex attrib array?
-	// Is it better to not even have ugly lines now?
+	assert(mRenderWindow.IsPrimitiveTypeInitialized<Line>());
+
+	mRenderWindow.UseProgram(mRenderWindow.GetPrimitiveTypeProgram<Line>());
+	const auto& locations(mRenderWindow.GetActiveProgramInfo().uniformLocations);
+
+	RenderWindow::SendUniformMatrix(GetBufferModelview(modelview),
+		locations.find(RenderWindow::mModelviewName)->second);
+	glUniform1f(locations.find(mHalfWidthName)->second,
+		static_cast<float>(mHalfWidth));
+	// Widths are in screen coordinates, but the fade and the minimum width
+	// are always one output pixel
+	const double pixelSize(1.0 / mRenderWindow.GetOutputScale());
+	glUniform1f(locations.find(mFadeWidthName)->second,
+		mPretty ? static_cast<float>(mFadeDistance * pixelSize) : 0.0f);
+	glUniform1f(locations.find(mPixelSizeName)->second,
+		static_cast<float>(pixelSize));
+	glUniform4f(locations.find(mLineColorName)->second,
+		static_cast<float>(mLineColor.GetRed()),
+		static_cast<float>(mLineColor.GetGreen()),
+		static_cast<float>(mLineColor.GetBlue()),
+		static_cast<float>(mLineColor.GetAlpha()));
+	glUniform4f(locations.find(mFadeColorName)->second,
+		static_cast<float>(mBackgroundColor.GetRed()),
+		static_cast<float>(mBackgroundColor.GetGreen()),
+		static_cast<float>(mBackgroundColor.GetBlue()),
+		static_cast<float>(mBackgroundColor.GetAlpha()));
+
+	glDrawArrays(mode, 0, vertexCount);
+
+	mRenderWindow.UseDefaultProgram();
 
 	assert(!RenderWindow::GLHasError());
 }
 
 //=============================================================================
 // Class:			Line
-// Function:		DoUglyDraw
+// Function:		GetBufferModelview
 //
-// Description:		Draws a line strip using OpenGL lines.
+// Description:		Adds the translation from the buffer coordinates to the
+//					scaled data coordinates to the specified modelview matrix.
+//					Computed in double precision, so the large terms cancel
+//					before the result is sent to OpenGL.
 //
 // Input Arguments:
-//		vertexCount	= const unsigned int&
+//		modelview	= const Eigen::Matrix4d&
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		None
+//		Eigen::Matrix4d
 //
 //=============================================================================
-void Line::DoUglySegmentDraw(const unsigned int& vertexCount)
+Eigen::Matrix4d Line::GetBufferModelview(const Eigen::Matrix4d& modelview) const
 {
-	assert(vertexCount > 0);
-	glDrawArrays(GL_LINES, 0, vertexCount);
-	glLineWidth(1.0f);// TODO:  OGL4 Better way to do this? (prevent all lines after this from being drawn at this line's width)  Maybe include in vertex attrib array?
-	// Is it better to not even have ugly lines now?
-
-	assert(!RenderWindow::GLHasError());
+	Eigen::Matrix4d translation(Eigen::Matrix4d::Identity());
+	translation(0, 3) = mXOrigin;
+	translation(1, 3) = mYOrigin;
+	return modelview * translation;
 }
 
 //=============================================================================
 // Class:			Line
-// Function:		DoPrettyDraw
+// Function:		DoGLInitialization
 //
-// Description:		Draws a line strip using OpenGL triangles.
+// Description:		Creates the shader program for lines.
 //
 // Input Arguments:
-//		indexCount	= const unsigned int&
+//		None
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		None
+//		GLuint, index of the program
 //
 //=============================================================================
-void Line::DoPrettyDraw(const unsigned int& indexCount)
+GLuint Line::DoGLInitialization() const
 {
-	assert(indexCount > 0);
-	glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, 0);
+	std::vector<GLuint> shaderList;
+	shaderList.push_back(mRenderWindow.CreateShader(GL_VERTEX_SHADER, mVertexShader));
+	shaderList.push_back(mRenderWindow.CreateShader(GL_GEOMETRY_SHADER, mGeometryShader));
+	shaderList.push_back(mRenderWindow.CreateShader(GL_FRAGMENT_SHADER, mFragmentShader));
+
+	RenderWindow::ShaderInfo s;
+	s.programId = mRenderWindow.CreateProgram(shaderList);
+	s.needsModelview = false;
+	s.needsProjection = true;
+	s.uniformLocations[RenderWindow::mProjectionName] = glGetUniformLocation(s.programId, RenderWindow::mProjectionName.c_str());
+	s.uniformLocations[RenderWindow::mModelviewName] = glGetUniformLocation(s.programId, RenderWindow::mModelviewName.c_str());
+	s.uniformLocations[mHalfWidthName] = glGetUniformLocation(s.programId, mHalfWidthName.c_str());
+	s.uniformLocations[mFadeWidthName] = glGetUniformLocation(s.programId, mFadeWidthName.c_str());
+	s.uniformLocations[mPixelSizeName] = glGetUniformLocation(s.programId, mPixelSizeName.c_str());
+	s.uniformLocations[mLineColorName] = glGetUniformLocation(s.programId, mLineColorName.c_str());
+	s.uniformLocations[mFadeColorName] = glGetUniformLocation(s.programId, mFadeColorName.c_str());
 
 	assert(!RenderWindow::GLHasError());
+
+	return mRenderWindow.AddShader(s);
 }
 
 }// namespace LibPlot2D
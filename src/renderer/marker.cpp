@@ -0,0 +1,289 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  marker.cpp
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Object representing data point markers, drawn as instanced quads
+//        and shaped in the fragment shader.
+
+// GLEW headers
+#include <GL/glew.h>
+
+// Local headers
+#include "lp2d/renderer/marker.h"
+#include "lp2d/renderer/renderWindow.h"
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			Marker
+// Function:		Constant declarations
+//
+// Description:		Constant declarations for Marker class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const std::string Marker::mHalfSizeName("halfSize");
+const std::string Marker::mShapeName("shape");
+const std::string Marker::mMarkerColorName("markerColor");
+
+//=============================================================================
+// Class:			Marker
+// Function:		mVertexShader
+//
+// Description:		Vertex shader for markers.  Each instance is one point;
+//					the four vertices of the quad are generated from the
+//					vertex ID.  The quad extends one pixel beyond the marker
+//					to leave room for anti-aliasing.  Invalid (NaN or
+//					infinite) points are moved outside of the clip volume.
+//
+// Input Arguments:
+//		0	= position (per instance)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const std::string Marker::mVertexShader(
+	"#version 400\n"
+	"\n"
+	"uniform mat4 modelviewMatrix;\n"
+	"uniform mat4 projectionMatrix;\n"
+	"uniform float halfSize;\n"
+	"\n"
+	"layout(location = 0) in vec2 position;\n"
+	"\n"
+	"out vec2 offset;\n"
+	"\n"
+	"void main()\n"
+	"{\n"
+	"    vec2 corner = vec2((gl_VertexID & 1) == 0 ? -1.0 : 1.0,\n"
+	"        (gl_VertexID & 2) == 0 ? -1.0 : 1.0);\n"
+	"    offset = corner * (halfSize + 1.0);\n"
+	"\n"
+	"    vec2 center = (modelviewMatrix * vec4(position, 0.0, 1.0)).xy;\n"
+	"    if (any(isnan(center)) || any(isinf(center)))\n"
+	"        gl_Position = vec4(2.0, 2.0, 2.0, 1.0);\n"
+	"    else\n"
+	"        gl_Position = projectionMatrix * vec4(center + offset, 0.0, 1.0);\n"
+	"}\n"
+);
+
+//=============================================================================
+// Class:			Marker
+// Function:		mFragmentShader
+//
+// Description:		Fragment shader for markers.  Computes the distance from
+//					the edge of the selected shape (in pixels) and uses it to
+//					determine the coverage of each pixel.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		outputColor	= vec4
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const std::string Marker::mFragmentShader(
+	"#version 400\n"
+	"\n"
+	"uniform float halfSize;\n"
+	"uniform int shape;\n"
+	"uniform vec4 markerColor;\n"
+	"\n"
+	"in vec2 offset;\n"
+	"\n"
+	"out vec4 outputColor;\n"
+	"\n"
+	"float EdgeDistance(vec2 p)\n"
+	"{\n"
+	"    vec2 a = abs(p);\n"
+	"    if (shape == 1)// Circle\n"
+	"        return length(p) - halfSize;\n"
+	"    else if (shape == 2)// Diamond\n"
+	"        return (a.x + a.y - halfSize) * 0.7071;\n"
+	"    else if (shape == 3)// Triangle\n"
+	"        return max(a.x * 0.8660 + p.y * 0.5, -p.y) - 0.5 * halfSize;\n"
+	"    else if (shape == 4)// Plus\n"
+	"    {\n"
+	"        float arm = max(0.25 * halfSize, 0.5);\n"
+	"        return min(max(a.x - halfSize, a.y - arm), max(a.y - halfSize, a.x - arm));\n"
+	"    }\n"
+	"\n"
+	"    return max(a.x, a.y) - halfSize;// Square\n"
+	"}\n"
+	"\n"
+	"void main()\n"
+	"{\n"
+	"    float coverage = clamp(0.5 - EdgeDistance(offset), 0.0, 1.0);\n"
+	"    if (coverage == 0.0)\n"
+	"        discard;\n"
+	"    outputColor = vec4(markerColor.rgb, markerColor.a * coverage);\n"
+	"}\n"
+);
+
+//=============================================================================
+// Class:			Marker
+// Function:		Marker
+//
+// Description:		Constructor for Marker class.
+//
+// Input Arguments:
+//		renderWindow	= RenderWindow&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+Marker::Marker(RenderWindow& renderWindow) : mRenderWindow(renderWindow)
+{
+	SetSize(4.0);
+}
+
+//=============================================================================
+// Class:			Marker
+// Function:		Build
+//
+// Description:		Configures the vertex array to read one position per
+//					instance from the specified position buffer.
+//
+// Input Arguments:
+//		positions	= const Primitive::BufferInfo&
+//		firstPoint	= const unsigned int&
+//
+// Output Arguments:
+//		bufferInfo	= Primitive::BufferInfo&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void Marker::Build(const Primitive::BufferInfo& positions,
+	const unsigned int& firstPoint, Primitive::BufferInfo& bufferInfo) const
+{
+	mRenderWindow.InitializePrimitiveType(*this);
+	bufferInfo.GetOpenGLIndices();
+
+	const unsigned int dimension(mRenderWindow.GetVertexDimension());
+	assert(dimension == 2);
+
+	glBindVertexArray(bufferInfo.GetVertexArrayIndex());
+
+	glBindBuffer(GL_ARRAY_BUFFER, positions.GetVertexBufferIndex());
+	glEnableVertexAttribArray(mRenderWindow.GetDefaultPositionLocation());
+	glVertexAttribPointer(mRenderWindow.GetDefaultPositionLocation(),
+		dimension, GL_FLOAT, GL_FALSE, 0,
+		(void*)(sizeof(GLfloat) * dimension * firstPoint));
+	glVertexAttribDivisor(mRenderWindow.GetDefaultPositionLocation(), 1);
+
+	glBindVertexArray(0);
+
+	assert(!RenderWindow::GLHasError());
+}
+
+//=============================================================================
+// Class:			Marker
+// Function:		Draw
+//
+// Description:		Draws the markers configured with Build().
+//
+// Input Arguments:
+//		pointCount	= const unsigned int&
+//		modelview	= const Eigen::Matrix4d&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void Marker::Draw(const unsigned int& pointCount,
+	const Eigen::Matrix4d& modelview) const
+{
+	assert(pointCount > 0);
+	assert(mRenderWindow.IsPrimitiveTypeInitialized<Marker>());
+
+	mRenderWindow.UseProgram(mRenderWindow.GetPrimitiveTypeProgram<Marker>());
+	const auto& locations(mRenderWindow.GetActiveProgramInfo().uniformLocations);
+
+	RenderWindow::SendUniformMatrix(modelview,
+		locations.find(RenderWindow::mModelviewName)->second);
+	glUniform1f(locations.find(mHalfSizeName)->second,
+		static_cast<float>(mHalfSize));
+	glUniform1i(locations.find(mShapeName)->second, static_cast<int>(mShape));
+	glUniform4f(locations.find(mMarkerColorName)->second,
+		static_cast<float>(mColor.GetRed()),
+		static_cast<float>(mColor.GetGreen()),
+		static_cast<float>(mColor.GetBlue()),
+		static_cast<float>(mColor.GetAlpha()));
+
+	glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, pointCount);
+
+	mRenderWindow.UseDefaultProgram();
+
+	assert(!RenderWindow::GLHasError());
+}
+
+//=============================================================================
+// Class:			Marker
+// Function:		DoGLInitialization
+//
+// Description:		Creates the shader program for markers.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		GLuint, index of the program
+//
+//=============================================================================
+GLuint Marker::DoGLInitialization() const
+{
+	std::vector<GLuint> shaderList;
+	shaderList.push_back(mRenderWindow.CreateShader(GL_VERTEX_SHADER, mVertexShader));
+	shaderList.push_back(mRenderWindow.CreateShader(GL_FRAGMENT_SHADER, mFragmentShader));
+
+	RenderWindow::ShaderInfo s;
+	s.programId = mRenderWindow.CreateProgram(shaderList);
+	s.needsModelview = false;
+	s.needsProjection = true;
+	s.uniformLocations[RenderWindow::mProjectionName] = glGetUniformLocation(s.programId, RenderWindow::mProjectionName.c_str());
+	s.uniformLocations[RenderWindow::mModelviewName] = glGetUniformLocation(s.programId, RenderWindow::mModelviewName.c_str());
+	s.uniformLocations[mHalfSizeName] = glGetUniformLocation(s.programId, mHalfSizeName.c_str());
+	s.uniformLocations[mShapeName] = glGetUniformLocation(s.programId, mShapeName.c_str());
+	s.uniformLocations[mMarkerColorName] = glGetUniformLocation(s.programId, mMarkerColorName.c_str());
+
+	assert(!RenderWindow::GLHasError());
+
+	return mRenderWindow.AddShader(s);
+}
+
+}// namespace LibPlot2D
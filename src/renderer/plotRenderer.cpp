@@ -16,6 +16,7 @@
 #include <cassert>
 #include <algorithm>
 #include <fstream>
+#include <numeric>
 
 // GLEW headers
 #include <GL/glew.h>
@@ -36,6 +37,8 @@
 #include "lp2d/renderer/primitives/plotCursor.h"
 #include "lp2d/renderer/primitives/axis.h"
 #include "lp2d/renderer/primitives/legend.h"
+#include "lp2d/renderer/primitives/plotCurve.h"
+#include "lp2d/renderer/primitives/textRendering.h"
 #include "lp2d/utilities/math/plotMath.h"
 #include "lp2d/utilities/guiUtilities.h"
 
@@ -60,6 +63,8 @@ namespace LibPlot2D
 //=============================================================================
 const unsigned int PlotRenderer::mMaxXTicks(7);
 const unsigned int PlotRenderer::mMaxYTicks(10);
+const unsigned int PlotRenderer::mStatisticsOverlayLineCount(3);
+const double PlotRenderer::mStatisticsOverlayFontSize(12.0);// [pixels]
 
 //=============================================================================
 // Class:			PlotRenderer
@@ -220,6 +225,66 @@ END_EVENT_TABLE()
 //
 //=============================================================================
 void PlotRenderer::UpdateDisplay()
+{
+	PerformLayout();
+	Refresh();
+	Update();
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		UpdateLayout
+//
+// Description:		Performs the updates requested by mouse events since the
+//					last scheduled render.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::UpdateLayout()
+{
+	// PerformLayout() also updates the cursor values
+	if (mLayoutPending)
+	{
+		if (mInteractionPending)
+			ApplyInteractionQuality();
+		PerformLayout();
+	}
+	else if (mCursorValuesPending)
+	{
+		UpdateCursors();
+		mGuiInterface.UpdateCursorValues(GetLeftCursorVisible(),
+			GetRightCursorVisible(), GetLeftCursorValue(),
+			GetRightCursorValue());
+		mCursorValuesPending = false;
+	}
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		PerformLayout
+//
+// Description:		Updates the plot formatting and transformations to match
+//					the current data and axis limits.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::PerformLayout()
 {
 	if (GetXLogarithmic())
 		mXScaleFunction = DoLogarithmicScale;
@@ -236,9 +301,18 @@ void PlotRenderer::UpdateDisplay()
 	else
 		mRightYScaleFunction = DoLineaerScale;
 
+	FrameStatistics& statistics(GetFrameStatistics());
+	FrameStatistics::Clock::time_point start;
+	if (statistics.IsEnabled())
+		start = FrameStatistics::Clock::now();
+
 	mPlot->Update();
-	Refresh();
-	Update();
+
+	if (statistics.IsEnabled())
+		statistics.RecordPlotUpdate(FrameStatistics::Clock::now() - start);
+
+	mLayoutPending = false;
+	mCursorValuesPending = false;
 }
 
 //=============================================================================
@@ -302,6 +376,67 @@ void PlotRenderer::OnSize(wxSizeEvent &event)
 {
 	mIgnoreNextMouseMove = true;
 
+	ResizePlot();
+	UpdateDisplay();
+
+	// Skip this event so the base class OnSize event fires, too
+	event.Skip();
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		OnRenderSizeChanged
+//
+// Description:		Re-formats the plot to fit the render target when
+//					switching to or from an offscreen render.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::OnRenderSizeChanged()
+{
+	// Offscreen images are drawn with the quality specified for writing
+	mDraftCurves = false;
+	mPlot->SetDraftCurves(false);
+	if (IsRenderingOffscreen())
+		mPlot->SetPrettyCurves((mCurveQuality & CurveQuality::HighWrite) != 0);
+	else
+		mPlot->SetPrettyCurves((mCurveQuality & CurveQuality::HighStatic) != 0);
+
+	// The overlay describes the on-screen frames, so it is left out of images
+	for (auto& line : mStatisticsOverlay)
+		line->SetVisibility(mStatisticsOverlayVisible && !IsRenderingOffscreen());
+
+	ResizePlot();
+	PerformLayout();
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		ResizePlot
+//
+// Description:		Updates the objects which depend on the size of the
+//					render target.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::ResizePlot()
+{
 	if (mLeftCursor->GetIsVisible())
 		mLeftCursor->SetVisibility(true);
 	if (mRightCursor->GetIsVisible())
@@ -311,10 +446,6 @@ void PlotRenderer::OnSize(wxSizeEvent &event)
 		mLegend->SetModified();
 
 	mPlot->UpdatePlotAreaSize();
-	UpdateDisplay();
-
-	// Skip this event so the base class OnSize event fires, too
-	event.Skip();
 }
 
 //=============================================================================
@@ -366,6 +497,95 @@ void PlotRenderer::OnMouseWheelEvent(wxMouseEvent &event)
 	mPlot->SetRightYMin(mPlot->GetRightYMin() + yRightDelta);
 	mPlot->SetRightYMax(mPlot->GetRightYMax() - yRightDelta);
 
+	BeginInteraction();
+	ScheduleRender();
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		BeginInteraction
+//
+// Description:		Requests a layout update in response to panning or
+//					zooming and (re)starts the timer for detecting the end of
+//					the interaction.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::BeginInteraction()
+{
+	mLayoutPending = true;
+	mInteractionPending = true;
+
+	if ((mCurveQuality & CurveQuality::Adaptive) != 0)
+		mInteractionTimer.StartOnce(static_cast<int>(
+			mAdaptiveQualitySettings.idleDelay));
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		ApplyInteractionQuality
+//
+// Description:		Selects the curve quality for the next interactive frame.
+//					Once a frame exceeds the budget, draft curves are used
+//					until EndInteraction() is called.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::ApplyInteractionQuality()
+{
+	mInteractionPending = false;
+
+	if ((mCurveQuality & CurveQuality::Adaptive) != 0 && !mDraftCurves &&
+		GetLastFrameDuration().count() >
+		mAdaptiveQualitySettings.frameBudget * 1000.0)
+		mDraftCurves = true;
+
+	mPlot->SetPrettyCurves(!mDraftCurves &&
+		(mCurveQuality & CurveQuality::HighDrag) != 0);
+	mPlot->SetDraftCurves(mDraftCurves);
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		EndInteraction
+//
+// Description:		Called once panning and zooming have stopped.  If draft
+//					curves were used, re-draws them at full quality.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::EndInteraction()
+{
+	if (!mDraftCurves)
+		return;
+
+	mDraftCurves = false;
+	mPlot->SetDraftCurves(false);
+	mPlot->SetPrettyCurves((mCurveQuality & CurveQuality::HighStatic) != 0);
 	UpdateDisplay();
 }
 
@@ -406,6 +626,9 @@ void PlotRenderer::OnMouseMoveEvent(wxMouseEvent &event)
 		return;
 	}
 
+	// Moving the legend, cursors or zoom box doesn't change the rest of the
+	// plot, so we can skip re-formatting the plot
+	bool overlayOnly(true);
 	if (mDraggingLegend && mLegend)
 		mLegend->SetDeltaPosition(event.GetX() - mLastMousePosition[0], mLastMousePosition[1] - event.GetY());
 	else if (mDraggingLeftCursor)
@@ -414,22 +637,35 @@ void PlotRenderer::OnMouseMoveEvent(wxMouseEvent &event)
 		mRightCursor->SetLocation(event.GetX());
 	// ZOOM:  Left or Right mouse button + CTRL or SHIFT
 	else if ((event.ControlDown() || event.ShiftDown()) && (event.RightIsDown() || event.LeftIsDown()))
+	{
 		ProcessZoom(event);
+		overlayOnly = false;
+	}
 	// ZOOM WITH BOX: Right mouse button
 	else if (event.RightIsDown())
 		ProcessZoomWithBox(event);
 	// PAN:  Left mouse button (includes with any buttons not caught above)
 	else if (event.LeftIsDown())
+	{
 		ProcessPan(event);
+		overlayOnly = false;
+	}
 	else// Not recognized
 	{
 		StoreMousePosition(event);
 		return;
 	}
 
-	mPlot->SetPrettyCurves((mCurveQuality & CurveQuality::HighDrag) != 0);
 	StoreMousePosition(event);
-	UpdateDisplay();
+	if (overlayOnly)
+	{
+		if (mDraggingLeftCursor || mDraggingRightCursor)
+			mCursorValuesPending = true;
+	}
+	else
+		BeginInteraction();
+
+	ScheduleRender();
 }
 
 //=============================================================================
@@ -771,9 +1007,35 @@ void PlotRenderer::SetMinorGridOff()
 void PlotRenderer::SetCurveQuality(const CurveQuality& curveQuality)
 {
 	mCurveQuality = curveQuality;
+	mDraftCurves = false;
+	mPlot->SetDraftCurves(false);
 	mPlot->SetPrettyCurves((mCurveQuality & CurveQuality::HighStatic) != 0);
 }
 
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		SetAdaptiveQualitySettings
+//
+// Description:		Sets the thresholds used when the curve quality includes
+//					the Adaptive flag.
+//
+// Input Arguments:
+//		settings	= const AdaptiveQualitySettings&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::SetAdaptiveQualitySettings(
+	const AdaptiveQualitySettings& settings)
+{
+	assert(settings.frameBudget > 0.0);
+	mAdaptiveQualitySettings = settings;
+}
+
 //=============================================================================
 // Class:			PlotRenderer
 // Function:		LegendIsVisible
@@ -843,6 +1105,133 @@ void PlotRenderer::SetLegendOff()
 	mLegend->SetVisibility(false);
 }
 
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		SetStatisticsOverlayVisible
+//
+// Description:		Shows or hides the frame statistics overlay, creating it if
+//					necessary.
+//
+// Input Arguments:
+//		visible	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::SetStatisticsOverlayVisible(const bool& visible)
+{
+	mStatisticsOverlayVisible = visible;
+	if (visible)
+	{
+		GetFrameStatistics().SetEnabled(true);
+		if (mStatisticsOverlay.empty() && !mPlot->GetAxisFont().empty())
+		{
+			unsigned int i;
+			for (i = 0; i < mStatisticsOverlayLineCount; ++i)
+			{
+				TextRendering* line(new TextRendering(*this));
+				line->InitializeFonts(mPlot->GetAxisFont(),
+					mStatisticsOverlayFontSize);
+				line->SetColor(Color::ColorBlack);
+				line->SetIsOverlay(true);
+				mStatisticsOverlay.push_back(line);
+			}
+		}
+	}
+
+	for (auto& line : mStatisticsOverlay)
+		line->SetVisibility(visible);
+
+	ScheduleRender();
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		UpdateStatisticsOverlay
+//
+// Description:		Updates the overlay text to describe the previous frame.
+//					Called before each frame, so updating the text does not
+//					require an additional render.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::UpdateStatisticsOverlay()
+{
+	if (!mStatisticsOverlayVisible || mStatisticsOverlay.empty())
+		return;
+
+	const FrameStatistics& statistics(GetFrameStatistics());
+	const FrameStatistics::Frame& frame(statistics.GetLastFrame());
+	const RollingHistogram& frameTimes(
+		statistics.GetHistogram(FrameStatistics::Metric::FrameTime));
+
+	const std::vector<unsigned int> vertexCounts(GetCurveVertexCounts());
+	const unsigned long long curveVertexCount(std::accumulate(
+		vertexCounts.begin(), vertexCounts.end(), 0ULL));
+
+	mStatisticsOverlay[0]->SetText(wxString::Format(
+		_T("Frame %0.1f ms (median %0.1f, 95%% %0.1f, max %0.1f)"),
+		frame.frameTime, frameTimes.GetPercentile(0.5),
+		frameTimes.GetPercentile(0.95), frameTimes.GetMaximum()));
+	mStatisticsOverlay[1]->SetText(wxString::Format(
+		_T("Layout %0.1f, prepare %0.1f, update %0.1f, draw %0.1f ms"),
+		frame.plotUpdateTime, frame.prepareTime, frame.updateTime,
+		frame.drawTime));
+	mStatisticsOverlay[2]->SetText(wxString::Format(
+		_T("Uploaded %0.1f kB, %u vertices drawn, %u curves (%llu vertices)"),
+		frame.uploadBytes / 1024.0, frame.vertexCount,
+		static_cast<unsigned int>(vertexCounts.size()), curveVertexCount));
+
+	const unsigned int offset(5);
+	const double lineSpacing(1.5 * mStatisticsOverlayFontSize);
+	const double x(mPlot->GetLeftYAxis()->GetOffsetFromWindowEdge() + offset);
+	double y(GetSize().GetHeight()
+		- mPlot->GetTopAxis()->GetOffsetFromWindowEdge() - offset);
+	for (auto& line : mStatisticsOverlay)
+	{
+		y -= lineSpacing;
+		line->SetPosition(x, y);
+	}
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		GetCurveVertexCounts
+//
+// Description:		Returns the number of vertices used to draw each curve.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<unsigned int>
+//
+//=============================================================================
+std::vector<unsigned int> PlotRenderer::GetCurveVertexCounts() const
+{
+	std::vector<unsigned int> counts(mPlot->GetCurveCount());
+	unsigned int i;
+	for (i = 0; i < counts.size(); ++i)
+		counts[i] = mPlot->GetCurve(i).GetVertexCount();
+
+	return counts;
+}
+
 //=============================================================================
 // Class:			PlotRenderer
 // Function:		UpdateLegend
@@ -2478,14 +2867,13 @@ void PlotRenderer::PanBottomXAxis(wxMouseEvent &event)
 
 	if (mPlot->GetBottomAxis()->IsLogarithmic())
 	{
-		const int pixelDelta(event.GetX() - mLastMousePosition[0]);
-		mPlot->SetXMin(mPlot->GetBottomAxis()->PixelToValue(
-			static_cast<int>(mPlot->GetLeftYAxis()->GetOffsetFromWindowEdge())
-			- pixelDelta));
-		mPlot->SetXMax(mPlot->GetBottomAxis()->PixelToValue(
-			GetSize().GetWidth()
-			- static_cast<int>(mPlot->GetRightYAxis()->GetOffsetFromWindowEdge())
-			- pixelDelta));
+		// Computed from the plot limits rather than the axis so that several
+		// moves may be processed between layout updates
+		const double decadeDelta((log10(mPlot->GetXMax())
+			- log10(mPlot->GetXMin()))
+			* (event.GetX() - mLastMousePosition[0]) / width);
+		mPlot->SetXMin(mPlot->GetXMin() * pow(10.0, -decadeDelta));
+		mPlot->SetXMax(mPlot->GetXMax() * pow(10.0, -decadeDelta));
 	}
 	else
 	{
@@ -2520,14 +2908,11 @@ void PlotRenderer::PanLeftYAxis(wxMouseEvent &event)
 
 	if (mPlot->GetLeftYAxis()->IsLogarithmic())
 	{
-		const int pixelDelta(event.GetY() - mLastMousePosition[1]);
-		mPlot->SetLeftYMin(mPlot->GetLeftYAxis()->PixelToValue(
-			static_cast<int>(mPlot->GetBottomAxis()->GetOffsetFromWindowEdge())
-			+ pixelDelta));
-		mPlot->SetLeftYMax(mPlot->GetLeftYAxis()->PixelToValue(
-			GetSize().GetHeight()
-			- static_cast<int>(mPlot->GetTopAxis()->GetOffsetFromWindowEdge())
-			+ pixelDelta));
+		const double decadeDelta((log10(mPlot->GetLeftYMax())
+			- log10(mPlot->GetLeftYMin()))
+			* (event.GetY() - mLastMousePosition[1]) / height);
+		mPlot->SetLeftYMin(mPlot->GetLeftYMin() * pow(10.0, decadeDelta));
+		mPlot->SetLeftYMax(mPlot->GetLeftYMax() * pow(10.0, decadeDelta));
 	}
 	else
 	{
@@ -2562,14 +2947,11 @@ void PlotRenderer::PanRightYAxis(wxMouseEvent &event)
 
 	if (mPlot->GetRightYAxis()->IsLogarithmic())
 	{
-		const int pixelDelta(event.GetY() - mLastMousePosition[1]);
-		mPlot->SetRightYMin(mPlot->GetRightYAxis()->PixelToValue(
-			static_cast<int>(mPlot->GetBottomAxis()->GetOffsetFromWindowEdge())
-			+ pixelDelta));
-		mPlot->SetRightYMax(mPlot->GetRightYAxis()->PixelToValue(
-			GetSize().GetHeight()
-			- static_cast<int>(mPlot->GetTopAxis()->GetOffsetFromWindowEdge())
-			+ pixelDelta));
+		const double decadeDelta((log10(mPlot->GetRightYMax())
+			- log10(mPlot->GetRightYMin()))
+			* (event.GetY() - mLastMousePosition[1]) / height);
+		mPlot->SetRightYMin(mPlot->GetRightYMin() * pow(10.0, decadeDelta));
+		mPlot->SetRightYMax(mPlot->GetRightYMax() * pow(10.0, decadeDelta));
 	}
 	else
 	{
@@ -2974,9 +3356,9 @@ double PlotRenderer::ComputeTickSpacing(const double &min, const double &max,
 
 //=============================================================================
 // Class:			PlotRenderer
-// Function:		GetImage
+// Function:		GetTotalPointCount
 //
-// Description:		Returns a copy of the current image.
+// Description:		Returns total number of points stored in plot curves.
 //
 // Input Arguments:
 //		None
@@ -2985,46 +3367,40 @@ double PlotRenderer::ComputeTickSpacing(const double &min, const double &max,
 //		None
 //
 // Return Value:
-//		wxImage
+//		unsigned long long
 //
 //=============================================================================
-wxImage PlotRenderer::GetImage() const
+unsigned long long PlotRenderer::GetTotalPointCount() const
 {
-	mPlot->SetPrettyCurves((mCurveQuality & CurveQuality::HighWrite) != 0);
-	if (((mCurveQuality & CurveQuality::HighStatic) != 0) != ((mCurveQuality & CurveQuality::HighWrite) != 0))
-		{/*UpdateDisplay();*/}// TODO:  Can't call from const method, so HighQualityWrite flag currently doesn't work
-
-	wxImage newImage(RenderWindow::GetImage());
-	mPlot->SetPrettyCurves((mCurveQuality & CurveQuality::HighStatic) != 0);
-	return newImage;
+	return mPlot->GetTotalPointCount();
 }
 
 //=============================================================================
 // Class:			PlotRenderer
-// Function:		GetTotalPointCount
+// Function:		LoadModelviewUniform
 //
-// Description:		Returns total number of points stored in plot curves.
+// Description:		Loads the specified modelview matrix to the openGL uniform.
 //
 // Input Arguments:
-//		None
+//		mv	= const Modelview&
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		unsigned long long
+//		None
 //
 //=============================================================================
-unsigned long long PlotRenderer::GetTotalPointCount() const
+void PlotRenderer::LoadModelviewUniform(const Modelview& mv)
 {
-	return mPlot->GetTotalPointCount();
+	SendUniformMatrix(GetModelview(mv), GetActiveProgramInfo().uniformLocations.find(mModelviewName)->second);
 }
 
 //=============================================================================
 // Class:			PlotRenderer
-// Function:		LoadModelviewUniform
+// Function:		GetModelview
 //
-// Description:		Loads the specified modelview matrix to the openGL uniform.
+// Description:		Returns the specified modelview matrix.
 //
 // Input Arguments:
 //		mv	= const Modelview&
@@ -3033,29 +3409,23 @@ unsigned long long PlotRenderer::GetTotalPointCount() const
 //		None
 //
 // Return Value:
-//		None
+//		const Eigen::Matrix4d&
 //
 //=============================================================================
-void PlotRenderer::LoadModelviewUniform(const Modelview& mv)
+const Eigen::Matrix4d& PlotRenderer::GetModelview(const Modelview& mv) const
 {
-	float glModelviewMatrix[16];
-
 	switch(mv)
 	{
 	case Modelview::Left:
-		ConvertMatrixToGL(mLeftModelview, glModelviewMatrix);
-		break;
+		return mLeftModelview;
 
 	case Modelview::Right:
-		ConvertMatrixToGL(mRightModelview, glModelviewMatrix);
-		break;
+		return mRightModelview;
 
 	default:
 	case Modelview::Fixed:
-		ConvertMatrixToGL(mModelviewMatrix, glModelviewMatrix);
+		return mModelviewMatrix;
 	}
-
-	glUniformMatrix4fv(mShaders[0].uniformLocations[mModelviewName], 1, GL_FALSE, glModelviewMatrix);
 }
 
 //=============================================================================
@@ -3084,7 +3454,8 @@ void PlotRenderer::ContextWriteImageFile(wxCommandEvent& WXUNUSED(event))
 	if (pathAndFileName.IsEmpty())
 		return;
 
-	WriteImageToFile(pathAndFileName[0]);
+	WriteImageToFile(pathAndFileName[0], GetSize().GetWidth(),
+		GetSize().GetHeight());
 }
 
 //=============================================================================
@@ -4046,7 +4417,7 @@ void PlotRenderer::DoCopy()
 	wxInitAllImageHandlers();
 	if (wxTheClipboard->Open())
 	{
-		wxTheClipboard->SetData(new wxBitmapDataObject(GetImage()));
+		wxTheClipboard->SetData(new wxBitmapDataObject(RenderImage()));
 		wxTheClipboard->Close();
 	}
 }
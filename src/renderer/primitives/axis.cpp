@@ -99,6 +99,9 @@ void Axis::Update(const unsigned int& i)
 		DrawAxisLabel();
 		mBufferInfo[i] = mLabelText.BuildText();
 	}
+
+	// Also covers the text buffers when no font is available
+	mBufferInfo[i].vertexCountModified = false;
 }
 
 //=============================================================================
@@ -121,17 +124,19 @@ void Axis::Update(const unsigned int& i)
 void Axis::GenerateGeometry()
 {
 	// Draw gridlines first
-	if ((mMajorGrid || mMinorGrid) && mBufferInfo[1].indexBuffer.size() > 0)
+	if ((mMajorGrid || mMinorGrid) && mBufferInfo[1].vertexCount > 0)
 	{
 		glBindVertexArray(mBufferInfo[1].GetVertexArrayIndex());
-		Line::DoPrettyDraw(mBufferInfo[1].indexBuffer.size());
+		mGridLines.DrawSegments(mBufferInfo[1].vertexCount,
+			mRenderWindow.GetModelviewMatrix());
 	}
 
 	// Axis and ticks next
 	if (mBufferInfo[0].vertexCount > 0)
 	{
 		glBindVertexArray(mBufferInfo[0].GetVertexArrayIndex());
-		Line::DoPrettyDraw(mBufferInfo[0].indexBuffer.size());
+		mAxisLines.DrawSegments(mBufferInfo[0].vertexCount,
+			mRenderWindow.GetModelviewMatrix());
 	}
 
 	if (mValueText.IsOK() && mBufferInfo[2].vertexCount > 0)
@@ -549,7 +554,7 @@ void Axis::DrawAxisLabel()
 	const double edgeOffset(GetAxisLabelTranslation(fontOffsetFromWindowEdge,
 		boundingBox.yUp));
 
-	boundingBox = mLabelText.GetBoundingBox(mLabel.ToStdString());
+	boundingBox = mLabelText.GetBoundingBox(mLabel.ToUTF8().data());
 	const double textWidth = boundingBox.xRight - boundingBox.xLeft;
 	const double plotOffset = static_cast<double>(mMinAxis->GetOffsetFromWindowEdge())
 		- static_cast<double>(mMaxAxis->GetOffsetFromWindowEdge());
@@ -564,7 +569,7 @@ void Axis::DrawAxisLabel()
 			- textWidth + plotOffset), -edgeOffset);
 	}
 
-	mLabelText.SetText(mLabel.ToStdString());
+	mLabelText.SetText(mLabel.ToUTF8().data());
 }
 
 //=============================================================================
@@ -636,7 +641,13 @@ void Axis::DrawTickLabels()
 
 	mMinimum = GetPrecisionLimitedMinimum();
 
-	wxString valueLabel;
+	if (precision != mTickLabelPrecision)
+	{
+		mTickLabels.clear();
+		mTickLabelPrecision = precision;
+	}
+
+	std::map<double, std::string> labels;
 	double valueOffsetFromEdge = mOffsetFromWindowEdge * 0.8;
 	unsigned int tick, numberOfTicks;
 	ComputeGridAndTickCounts(numberOfTicks);
@@ -644,19 +655,53 @@ void Axis::DrawTickLabels()
 	{
 		double value(std::min(GetNextTickValue(tick == 0,
 			tick == numberOfTicks + 1, tick), mMaximum));
-		valueLabel.Printf("%0.*f", precision, value);
+		const std::string& valueLabel(GetTickLabel(value, labels));
 
 		// TODO:  Don't draw it if it's too close to the maximum (based on text size)
 		ComputeTranslations(value, xTranslation, yTranslation,
-			mValueText.GetBoundingBox(valueLabel.ToStdString()),
-			valueOffsetFromEdge);
+			mValueText.GetBoundingBox(valueLabel), valueOffsetFromEdge);
 		mValueText.SetPosition(xTranslation, yTranslation);
-		mValueText.AppendText(valueLabel.ToStdString());
+		mValueText.AppendText(valueLabel);
 	}
 
+	// Only retain the labels which are currently in use
+	mTickLabels = std::move(labels);
+
 	mMaximum = GetPrecisionLimitedMaximum();
 }
 
+//=============================================================================
+// Class:			Axis
+// Function:		GetTickLabel
+//
+// Description:		Returns the formatted label for the specified tick value.
+//					Labels from the previous update are re-used if possible.
+//
+// Input Arguments:
+//		value	= const double&
+//
+// Output Arguments:
+//		labels	= std::map<double, std::string>& to which the label is added
+//
+// Return Value:
+//		const std::string&
+//
+//=============================================================================
+const std::string& Axis::GetTickLabel(const double& value,
+	std::map<double, std::string>& labels) const
+{
+	const auto it(labels.find(value));
+	if (it != labels.end())
+		return it->second;
+
+	const auto previous(mTickLabels.find(value));
+	if (previous != mTickLabels.end())
+		return labels.insert(*previous).first->second;
+
+	return labels.insert(std::make_pair(value, std::string(wxString::Format(
+		"%0.*f", mTickLabelPrecision, value).ToUTF8().data()))).first->second;
+}
+
 //=============================================================================
 // Class:			Axis
 // Function:		GetPrecisionLimitedMinimum
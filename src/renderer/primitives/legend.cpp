@@ -17,6 +17,7 @@
 // Local headers
 #include "lp2d/renderer/primitives/legend.h"
 #include "lp2d/renderer/renderWindow.h"
+#include "lp2d/utilities/trace.h"
 
 namespace LibPlot2D
 {
@@ -59,6 +60,7 @@ Legend::Legend(RenderWindow &mRenderWindow) : Primitive(mRenderWindow),
 	mText(mRenderWindow), mLines(mRenderWindow)
 {
 	SetDrawOrder(3000);// Draw this last
+	SetIsOverlay(true);
 	mBufferInfo.push_back(BufferInfo());// Text
 }
 
@@ -83,7 +85,10 @@ void Legend::Update(const unsigned int& i)
 	// TODO:  Alternative approach is to only update if mEntries change
 	// and to use local modelview to handle position changes.
 	if (!mText.IsOK())
+	{
+		mBufferInfo[i].vertexCountModified = false;
 		return;
+	}
 
 	if (i == 0)// Background, border, mLines and markers
 	{
@@ -93,18 +98,13 @@ void Legend::Update(const unsigned int& i)
 		UpdateBoundingBox();
 
 		mBufferVector.push_back(BuildBackground());
+		mBufferInfo[i] = AssembleBuffers();
 
-		mLines.SetWidth(mBorderSize);
-		mLines.SetLineColor(mBorderColor);
-		mLines.SetBackgroundColorForAlphaFade();
-		mBufferVector.push_back(BufferInfo());
-		mLines.Build(BuildBorderPoints(), mBufferVector.back(),
-			Line::UpdateMethod::Manual);
-
+		mLines.Build(BuildBorderPoints(), mBorderBuffer);
 		BuildSampleLines();
-		BuildMarkers();
 
-		mBufferInfo[i] = AssembleBuffers();
+		BuildMarkers();
+		mMarkerBuffer = AssembleBuffers();
 	}
 	else if (i == 1)// Text
 	{
@@ -136,14 +136,46 @@ void Legend::Update(const unsigned int& i)
 void Legend::GenerateGeometry()
 {
 	// Background, border, mLines and markers first
-	// We can use the Line::DoPrettyDraw to render the background and markers
-	// even though they aren't mLines because DoPrettyDraw renders triangle
-	// elements.  We only need to ensure that the additional triangles are
-	// intended to be built as elements of the index array.
 	if (mBufferInfo[0].vertexCount > 0)
 	{
 		glBindVertexArray(mBufferInfo[0].GetVertexArrayIndex());
-		Line::DoPrettyDraw(mBufferInfo[0].indexBuffer.size());
+		glDrawElements(GL_TRIANGLES, mBufferInfo[0].indexBuffer.size(),
+			GL_UNSIGNED_INT, 0);
+	}
+
+	// Line width and color are applied when drawing, so all of the lines
+	// share one Line object
+	if (mBorderBuffer.vertexCount > 0)
+	{
+		mLines.SetWidth(mBorderSize);
+		mLines.SetLineColor(mBorderColor);
+		mLines.SetBackgroundColorForAlphaFade();
+
+		glBindVertexArray(mBorderBuffer.GetVertexArrayIndex());
+		mLines.Draw(mBorderBuffer.vertexCount,
+			mRenderWindow.GetModelviewMatrix());
+	}
+
+	unsigned int i;
+	for (i = 0; i < mSampleLineBuffers.size() && i < mEntries.size(); ++i)
+	{
+		if (mSampleLineBuffers[i].vertexCount == 0)
+			continue;
+
+		mLines.SetWidth(mEntries[i].lineSize);
+		mLines.SetLineColor(mEntries[i].color);
+		mLines.SetBackgroundColorForAlphaFade();
+
+		glBindVertexArray(mSampleLineBuffers[i].GetVertexArrayIndex());
+		mLines.Draw(mSampleLineBuffers[i].vertexCount,
+			mRenderWindow.GetModelviewMatrix());
+	}
+
+	if (mMarkerBuffer.vertexCount > 0)
+	{
+		glBindVertexArray(mMarkerBuffer.GetVertexArrayIndex());
+		glDrawElements(GL_TRIANGLES, mMarkerBuffer.indexBuffer.size(),
+			GL_UNSIGNED_INT, 0);
 	}
 
 	// Text last
@@ -232,7 +264,7 @@ void Legend::UpdateBoundingBox()
 	unsigned int maxStringWidth(0);
 	for (const auto& entry : mEntries)
 	{
-		boundingBox = mText.GetBoundingBox(entry.text.ToStdString());
+		boundingBox = mText.GetBoundingBox(entry.text.ToUTF8().data());
 		if (boundingBox.xRight > static_cast<int>(maxStringWidth))
 			maxStringWidth = boundingBox.xRight;
 	}
@@ -990,8 +1022,7 @@ Primitive::BufferInfo Legend::AssembleBuffers()
 // Class:			Legend
 // Function:		BuildSampleLines
 //
-// Description:		Appends mLines corresponding to the legend mEntries to the
-//					buffer vector.
+// Description:		Builds the mLines corresponding to the legend mEntries.
 //
 // Input Arguments:
 //		None
@@ -1012,17 +1043,13 @@ void Legend::BuildSampleLines()
 
 	y += mHeight + lineYOffset;
 
-	for (const auto& entry : mEntries)
+	mSampleLineBuffers.resize(mEntries.size());
+	unsigned int i;
+	for (i = 0; i < mEntries.size(); ++i)
 	{
-		mLines.SetLineColor(entry.color);
-		mLines.SetBackgroundColorForAlphaFade();
-		mLines.SetWidth(entry.lineSize);
-
 		y -= mEntrySpacing + mTextHeight;
-
-		mBufferVector.push_back(BufferInfo());
 		mLines.Build(x + mEntrySpacing, y, x + mEntrySpacing + mSampleLength,
-			y, mBufferVector.back(), Line::UpdateMethod::Manual);
+			y, mSampleLineBuffers[i]);
 	}
 }
 
@@ -1044,6 +1071,8 @@ void Legend::BuildSampleLines()
 //=============================================================================
 void Legend::ConfigureVertexArray(Primitive::BufferInfo& bufferInfo) const
 {
+	LP2D_TRACE_SCOPE("gl", "Legend::ConfigureVertexArray");
+
 	bufferInfo.GetOpenGLIndices(true);
 	glBindVertexArray(bufferInfo.GetVertexArrayIndex());
 
@@ -1062,6 +1091,9 @@ void Legend::ConfigureVertexArray(Primitive::BufferInfo& bufferInfo) const
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufferInfo.GetIndexBufferIndex());
 	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * bufferInfo.indexBuffer.size(),
 		bufferInfo.indexBuffer.data(), GL_DYNAMIC_DRAW);
+	mRenderWindow.GetFrameStatistics().RecordUpload(
+		sizeof(GLfloat) * bufferInfo.vertexBuffer.size()
+		+ sizeof(GLuint) * bufferInfo.indexBuffer.size());
 
 	glBindVertexArray(0);
 }
@@ -1092,7 +1124,7 @@ void Legend::BuildLabelStrings()
 	{
 		y -= mEntrySpacing + mTextHeight;
 		mText.SetPosition(x + 2 * mEntrySpacing + mSampleLength, y);
-		mText.AppendText(entry.text.ToStdString());
+		mText.AppendText(entry.text.ToUTF8().data());
 	}
 }
 
@@ -47,6 +47,7 @@ PlotCursor::PlotCursor(RenderWindow &mRenderWindow, const Axis &axis)
 	mLine.SetLineColor(mColor);
 
 	SetDrawOrder(2800);
+	SetIsOverlay(true);
 }
 
 //=============================================================================
@@ -124,11 +125,11 @@ void PlotCursor::Recalculate()
 //=============================================================================
 void PlotCursor::GenerateGeometry()
 {
-	if (mBufferInfo.size() == 0)
+	if (mBufferInfo.size() == 0 || mBufferInfo[0].vertexCount == 0)
 		return;
 
 	glBindVertexArray(mBufferInfo[0].GetVertexArrayIndex());
-	Line::DoPrettyDraw(mBufferInfo[0].indexBuffer.size());
+	mLine.Draw(mBufferInfo[0].vertexCount, mRenderWindow.GetModelviewMatrix());
 	glBindVertexArray(0);
 }
 
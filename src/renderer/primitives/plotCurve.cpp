@@ -21,19 +21,24 @@
 #include "lp2d/renderer/primitives/axis.h"
 #include "lp2d/utilities/dataset2D.h"
 #include "lp2d/utilities/math/plotMath.h"
+#include "lp2d/utilities/threadPool.h"
+#include "lp2d/utilities/trace.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <cmath>
 
 namespace LibPlot2D
 {
 
 //=============================================================================
 // Class:			PlotCurve
-// Function:		PlotCurve
+// Function:		Constant declarations
 //
-// Description:		Constructor for the PlotCurve class.
+// Description:		Constant declarations for PlotCurve class.
 //
 // Input Arguments:
-//		renderWindow	= RenderWindow* pointing to the object that owns this
-//		data			= const Dataset2D&
+//		None
 //
 // Output Arguments:
 //		None
@@ -42,21 +47,20 @@ namespace LibPlot2D
 //		None
 //
 //=============================================================================
-PlotCurve::PlotCurve(RenderWindow &renderWindow, const Dataset2D& data)
-	: Primitive(renderWindow), mData(data), mLine(renderWindow)
-{
-	mLine.SetBufferHint(GL_STATIC_DRAW);
-	mBufferInfo.resize(2);// First one for lines, second one for the markers
-}
+const unsigned int PlotCurve::mDecimationThreshold(4);
+const unsigned int PlotCurve::mDecimationOversampling(2);
+const unsigned int PlotCurve::mDraftDecimationFactor(4);
+const unsigned int PlotCurve::mParallelChunkSize(65536);// [points]
 
 //=============================================================================
 // Class:			PlotCurve
 // Function:		PlotCurve
 //
-// Description:		Copy constructor for the PlotCurve class.
+// Description:		Constructor for the PlotCurve class.
 //
 // Input Arguments:
-//		plotCurve	= const PlotCurve& to copy to this object
+//		renderWindow	= RenderWindow* pointing to the object that owns this
+//		data			= const Dataset2D&
 //
 // Output Arguments:
 //		None
@@ -65,20 +69,22 @@ PlotCurve::PlotCurve(RenderWindow &renderWindow, const Dataset2D& data)
 //		None
 //
 //=============================================================================
-PlotCurve::PlotCurve(const PlotCurve &plotCurve) : Primitive(plotCurve),
-	mData(plotCurve.mData), mLine(mRenderWindow)
+PlotCurve::PlotCurve(RenderWindow &renderWindow, const Dataset2D& data)
+	: Primitive(renderWindow), mData(data), mLine(renderWindow),
+	mMarker(renderWindow)
 {
-	*this = plotCurve;
+	mLine.SetBufferHint(GL_STATIC_DRAW);
+	mBufferInfo.resize(2);// First one for lines, second one for the markers
 }
 
 //=============================================================================
 // Class:			PlotCurve
-// Function:		InitializeMarkerVertexBuffer
+// Function:		PlotCurve
 //
-// Description:		Initializes the vertex buffer for storing the marker information.
+// Description:		Copy constructor for the PlotCurve class.
 //
 // Input Arguments:
-//		i	= const unsigned int&
+//		plotCurve	= const PlotCurve& to copy to this object
 //
 // Output Arguments:
 //		None
@@ -87,16 +93,10 @@ PlotCurve::PlotCurve(const PlotCurve &plotCurve) : Primitive(plotCurve),
 //		None
 //
 //=============================================================================
-void PlotCurve::InitializeMarkerVertexBuffer()
+PlotCurve::PlotCurve(const PlotCurve &plotCurve) : Primitive(plotCurve),
+	mData(plotCurve.mData), mLine(mRenderWindow), mMarker(mRenderWindow)
 {
-	mBufferInfo[1].GetOpenGLIndices();
-
-	mBufferInfo[1].vertexCount = mData.GetNumberOfPoints() * 6;
-	mBufferInfo[1].vertexBuffer.resize(mBufferInfo[1].vertexCount
-		* (mRenderWindow.GetVertexDimension() + 4));
-	assert(mRenderWindow.GetVertexDimension() == 2);
-
-	mBufferInfo[1].vertexCountModified = false;
+	*this = plotCurve;
 }
 
 //=============================================================================
@@ -119,23 +119,6 @@ void PlotCurve::Update(const unsigned int& i)
 {
 	if (i == 0)
 	{
-		int width, height;
-		mRenderWindow.GetSize(&width, &height);
-		width -= mYAxis->GetOffsetFromWindowEdge()
-			+ mYAxis->GetOppositeAxis()->GetOffsetFromWindowEdge();
-		height -= mXAxis->GetOffsetFromWindowEdge()
-			+ mXAxis->GetOppositeAxis()->GetOffsetFromWindowEdge();
-
-		if (mXAxis->IsLogarithmic())
-			mXScale = (log10(mXAxis->GetMaximum()) - log10(mXAxis->GetMinimum())) / width;
-		else
-			mXScale = (mXAxis->GetMaximum() - mXAxis->GetMinimum()) / width;
-
-		if (mYAxis->IsLogarithmic())
-			mYScale = (log10(mYAxis->GetMaximum()) - log10(mYAxis->GetMinimum())) / height;
-		else
-			mYScale = (mYAxis->GetMaximum() - mYAxis->GetMinimum()) / height;
-
 		if (mLineSize > 0.0)
 		{
 			const double lineSizeScale(1.2);
@@ -143,79 +126,204 @@ void PlotCurve::Update(const unsigned int& i)
 			mLine.SetLineColor(mColor);
 			mLine.SetBackgroundColorForAlphaFade();
 			mLine.SetWidth(mLineSize * lineSizeScale);
-			mLine.SetXScale(mXScale);
-			mLine.SetYScale(mYScale);
+		}
+		else
+			mLine.SetWidth(0.0);
 
-			std::vector<double> xLogData;
-			std::vector<double> yLogData;
-			const std::vector<double>& xRef([this, &xLogData]()
+		if (mLinePrepared)
+		{
+			mLinePrepared = false;
+			if (mBufferInfo[0].vertexCount > 0)
+				mLine.Upload(mBufferInfo[0]);
+		}
+		// The markers are drawn from the line buffer, too
+		else if (mLineSize > 0.0 || NeedsMarkersDrawn())
+		{
+			const unsigned int columns(GetPlotAreaColumns());
+			if (!LineGeometryIsCurrent(columns))
 			{
-				if (mXAxis->IsLogarithmic())
-				{
-					xLogData = std::move(DoLogarithmicScale(mData.GetX()));
-					return xLogData;
-				}
+				if (LineCanBeAppended(columns))
+					AppendLine();
 				else
-					return mData.GetX();
-			}());
-
-			const std::vector<double>& yRef([this, &yLogData]()
-			{
-				if (mYAxis->IsLogarithmic())
 				{
-					yLogData = std::move(DoLogarithmicScale(mData.GetY()));
-					return yLogData;
+					PrepareLine(columns, MarkersAreDrawn());
+					if (mBufferInfo[0].vertexCount > 0)
+						mLine.Upload(mBufferInfo[0]);
 				}
-				else
-					return mData.GetY();
-			}());
-
-			mLine.Build(xRef, yRef, mBufferInfo[i]);
+			}
 		}
-		else
-			mLine.SetWidth(0.0);
 	}
 	else
 	{
-		if (mBufferInfo[i].vertexCountModified)
-			InitializeMarkerVertexBuffer();
+		// The first and last points in the line buffer are repeated for
+		// adjacency; skip the first
+		mBufferInfo[i].vertexCountModified = false;
+		if (!MarkersAreDrawn() || mBufferInfo[0].vertexCount == 0)
+		{
+			mBufferInfo[i].vertexCount = 0;
+			return;
+		}
 
-		BuildMarkers();
+		mMarker.Build(mBufferInfo[0], 1, mBufferInfo[i]);
+		mBufferInfo[i].vertexCount = mBufferInfo[0].vertexCount - 2;
+	}
 
-		glBindVertexArray(mBufferInfo[i].GetVertexArrayIndex());
+	assert(!RenderWindow::GLHasError());
+}
 
-		glBindBuffer(GL_ARRAY_BUFFER, mBufferInfo[i].GetVertexBufferIndex());
-		glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * mBufferInfo[i].vertexBuffer.size(),
-			mBufferInfo[i].vertexBuffer.data(), GL_DYNAMIC_DRAW);
+//=============================================================================
+// Class:			PlotCurve
+// Function:		BeginPrepareUpdate
+//
+// Description:		Checks to see if the line buffer must be re-built during
+//					the next update.  If so, the work is done in
+//					PrepareUpdate() (possibly in parallel with other curves)
+//					and only the upload is done in Update().
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if PrepareUpdate() should be called
+//
+//=============================================================================
+bool PlotCurve::BeginPrepareUpdate()
+{
+	if ((!mModified && !mBufferInfo[0].vertexCountModified) ||
+		(mLineSize <= 0.0 && !NeedsMarkersDrawn()))
+		return false;
 
-		glEnableVertexAttribArray(mRenderWindow.GetDefaultPositionLocation());
-		glVertexAttribPointer(mRenderWindow.GetDefaultPositionLocation(), 2, GL_FLOAT, GL_FALSE, 0, 0);
+	mPrepareColumns = GetPlotAreaColumns();
+	mPrepareMarkers = MarkersAreDrawn();
+	return !LineGeometryIsCurrent(mPrepareColumns) &&
+		!LineCanBeAppended(mPrepareColumns);
+}
 
-		glEnableVertexAttribArray(mRenderWindow.GetDefaultColorLocation());
-		glVertexAttribPointer(mRenderWindow.GetDefaultColorLocation(), 4, GL_FLOAT, GL_FALSE, 0,
-			(void*)(sizeof(GLfloat) * mRenderWindow.GetVertexDimension() * mBufferInfo[i].vertexCount));
+//=============================================================================
+// Class:			PlotCurve
+// Function:		PrepareUpdate
+//
+// Description:		Fills the line buffer (no OpenGL calls).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurve::PrepareUpdate()
+{
+	LP2D_TRACE_SCOPE("geometry", "PlotCurve::PrepareUpdate");
 
-		/*glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mBufferInfo[i].indexBufferIndex);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * mBufferInfo[i].indexBuffer.size(),
-			mBufferInfo[i].indexBuffer.data(), GL_DYNAMIC_DRAW);*/
-		// TODO:  Why doesn't this work?  Similar code worked just fine before switching to std::vector
+	PrepareLine(mPrepareColumns, mPrepareMarkers);
+	mLinePrepared = true;
+}
 
-		glBindVertexArray(0);
-	}
+//=============================================================================
+// Class:			PlotCurve
+// Function:		GetPlotAreaColumns
+//
+// Description:		Gets the width of the plot area.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int, width of the plot area [pixels]
+//
+//=============================================================================
+unsigned int PlotCurve::GetPlotAreaColumns() const
+{
+	int width, height;
+	mRenderWindow.GetSize(&width, &height);
+	width -= mYAxis->GetOffsetFromWindowEdge()
+		+ mYAxis->GetOppositeAxis()->GetOffsetFromWindowEdge();
 
-	assert(!RenderWindow::GLHasError());
+	return static_cast<unsigned int>(std::max(width, 1));
 }
 
 //=============================================================================
 // Class:			PlotCurve
-// Function:		GenerateGeometry
+// Function:		LineGeometryIsCurrent
 //
-// Description:		Creates the OpenGL instructions to create this object in
-//					the scene.
+// Description:		Checks to see if the line buffer can be used to draw the
+//					curve with the current data and axis limits.
 //
 // Input Arguments:
+//		columns	= const unsigned int& width of the plot area [pixels]
+//
+// Output Arguments:
 //		None
 //
+// Return Value:
+//		bool, true if the line buffer does not need to be re-built
+//
+//=============================================================================
+bool PlotCurve::LineGeometryIsCurrent(const unsigned int& columns) const
+{
+	if (!mLineGeometry.valid ||
+		mLineGeometry.pointCount != mData.GetNumberOfPoints() ||
+		mLineGeometry.revision != mData.GetRevision() ||
+		mLineGeometry.markers != MarkersAreDrawn() ||
+		mLineGeometry.xLogarithmic != mXAxis->IsLogarithmic() ||
+		mLineGeometry.yLogarithmic != mYAxis->IsLogarithmic())
+		return false;
+
+	if (!mLineGeometry.culled)
+		return true;
+
+	double xMin, xMax;
+	if (!GetVisibleXRange(xMin, xMax))
+		return false;
+
+	if (mXAxis->GetMinimum() < mLineGeometry.xMin ||
+		mXAxis->GetMaximum() > mLineGeometry.xMax)
+		return false;
+
+	// Decimation buckets are evenly spaced in scaled units
+	if (!mLineGeometry.decimated)
+		return true;
+
+	// The buckets must be at least as fine as the pixel columns, but should
+	// not be so fine that too much geometry is retained (draft geometry is
+	// allowed to be coarser and is kept over a wider range of zoom levels)
+	const double resolution((xMax - xMin) / columns / mLineGeometry.bucketWidth);
+	if (mDraft)
+		return resolution >= 1.0 / mDraftDecimationFactor &&
+			resolution <= mDecimationOversampling * mDecimationOversampling
+			* mDraftDecimationFactor;
+
+	return resolution >= 1.0 &&
+		resolution <= mDecimationOversampling * mDecimationOversampling;
+}
+
+//=============================================================================
+// Class:			PlotCurve
+// Function:		PrepareLine
+//
+// Description:		Re-builds the local line buffer (no OpenGL calls).  Curves
+//					with sorted x-values are culled to a range extending one
+//					plot width beyond each side of the visible range, so the
+//					geometry can be re-used while panning and zooming.  Large
+//					curves are also decimated over this range, unless markers
+//					are drawn (every point within the range needs a marker).
+//					Points are stored relative to the center of the view, so
+//					precision is not lost for data which is far from zero.
+//
+// Input Arguments:
+//		columns	= const unsigned int& width of the plot area [pixels]
+//		markers	= const bool& true if markers will be drawn
+//
 // Output Arguments:
 //		None
 //
@@ -223,69 +331,477 @@ void PlotCurve::Update(const unsigned int& i)
 //		None
 //
 //=============================================================================
-void PlotCurve::GenerateGeometry()
+void PlotCurve::PrepareLine(const unsigned int& columns, const bool& markers)
 {
-	if (mYAxis->GetOrientation() == Axis::Orientation::Left)
-		dynamic_cast<PlotRenderer&>(mRenderWindow).LoadModelviewUniform(PlotRenderer::Modelview::Left);
+	// Scaling is applied by the Line as the buffer is filled, so the raw
+	// data is used here
+	const std::vector<double>& x(mData.GetX());
+	const std::vector<double>& y(mData.GetY());
+
+	mLineGeometry = LineGeometry();
+	mLineGeometry.valid = true;
+	mLineGeometry.pointCount = mData.GetNumberOfPoints();
+	mLineGeometry.revision = mData.GetRevision();
+	mLineGeometry.baseRevision = mData.GetBaseRevision();
+	mLineGeometry.xLogarithmic = mXAxis->IsLogarithmic();
+	mLineGeometry.yLogarithmic = mYAxis->IsLogarithmic();
+	mLineGeometry.markers = markers;
+
+	mLine.SetLogarithmic(mLineGeometry.xLogarithmic, mLineGeometry.yLogarithmic);
+	mLine.SetOrigin(GetScaledCenter(*mXAxis), GetScaledCenter(*mYAxis));
+
+	double xMin, xMax;
+	if (!GetVisibleXRange(xMin, xMax) || !XIsMonotonic())
+	{
+		mLine.BuildVertices(x, y, mBufferInfo[0]);
+		return;
+	}
+
+	// Scaling is monotonic, so the cull range may be computed in scaled
+	// units and applied to the raw data
+	const double range(xMax - xMin);
+	const double cullMin(xMin - range);
+	const double cullMax(xMax + range);
+	const double rawCullMin(UnscaleX(cullMin));
+	const double rawCullMax(UnscaleX(cullMax));
+
+	unsigned int start, end;
+	GetIndexRange(x, rawCullMin, rawCullMax, start, end);
+	if (end - start > columns * mDecimationThreshold && !mLineGeometry.markers)
+	{
+		unsigned int buckets(3 * columns * mDecimationOversampling);
+		if (mDraft)
+			buckets = std::max(buckets / mDraftDecimationFactor, 1U);
+
+		mLineGeometry.culled = true;
+		mLineGeometry.decimated = true;
+		mLineGeometry.xMin = rawCullMin;
+		mLineGeometry.xMax = rawCullMax;
+		mLineGeometry.bucketWidth = (cullMax - cullMin) / buckets;
+
+		std::vector<double> xDecimated, yDecimated;
+		Decimate(x, y, start, end, cullMin, cullMax, buckets,
+			mLineGeometry.xLogarithmic, mLineGeometry.yLogarithmic,
+			xDecimated, yDecimated);
+		mLine.BuildVertices(xDecimated, yDecimated, mBufferInfo[0]);
+	}
+	// Only cull if it saves enough work to justify re-building when
+	// panning out of the range
+	else if (end - start < x.size() / 2)
+	{
+		mLineGeometry.culled = true;
+		mLineGeometry.xMin = rawCullMin;
+		mLineGeometry.xMax = rawCullMax;
+
+		std::vector<double> xVisible(x.begin() + start, x.begin() + end);
+		std::vector<double> yVisible(y.begin() + start, y.begin() + end);
+		mLine.BuildVertices(xVisible, yVisible, mBufferInfo[0]);
+	}
 	else
-		dynamic_cast<PlotRenderer&>(mRenderWindow).LoadModelviewUniform(PlotRenderer::Modelview::Right);
+		mLine.BuildVertices(x, y, mBufferInfo[0]);
+}
 
-	glEnable(GL_SCISSOR_TEST);
+//=============================================================================
+// Class:			PlotCurve
+// Function:		LineCanBeAppended
+//
+// Description:		Checks to see if the line buffer can be brought up to date
+//					by adding the points which were appended to the data since
+//					it was built (as opposed to re-building it).
+//
+// Input Arguments:
+//		columns	= const unsigned int& width of the plot area [pixels]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if AppendLine() may be used
+//
+//=============================================================================
+bool PlotCurve::LineCanBeAppended(const unsigned int& columns) const
+{
+	// Large curves must be re-built so they can be culled and decimated
+	return mLineGeometry.valid && !mLineGeometry.culled &&
+		mLineGeometry.baseRevision == mData.GetBaseRevision() &&
+		mLineGeometry.xLogarithmic == mXAxis->IsLogarithmic() &&
+		mLineGeometry.yLogarithmic == mYAxis->IsLogarithmic() &&
+		mBufferInfo[0].vertexCount == mLineGeometry.pointCount + 2 &&
+		mData.GetNumberOfPoints() > mLineGeometry.pointCount &&
+		mData.GetNumberOfPoints() <= columns * mDecimationThreshold;
+}
 
-	if (mLineSize > 0.0)
+//=============================================================================
+// Class:			PlotCurve
+// Function:		AppendLine
+//
+// Description:		Adds the points which were appended to the data since the
+//					line buffer was built to the line buffer.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurve::AppendLine()
+{
+	const std::size_t start(mLineGeometry.pointCount);
+	std::vector<double> x(mData.GetX().begin() + start, mData.GetX().end());
+	std::vector<double> y(mData.GetY().begin() + start, mData.GetY().end());
+
+	mLine.Append(x, y, mBufferInfo[0]);
+	mLineGeometry.pointCount = mData.GetNumberOfPoints();
+	mLineGeometry.revision = mData.GetRevision();
+}
+
+//=============================================================================
+// Class:			PlotCurve
+// Function:		GetVisibleXRange
+//
+// Description:		Gets the visible range of x-values, scaled for logarithmic
+//					axes if required.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		xMin	= double&
+//		xMax	= double&
+//
+// Return Value:
+//		bool, true if the range is valid
+//
+//=============================================================================
+bool PlotCurve::GetVisibleXRange(double& xMin, double& xMax) const
+{
+	xMin = mXAxis->GetMinimum();
+	xMax = mXAxis->GetMaximum();
+	if (mXAxis->IsLogarithmic())
 	{
-		glBindVertexArray(mBufferInfo[0].GetVertexArrayIndex());
+		xMin = log10(xMin);
+		xMax = log10(xMax);
+	}
 
-		if (mPretty)
-			Line::DoPrettyDraw(mBufferInfo[0].indexBuffer.size());
-		else
-			Line::DoUglyDraw(mBufferInfo[0].vertexCount);
+	return PlotMath::IsValid<double>(xMin) && PlotMath::IsValid<double>(xMax)
+		&& xMax > xMin;
+}
+
+//=============================================================================
+// Class:			PlotCurve
+// Function:		UnscaleX
+//
+// Description:		Converts a scaled x-value (i.e. as returned by
+//					GetVisibleXRange()) to the units of the data.
+//
+// Input Arguments:
+//		value	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//=============================================================================
+double PlotCurve::UnscaleX(const double& value) const
+{
+	if (mXAxis->IsLogarithmic())
+		return pow(10.0, value);
+	return value;
+}
+
+//=============================================================================
+// Class:			PlotCurve
+// Function:		GetScaledCenter
+//
+// Description:		Gets the center of the visible range of the specified
+//					axis, scaled for logarithmic axes if required.
+//
+// Input Arguments:
+//		axis	= const Axis&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double, or zero if the range is not valid
+//
+//=============================================================================
+double PlotCurve::GetScaledCenter(const Axis& axis)
+{
+	double minimum(axis.GetMinimum());
+	double maximum(axis.GetMaximum());
+	if (axis.IsLogarithmic())
+	{
+		minimum = log10(minimum);
+		maximum = log10(maximum);
 	}
 
-	if (NeedsMarkersDrawn())
+	const double center(0.5 * (minimum + maximum));
+	if (PlotMath::IsValid<double>(center))
+		return center;
+	return 0.0;
+}
+
+//=============================================================================
+// Class:			PlotCurve
+// Function:		Decimate
+//
+// Description:		Reduces the data to the points required to draw the line
+//					within the specified x-range (M4 decimation).  The range
+//					is divided into buckets no wider than one pixel column,
+//					and the first, minimum, maximum and last points in each
+//					bucket are retained, along with the nearest point on
+//					either side of the range.  The result is identical when
+//					rasterized, but its size depends on the width of the plot
+//					instead of the number of points.  If the range contains
+//					fewer points than buckets, the points are copied as-is.
+//					X-data must be monotonic.  The range limits are given in
+//					scaled units (i.e. logarithmic, if required), and points
+//					are scaled as required to assign them to buckets.  Large
+//					ranges
+//					are split into chunks which are decimated in parallel (a
+//					bucket which spans two chunks is retained as two buckets,
+//					which does not change the result when rasterized).
+//
+// Input Arguments:
+//		x				= const std::vector<double>&
+//		y				= const std::vector<double>&
+//		start			= const unsigned int& index of the first point
+//		end				= const unsigned int& one past the index of the last point
+//		xMin			= const double&
+//		xMax			= const double&
+//		buckets			= const unsigned int&
+//		xLogarithmic	= const bool&
+//		yLogarithmic	= const bool&
+//
+// Output Arguments:
+//		xOut	= std::vector<double>&
+//		yOut	= std::vector<double>&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurve::Decimate(const std::vector<double>& x,
+	const std::vector<double>& y, const unsigned int& start,
+	const unsigned int& end, const double& xMin, const double& xMax,
+	const unsigned int& buckets, const bool& xLogarithmic,
+	const bool& yLogarithmic, std::vector<double>& xOut,
+	std::vector<double>& yOut)
+{
+	assert(x.size() == y.size());
+	assert(xMax > xMin);
+	assert(end <= x.size());
+
+	if (end - start <= buckets)
 	{
-		glBindVertexArray(mBufferInfo[1].GetVertexArrayIndex());
-		glDrawArrays(GL_TRIANGLES, 0, mBufferInfo[1].vertexCount);
+		xOut.assign(x.begin() + start, x.begin() + end);
+		yOut.assign(y.begin() + start, y.begin() + end);
+		return;
 	}
 
-	glBindVertexArray(0);
-	glDisable(GL_SCISSOR_TEST);
+	const unsigned int chunkCount(GetChunkCount(end - start));
+	std::vector<std::vector<double>> xChunks(chunkCount), yChunks(chunkCount);
+	ThreadPool::GetSharedPool().ParallelFor(chunkCount,
+		[&](const unsigned int& chunk)
+	{
+		const unsigned int chunkStart(start + chunk * mParallelChunkSize);
+		const unsigned int chunkEnd(std::min(end, chunkStart + mParallelChunkSize));
+		DecimateRange(x, y, chunkStart, chunkEnd, xMin, xMax, buckets,
+			xLogarithmic, yLogarithmic, xChunks[chunk], yChunks[chunk]);
+	});
 
-	assert(!RenderWindow::GLHasError());
+	xOut = std::move(xChunks.front());
+	yOut = std::move(yChunks.front());
 
-	dynamic_cast<PlotRenderer&>(mRenderWindow).LoadModelviewUniform(PlotRenderer::Modelview::Fixed);
+	unsigned int i;
+	for (i = 1; i < chunkCount; ++i)
+	{
+		xOut.insert(xOut.end(), xChunks[i].begin(), xChunks[i].end());
+		yOut.insert(yOut.end(), yChunks[i].begin(), yChunks[i].end());
+	}
 }
 
 //=============================================================================
 // Class:			PlotCurve
-// Function:		PointIsValid
+// Function:		DecimateRange
 //
-// Description:		Checks to see if the specified point is a real, finite number.
+// Description:		Performs the decimation described in Decimate() for the
+//					points with the specified indices.
 //
 // Input Arguments:
-//		i	= const unsigned int&
+//		x				= const std::vector<double>&
+//		y				= const std::vector<double>&
+//		start			= const unsigned int& index of the first point
+//		end				= const unsigned int& one past the index of the last point
+//		xMin			= const double&
+//		xMax			= const double&
+//		buckets			= const unsigned int&
+//		xLogarithmic	= const bool&
+//		yLogarithmic	= const bool&
+//
+// Output Arguments:
+//		xOut	= std::vector<double>&
+//		yOut	= std::vector<double>&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurve::DecimateRange(const std::vector<double>& x,
+	const std::vector<double>& y, const unsigned int& start,
+	const unsigned int& end, const double& xMin, const double& xMax,
+	const unsigned int& buckets, const bool& xLogarithmic,
+	const bool& yLogarithmic, std::vector<double>& xOut,
+	std::vector<double>& yOut)
+{
+	assert(end > start);
+
+	const double bucketsPerUnit(buckets / (xMax - xMin));
+
+	xOut.reserve(std::min<std::size_t>(end - start, buckets * 4 + 2));
+	yOut.reserve(xOut.capacity());
+
+	auto addPoints([&x, &y, &xOut, &yOut](const unsigned int& firstIndex,
+		const unsigned int& minIndex, const unsigned int& maxIndex,
+		const unsigned int& lastIndex)
+	{
+		// Add the points in order without duplicates
+		unsigned int indices[] = { firstIndex,
+			std::min(minIndex, maxIndex), std::max(minIndex, maxIndex),
+			lastIndex };
+		unsigned int j;
+		for (j = 0; j < 4; ++j)
+		{
+			if (j > 0 && indices[j] == indices[j - 1])
+				continue;
+
+			xOut.push_back(x[indices[j]]);
+			yOut.push_back(y[indices[j]]);
+		}
+	});
+
+	// Points beyond the range (including non-positive values on
+	// logarithmic axes) get their own buckets
+	auto getBucket([&bucketsPerUnit, &xMin, &buckets, &xLogarithmic](
+		const double& value)
+	{
+		if (xLogarithmic && value <= 0.0)
+			return -1;
+
+		const double scaled(xLogarithmic ? log10(value) : value);
+		return static_cast<int>(std::min(std::max(
+			floor((scaled - xMin) * bucketsPerUnit), -1.0),
+			static_cast<double>(buckets)));
+	});
+
+	// Invalid values are never selected as extremes; they are retained
+	// only if they are the first or last point in a bucket
+	auto isValid([&yLogarithmic](const double& value)
+	{
+		return PlotMath::IsValid<double>(value) &&
+			(!yLogarithmic || value > 0.0);
+	});
+
+	unsigned int i(start), firstIndex(start), minIndex(start), maxIndex(start);
+	int bucket(getBucket(x[start]));
+	for (++i; i < end; ++i)
+	{
+		const int currentBucket(getBucket(x[i]));
+		if (currentBucket != bucket)
+		{
+			addPoints(firstIndex, minIndex, maxIndex, i - 1);
+			bucket = currentBucket;
+			firstIndex = i;
+			minIndex = i;
+			maxIndex = i;
+			continue;
+		}
+
+		if (!isValid(y[i]))
+			continue;
+
+		if (y[i] < y[minIndex] || !isValid(y[minIndex]))
+			minIndex = i;
+		if (y[i] > y[maxIndex] || !isValid(y[maxIndex]))
+			maxIndex = i;
+	}
+	addPoints(firstIndex, minIndex, maxIndex, end - 1);
+}
+
+//=============================================================================
+// Class:			PlotCurve
+// Function:		GetChunkCount
+//
+// Description:		Gets the number of chunks into which an array should be
+//					divided for parallel processing.
+//
+// Input Arguments:
+//		size	= const std::size_t&
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		bool, true for valid, false otherwise
+//		unsigned int
 //
 //=============================================================================
-bool PlotCurve::PointIsValid(const unsigned int &i) const
+unsigned int PlotCurve::GetChunkCount(const std::size_t& size)
 {
-	assert(i < mData.GetNumberOfPoints());
+	return static_cast<unsigned int>(
+		(size + mParallelChunkSize - 1) / mParallelChunkSize);
+}
 
-	return PlotMath::IsValid<double>(mData.GetX()[i]) &&
-		PlotMath::IsValid<double>(mData.GetY()[i]);
+//=============================================================================
+// Class:			PlotCurve
+// Function:		GetIndexRange
+//
+// Description:		Finds the range of indices of the (sorted) x-values within
+//					the specified limits.  One point beyond each end of the
+//					range is included so the line continues to the edge of
+//					the plot.
+//
+// Input Arguments:
+//		x		= const std::vector<double>& (must be sorted)
+//		xMin	= const double&
+//		xMax	= const double&
+//
+// Output Arguments:
+//		start	= unsigned int& index of the first point
+//		end		= unsigned int& one past the index of the last point
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurve::GetIndexRange(const std::vector<double>& x,
+	const double& xMin, const double& xMax, unsigned int& start,
+	unsigned int& end)
+{
+	auto first(std::lower_bound(x.begin(), x.end(), xMin));
+	auto last(std::upper_bound(first, x.end(), xMax));
+	if (first != x.begin())
+		--first;
+	if (last != x.end())
+		++last;
+
+	start = static_cast<unsigned int>(first - x.begin());
+	end = static_cast<unsigned int>(last - x.begin());
 }
 
 //=============================================================================
 // Class:			PlotCurve
-// Function:		HasValidParameters
+// Function:		XIsMonotonic
 //
-// Description:		Checks to see if the information about this object is
-//					valid and complete (gives permission to create the object).
+// Description:		Checks to see if the x-data is valid and non-decreasing.
+//					The result is cached; if points were only appended since
+//					the last check, only the new points are checked.
 //
 // Input Arguments:
 //		None
@@ -294,51 +810,74 @@ bool PlotCurve::PointIsValid(const unsigned int &i) const
 //		None
 //
 // Return Value:
-//		bool, true for OK to draw, false otherwise
+//		bool
 //
 //=============================================================================
-bool PlotCurve::HasValidParameters()
+bool PlotCurve::XIsMonotonic()
 {
-	if (mXAxis != nullptr && mYAxis != nullptr && mData.GetNumberOfPoints() > 1)
+	const std::vector<double>& x(mData.GetX());
+	if (mMonotonicCheck.baseRevision == mData.GetBaseRevision() &&
+		mMonotonicCheck.pointCount > 0 &&
+		mMonotonicCheck.pointCount <= x.size())
 	{
-		if (mXAxis->IsHorizontal() && !mYAxis->IsHorizontal())
-			return true;
+		// The new points must also follow the last checked point
+		if (mMonotonicCheck.monotonic &&
+			mMonotonicCheck.pointCount < x.size())
+			mMonotonicCheck.monotonic = IsMonotonic(x,
+				mMonotonicCheck.pointCount - 1);
+	}
+	else
+	{
+		mMonotonicCheck.baseRevision = mData.GetBaseRevision();
+		mMonotonicCheck.monotonic = IsMonotonic(x, 0);
 	}
 
-	return false;
+	mMonotonicCheck.pointCount = x.size();
+	return mMonotonicCheck.monotonic;
 }
 
 //=============================================================================
 // Class:			PlotCurve
-// Function:		operator=
+// Function:		IsMonotonic
 //
-// Description:		Assignment operator for PlotCurve class.
+// Description:		Checks to see if the values beginning with the specified
+//					index are valid and non-decreasing.
 //
 // Input Arguments:
-//		plotCurve	= const PlotCurve& to assign to this object
+//		values	= const std::vector<double>&
+//		start	= const std::size_t&
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		PlotCurve&, reference to this object
+//		bool
 //
 //=============================================================================
-PlotCurve& PlotCurve::operator=(const PlotCurve &plotCurve)
+bool PlotCurve::IsMonotonic(const std::vector<double>& values,
+	const std::size_t& start)
 {
-	if (this == &plotCurve)
-		return *this;
+	if (start >= values.size() || !PlotMath::IsValid<double>(values[start]))
+		return false;
 
-	this->Primitive::operator=(plotCurve);
+	std::size_t i;
+	for (i = start + 1; i < values.size(); ++i)
+	{
+		// Written such that NaN values fail
+		if (!(values[i] >= values[i - 1]) ||
+			!PlotMath::IsValid<double>(values[i]))
+			return false;
+	}
 
-	return *this;
+	return true;
 }
 
 //=============================================================================
 // Class:			PlotCurve
-// Function:		BuildMarkers
+// Function:		GenerateGeometry
 //
-// Description:		Plots markers at all un-interpolated points.
+// Description:		Creates the OpenGL instructions to create this object in
+//					the scene.
 //
 // Input Arguments:
 //		None
@@ -350,103 +889,115 @@ PlotCurve& PlotCurve::operator=(const PlotCurve &plotCurve)
 //		None
 //
 //=============================================================================
-void PlotCurve::BuildMarkers()
+void PlotCurve::GenerateGeometry()
 {
-	float halfMarkerYSize = 2 * mMarkerSize * mYScale;
-	float halfMarkerXSize = 2 * mMarkerSize * mXScale;
-	const unsigned int dimension(mRenderWindow.GetVertexDimension());
-	const unsigned int colorStart(mData.GetNumberOfPoints() * dimension * 6);
-
-	// Use function pointers to save a few checks in the loop
-	PlotRenderer::ScalingFunction xScaleFunction(
-		dynamic_cast<PlotRenderer&>(mRenderWindow).GetXScaleFunction());
-	PlotRenderer::ScalingFunction yScaleFunction;
-
-	if (mYAxis->GetOrientation() == Axis::Orientation::Left)
-		yScaleFunction = dynamic_cast<PlotRenderer&>(mRenderWindow).GetLeftYScaleFunction();
-	else
-		yScaleFunction = dynamic_cast<PlotRenderer&>(mRenderWindow).GetRightYScaleFunction();
+	PlotRenderer& renderer(dynamic_cast<PlotRenderer&>(mRenderWindow));
+	const PlotRenderer::Modelview modelview(
+		mYAxis->GetOrientation() == Axis::Orientation::Left ?
+		PlotRenderer::Modelview::Left : PlotRenderer::Modelview::Right);
 
-	unsigned int i;
-	for (i = 0; i < mData.GetNumberOfPoints(); ++i)
-	{
-		float x(static_cast<float>(xScaleFunction(mData.GetX()[i])));
-		float y(static_cast<float>(yScaleFunction(mData.GetY()[i])));
-
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension] = x + halfMarkerXSize;
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 1] = y + halfMarkerYSize;
-
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + dimension] = x - halfMarkerXSize;
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + dimension + 1] = y + halfMarkerYSize;
-
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 2 * dimension] = x - halfMarkerXSize;
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 2 * dimension + 1] = y - halfMarkerYSize;
-
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 3 * dimension] = x + halfMarkerXSize;
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 3 * dimension + 1] = y + halfMarkerYSize;
+	glEnable(GL_SCISSOR_TEST);
 
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 4 * dimension] = x - halfMarkerXSize;
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 4 * dimension + 1] = y - halfMarkerYSize;
+	if (mLineSize > 0.0 && mBufferInfo[0].vertexCount > 0)
+	{
+		glBindVertexArray(mBufferInfo[0].GetVertexArrayIndex());
+		mLine.Draw(mBufferInfo[0].vertexCount,
+			renderer.GetModelview(modelview));
+	}
 
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 5 * dimension] = x + halfMarkerXSize;
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 5 * dimension + 1] = y - halfMarkerYSize;
+	if (MarkersAreDrawn() && mBufferInfo[1].vertexCount > 0)
+	{
+		// This relationship is also used by the Legend class
+		mMarker.SetSize(4.0 * std::abs(mMarkerSize));
+		mMarker.SetColor(mColor);
 
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24] = static_cast<float>(mColor.GetRed());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 1] = static_cast<float>(mColor.GetGreen());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 2] = static_cast<float>(mColor.GetBlue());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 3] = static_cast<float>(mColor.GetAlpha());
+		glBindVertexArray(mBufferInfo[1].GetVertexArrayIndex());
+		mMarker.Draw(mBufferInfo[1].vertexCount,
+			mLine.GetBufferModelview(renderer.GetModelview(modelview)));
+	}
 
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 4] = static_cast<float>(mColor.GetRed());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 5] = static_cast<float>(mColor.GetGreen());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 6] = static_cast<float>(mColor.GetBlue());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 7] = static_cast<float>(mColor.GetAlpha());
+	glBindVertexArray(0);
+	glDisable(GL_SCISSOR_TEST);
 
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 8] = static_cast<float>(mColor.GetRed());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 9] = static_cast<float>(mColor.GetGreen());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 10] = static_cast<float>(mColor.GetBlue());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 11] = static_cast<float>(mColor.GetAlpha());
+	assert(!RenderWindow::GLHasError());
+}
 
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 12] = static_cast<float>(mColor.GetRed());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 13] = static_cast<float>(mColor.GetGreen());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 14] = static_cast<float>(mColor.GetBlue());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 15] = static_cast<float>(mColor.GetAlpha());
+//=============================================================================
+// Class:			PlotCurve
+// Function:		PointIsValid
+//
+// Description:		Checks to see if the specified point is a real, finite number.
+//
+// Input Arguments:
+//		i	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for valid, false otherwise
+//
+//=============================================================================
+bool PlotCurve::PointIsValid(const unsigned int &i) const
+{
+	assert(i < mData.GetNumberOfPoints());
 
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 16] = static_cast<float>(mColor.GetRed());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 17] = static_cast<float>(mColor.GetGreen());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 18] = static_cast<float>(mColor.GetBlue());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 19] = static_cast<float>(mColor.GetAlpha());
+	return PlotMath::IsValid<double>(mData.GetX()[i]) &&
+		PlotMath::IsValid<double>(mData.GetY()[i]);
+}
 
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 20] = static_cast<float>(mColor.GetRed());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 21] = static_cast<float>(mColor.GetGreen());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 22] = static_cast<float>(mColor.GetBlue());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 23] = static_cast<float>(mColor.GetAlpha());
+//=============================================================================
+// Class:			PlotCurve
+// Function:		HasValidParameters
+//
+// Description:		Checks to see if the information about this object is
+//					valid and complete (gives permission to create the object).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for OK to draw, false otherwise
+//
+//=============================================================================
+bool PlotCurve::HasValidParameters()
+{
+	if (mXAxis != nullptr && mYAxis != nullptr && mData.GetNumberOfPoints() > 1)
+	{
+		if (mXAxis->IsHorizontal() && !mYAxis->IsHorizontal())
+			return true;
 	}
+
+	return false;
 }
 
 //=============================================================================
 // Class:			PlotCurve
-// Function:		DoLogarithmicScale
+// Function:		operator=
 //
-// Description:		Handles scaling for arrays of logarithmic data.
+// Description:		Assignment operator for PlotCurve class.
 //
 // Input Arguments:
-//		value	= const std::vector<double>&
+//		plotCurve	= const PlotCurve& to assign to this object
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		std::vector<double>
+//		PlotCurve&, reference to this object
 //
 //=============================================================================
-std::vector<double> PlotCurve::DoLogarithmicScale(
-	const std::vector<double>& values)
+PlotCurve& PlotCurve::operator=(const PlotCurve &plotCurve)
 {
-	std::vector<double> scaledValues(values);
-	for (auto& v : scaledValues)
-		v = PlotRenderer::DoLogarithmicScale(v);
+	if (this == &plotCurve)
+		return *this;
 
-	return scaledValues;
+	this->Primitive::operator=(plotCurve);
+
+	return *this;
 }
 
 //=============================================================================
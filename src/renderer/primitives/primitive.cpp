@@ -134,20 +134,122 @@ void Primitive::Draw()
 	if (!HasValidParameters() || !mIsVisible)
 		return;
 
+	FrameStatistics& statistics(mRenderWindow.GetFrameStatistics());
+	const bool recording(statistics.IsRecording());
+	FrameStatistics::Clock::time_point start;
+	if (recording)
+		start = FrameStatistics::Clock::now();
+
 	unsigned int i;
 	for (i = 0; i < mBufferInfo.size(); ++i)
 	{
 		if (mBufferInfo[i].vertexCountModified || mModified)
+		{
 			Update(i);
+
+			// Not every path through Update() re-builds the buffer (i.e. when
+			// there is nothing to draw), but in all cases it is now current;
+			// otherwise IsModified() would invalidate the layer cache forever
+			mBufferInfo[i].vertexCountModified = false;
+		}
 		assert(!RenderWindow::GLHasError());
 	}
 
+	FrameStatistics::Clock::time_point updated;
+	if (recording)
+		updated = FrameStatistics::Clock::now();
+
 	mModified = false;
 	GenerateGeometry();
 
+	if (recording)
+		statistics.RecordPrimitive(*this, updated - start,
+			FrameStatistics::Clock::now() - updated, GetVertexCount());
+
 	assert(!RenderWindow::GLHasError());
 }
 
+//=============================================================================
+// Class:			Primitive
+// Function:		GetVertexCount
+//
+// Description:		Returns the number of vertices in this object's buffers.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//=============================================================================
+unsigned int Primitive::GetVertexCount() const
+{
+	unsigned int count(0);
+	for (const auto& buffer : mBufferInfo)
+		count += buffer.vertexCount;
+
+	return count;
+}
+
+//=============================================================================
+// Class:			Primitive
+// Function:		BeginPrepare
+//
+// Description:		Checks to see if this object should be prepared for the
+//					next draw.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if Prepare() should be called
+//
+//=============================================================================
+bool Primitive::BeginPrepare()
+{
+	if (!HasValidParameters() || !mIsVisible)
+		return false;
+
+	return BeginPrepareUpdate();
+}
+
+//=============================================================================
+// Class:			Primitive
+// Function:		IsModified
+//
+// Description:		Checks to see if any buffers will be updated on the next
+//					draw.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if this object has changed since it was last drawn
+//
+//=============================================================================
+bool Primitive::IsModified() const
+{
+	if (mModified)
+		return true;
+
+	for (const auto& buffer : mBufferInfo)
+	{
+		if (buffer.vertexCountModified)
+			return true;
+	}
+
+	return false;
+}
+
 //=============================================================================
 // Class:			Primitive
 // Function:		SetVisibility
@@ -215,6 +317,29 @@ void Primitive::SetDrawOrder(const unsigned int& drawOrder)
 	mRenderWindow.SetNeedOrderSort();
 }
 
+//=============================================================================
+// Class:			Primitive
+// Function:		SetIsOverlay
+//
+// Description:		Sets the flag indicating whether or not this object is
+//					drawn on top of the cached scene.
+//
+// Input Arguments:
+//		isOverlay	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void Primitive::SetIsOverlay(const bool& isOverlay)
+{
+	mIsOverlay = isOverlay;
+	mModified = true;
+}
+
 //=============================================================================
 // Class:			Primitive
 // Function:		operator=
@@ -242,6 +367,7 @@ Primitive& Primitive::operator=(const Primitive &primitive)
 	mColor		= primitive.mColor;
 	mModified	= true;
 	mDrawOrder	= primitive.mDrawOrder;
+	mIsOverlay	= primitive.mIsOverlay;
 
 	mRenderWindow.SetNeedAlphaSort();
 	mRenderWindow.SetNeedOrderSort();
@@ -276,6 +402,7 @@ Primitive& Primitive::operator=(Primitive &&primitive)
 	mColor		= std::move(primitive.mColor);
 	mModified	= true;
 	mDrawOrder	= std::move(primitive.mDrawOrder);
+	mIsOverlay	= std::move(primitive.mIsOverlay);
 	mBufferInfo	= std::move(primitive.mBufferInfo);
 
 	mRenderWindow.SetNeedAlphaSort();
@@ -398,6 +525,7 @@ Primitive::BufferInfo& Primitive::BufferInfo::operator=(BufferInfo&& b)
 	vertexBuffer = std::move(b.vertexBuffer);
 	indexBuffer = std::move(b.indexBuffer);
 	vertexCountModified = std::move(b.vertexCountModified);
+	vertexBufferCapacity = b.vertexBufferCapacity;
 
 	vertexBufferIndex = std::move(b.vertexBufferIndex);
 	vertexArrayIndex = std::move(b.vertexArrayIndex);
@@ -469,6 +597,7 @@ void Primitive::BufferInfo::FreeOpenGLObjects()
 		glDeleteVertexArrays(1, &vertexArrayIndex);
 		glDeleteBuffers(1, &vertexBufferIndex);
 		glVertexBufferExists = false;
+		vertexBufferCapacity = 0;
 	}
 
 	if (glIndexBufferExists)
@@ -65,7 +65,7 @@ void TextRendering::Update(const unsigned int& /*i*/)
 {
 	mFont.SetColor(mColor);
 	mFont.SetOrientation(mAngle);
-	mFont.SetText(mText.ToStdString());
+	mFont.SetText(mText.ToUTF8().data());
 
 	if (mCentered)
 	{
@@ -158,7 +158,7 @@ double TextRendering::GetTextHeight()
 	if (!mFont.IsOK())
 		return 0.0;
 
-	Text::BoundingBox boundingBox(mFont.GetBoundingBox(mText.ToStdString()));
+	Text::BoundingBox boundingBox(mFont.GetBoundingBox(mText.ToUTF8().data()));
 
 	return boundingBox.yUp - boundingBox.yDown;
 }
@@ -185,7 +185,7 @@ double TextRendering::GetTextWidth()
 	if (!mFont.IsOK())
 		return 0.0;
 
-	Text::BoundingBox boundingBox(mFont.GetBoundingBox(mText.ToStdString()));
+	Text::BoundingBox boundingBox(mFont.GetBoundingBox(mText.ToUTF8().data()));
 
 	return boundingBox.xRight - boundingBox.xLeft;
 }
@@ -43,6 +43,7 @@ ZoomBox::ZoomBox(RenderWindow &renderWindow) : Primitive(renderWindow),
 	// Initially, we don't want to draw this
 	mIsVisible = false;
 	mColor = Color::ColorBlack;
+	SetIsOverlay(true);
 }
 
 //=============================================================================
@@ -90,8 +91,11 @@ void ZoomBox::Update(const unsigned int& /*i*/)
 //=============================================================================
 void ZoomBox::GenerateGeometry()
 {
+	if (mBufferInfo[0].vertexCount == 0)
+		return;
+
 	glBindVertexArray(mBufferInfo[0].GetVertexArrayIndex());
-	Line::DoPrettyDraw(mBufferInfo[0].indexBuffer.size());
+	box.Draw(mBufferInfo[0].vertexCount, mRenderWindow.GetModelviewMatrix());
 	glBindVertexArray(0);
 }
 
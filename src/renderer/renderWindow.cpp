@@ -20,7 +20,10 @@
 
 // Local headers
 #include "lp2d/renderer/renderWindow.h"
+#include "lp2d/renderer/glyphAtlas.h"
 #include "lp2d/utilities/math/plotMath.h"
+#include "lp2d/utilities/threadPool.h"
+#include "lp2d/utilities/trace.h"
 
 // Eigen headers
 #include <Eigen/Geometry>
@@ -28,12 +31,14 @@
 // wxWidgets headers
 #include <wx/dcclient.h>
 #include <wx/image.h>
+#include <wx/display.h>
 
 // Standard C++ headers
 #include <vector>
 #include <algorithm>
 #include <iostream>
 #include <typeinfo>
+#include <cmath>
 
 namespace LibPlot2D
 {
@@ -60,6 +65,8 @@ const std::string RenderWindow::mPositionName("position");
 const std::string RenderWindow::mColorName("color");
 
 const double RenderWindow::mExactPixelShift(0.375);
+const int RenderWindow::mDefaultRefreshRate(60);// [Hz]
+const int RenderWindow::mMaxTileSize(2048);// [pixels]
 std::mutex RenderWindow::renderMutex;
 
 //=============================================================================
@@ -183,13 +190,932 @@ void RenderWindow::FreeOpenGLObjects()
 	std::lock_guard<std::mutex> lock(renderMutex);
 	MakeCurrent();
 	mPrimitiveList.Clear();
+
+	for (const auto& texture : mGlyphAtlasTextures)
+		glDeleteTextures(1, &texture.second.id);
+	mGlyphAtlasTextures.clear();
+
+	FreeLayerFramebuffer();
+	FreeOffscreenFramebuffer();
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		Event Table
+//
+// Description:		Event Table for the RENDER_WINDOW class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+BEGIN_EVENT_TABLE(RenderWindow, wxGLCanvas)
+	// Window events
+	EVT_SIZE(				RenderWindow::OnSize)
+	EVT_PAINT(				RenderWindow::OnPaint)
+	EVT_ENTER_WINDOW(		RenderWindow::OnEnterWindow)
+	EVT_IDLE(				RenderWindow::OnIdle)
+
+	// Interaction events
+	EVT_MOUSEWHEEL(			RenderWindow::OnMouseWheelEvent)
+	EVT_MOTION(				RenderWindow::OnMouseMoveEvent)
+	EVT_LEFT_UP(			RenderWindow::OnMouseUpEvent)
+	EVT_LEFT_DOWN(			RenderWindow::OnMouseDownEvent)
+	EVT_MIDDLE_UP(			RenderWindow::OnMouseUpEvent)
+	EVT_RIGHT_UP(			RenderWindow::OnMouseUpEvent)
+	EVT_RIGHT_DOWN(			RenderWindow::OnMouseDownEvent)
+END_EVENT_TABLE()
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		GetContext
+//
+// Description:		Gets (or creates, if it doesn't yet exist) the GL context.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		wxGLContext*
+//
+//=============================================================================
+wxGLContext* RenderWindow::GetContext()
+{
+	if (!mContext)
+	{
+		wxGLContextAttrs attributes;
+		attributes.PlatformDefaults().OGLVersion(4, 0).EndList();
+		mContext = std::make_unique<wxGLContext>(this, nullptr, &attributes);
+		assert(mContext->IsOK() && "Minimum OpenGL verison not met (requires 4.0)");
+	}
+
+	return mContext.get();
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		SetViewportCount
+//
+// Description:		Sets the number of viewports.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::SetViewportCount(const unsigned int& count)
+{
+	assert(count > 0);
+	viewportCount = count;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		Render
+//
+// Description:		Updates the scene with all of this object's options and
+//					re-draws the image.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::Render()
+{
+	LP2D_TRACE_SCOPE("render", "RenderWindow::Render");
+
+	if (!GetContext() || !IsShownOnScreen())
+		return;
+
+	const unsigned int shaderCount(mShaders.size());
+
+	{
+		std::lock_guard<std::mutex> lock(renderMutex);
+
+		SetCurrent(*mContext);
+		wxPaintDC(this);
+
+		assert(!GLHasError());
+
+		if (!InitializeGL())
+			return;
+
+		if (mFrameStatistics.IsEnabled())
+			UpdateStatisticsOverlay();
+
+		// Swapping may block until the next display refresh, so it is not
+		// included in the frame time
+		mFrameStatistics.BeginFrame();
+		DrawScene();
+		mFrameStatistics.EndFrame();
+		SwapBuffers();// TODO:  Memory leak here?
+	}
+
+	// If shaders are added mid-render, we need to re-render to ensure everything gets displayed
+	if (mShaders.size() != shaderCount)
+		Render();
+
+	assert(!GLHasError());
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		InitializeGL
+//
+// Description:		Initializes GLEW and builds the shaders, if this has not
+//					already been done.  The context must be current.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the context is ready for rendering
+//
+//=============================================================================
+bool RenderWindow::InitializeGL()
+{
+	if (mGlewInitialized)
+		return true;
+
+	glewExperimental = GL_TRUE;
+	if (glewInit() != GLEW_OK)
+		return false;
+
+	// According to https://www.khronos.org/opengl/wiki/OpenGL_Loading_Library, glewInit() may cause
+	// OpenGL error GL_INVALID_ENUM (which we observe) even if everything is actually OK.
+	// So check for errors to clear the error flag.
+#ifdef _DEBUG
+	int e =
+#endif// _DEBUG
+		glGetError();
+
+#ifdef _DEBUG
+	assert(e == GL_NO_ERROR || e == GL_INVALID_ENUM);
+	GetGLInfo();
+#endif// _DEBUG
+	BuildShaders();
+	mGlewInitialized = true;
+
+	return true;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		DrawScene
+//
+// Description:		Updates the primitives and draws them to the currently
+//					bound framebuffer.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::DrawScene()
+{
+	PreparePrimitives();
+
+	// Captured before Initialize() clears the flags
+	const bool sceneModified(mModified || mModelviewModified ||
+		mSizeUpdateRequired);
+
+	for (unsigned int viewport = 0; viewport < viewportCount; ++viewport)
+	{
+		if (mSizeUpdateRequired || viewport != lastViewportConfigured)
+			DoResize(viewport);
+
+		if (mModified || viewport != lastViewportConfigured)
+			Initialize(viewport);
+		else if (mModelviewModified)
+			UpdateModelviewMatrix();
+
+		// Offscreen images are drawn once, so there is nothing to gain from
+		// caching them
+		const bool useLayerCache(viewportCount == 1 && !mView3D &&
+			!IsRenderingOffscreen());
+		if (viewport == 0 && !useLayerCache)
+		{
+			if (mView3D)
+			{
+				glClearColor(static_cast<float>(mBackgroundColor.GetRed()),
+					static_cast<float>(mBackgroundColor.GetGreen()),
+					static_cast<float>(mBackgroundColor.GetBlue()),
+					static_cast<float>(mBackgroundColor.GetAlpha()));
+				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+			}
+			else
+				ClearColorBuffer();
+		}
+
+		// Sort the primitives by Color.GetAlpha to ensure that transparent objects are rendered last
+		Primitive* firstTransparentPrimitive(nullptr);
+		if (mNeedAlphaSort)
+		{
+			std::sort(mPrimitiveList.begin(), mPrimitiveList.end(), AlphaSortPredicate);
+			mNeedAlphaSort = false;
+
+			if (mView3D)
+			{
+				for (const auto& p : mPrimitiveList)
+				{
+					if (p->GetColor().GetAlpha() < 1.0)
+					{
+						firstTransparentPrimitive = p.get();
+						break;
+					}
+				}
+			}
+		}
+
+		// Generally, all objects will have the same draw order and this won't do anything,
+		// but for some cases we do want to override the draw order just before rendering
+		if (mNeedOrderSort)
+		{
+			std::stable_sort(mPrimitiveList.begin(), mPrimitiveList.end(), OrderSortPredicate);
+			mNeedOrderSort = false;
+		}
+
+		// NOTE:  Any primitive that uses it's own program should re-load the default program
+		// by calling RenderWindow::UseDefaultProgram() at the end of GenerateGeometry()
+		if (useLayerCache)
+			DrawWithLayerCache(sceneModified);
+		else
+		{
+			mLayerCacheValid = false;
+			for (auto& p : mPrimitiveList)
+			{
+				if (firstTransparentPrimitive && p.get() == firstTransparentPrimitive)
+					glDepthMask(GL_FALSE);
+				p->Draw();
+			}
+
+			if (firstTransparentPrimitive)
+				glDepthMask(GL_TRUE);
+		}
+
+		lastViewportConfigured = viewport;
+	}
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		RenderOffscreen
+//
+// Description:		Renders the scene at the specified size and scale into an
+//					offscreen framebuffer, one tile at a time, and returns the
+//					resulting image.  Each tile is read into a pixel buffer
+//					object, which is not copied into the image until the next
+//					tile has been submitted, so the readback overlaps with
+//					rendering.
+//
+// Input Arguments:
+//		width	= const unsigned int&
+//		height	= const unsigned int&
+//		scale	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		wxImage
+//
+//=============================================================================
+wxImage RenderWindow::RenderOffscreen(const unsigned int& width,
+	const unsigned int& height, const double& scale)
+{
+	LP2D_TRACE_SCOPE("render", "RenderWindow::RenderOffscreen");
+
+	assert(scale > 0.0);
+	if (!GetContext() || width == 0 || height == 0)
+		return wxImage();
+
+	mImageWidth = static_cast<int>(width);
+	mImageHeight = static_cast<int>(height);
+	mOffscreenWidth = std::max(1, static_cast<int>(width / scale + 0.5));
+	mOffscreenHeight = std::max(1, static_cast<int>(height / scale + 0.5));
+	mOutputScale = scale;
+	mSizeUpdateRequired = true;
+	OnRenderSizeChanged();
+
+	wxImage image;
+	{
+		std::lock_guard<std::mutex> lock(renderMutex);
+		SetCurrent(*mContext);
+
+		GLint maxSize;
+		glGetIntegerv(GL_MAX_RENDERBUFFER_SIZE, &maxSize);
+		const int tileSize(std::min(mMaxTileSize, static_cast<int>(maxSize)));
+		const int bufferWidth(std::min(mImageWidth, tileSize));
+		const int bufferHeight(std::min(mImageHeight, tileSize));
+
+		if (InitializeGL() &&
+			PrepareOffscreenFramebuffer(bufferWidth, bufferHeight))
+		{
+			image.Create(mImageWidth, mImageHeight, false);
+
+			GLint windowFramebuffer;
+			glGetIntegerv(GL_FRAMEBUFFER_BINDING, &windowFramebuffer);
+			glBindFramebuffer(GL_FRAMEBUFFER, mOffscreenFramebuffer);
+
+			GLuint readbackBuffers[2];
+			glGenBuffers(2, readbackBuffers);
+			for (const auto& buffer : readbackBuffers)
+			{
+				glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+				glBufferData(GL_PIXEL_PACK_BUFFER,
+					bufferWidth * bufferHeight * 3, nullptr, GL_STREAM_READ);
+			}
+			glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+			Tile previousTile;
+			unsigned int tileCount(0);
+			for (mTile.y = 0; mTile.y < mImageHeight; mTile.y += bufferHeight)
+			{
+				for (mTile.x = 0; mTile.x < mImageWidth; mTile.x += bufferWidth)
+				{
+					mTile.width = std::min(bufferWidth, mImageWidth - mTile.x);
+					mTile.height = std::min(bufferHeight, mImageHeight - mTile.y);
+					mSizeUpdateRequired = true;
+
+					// Shaders added while drawing require another pass
+					unsigned int shaderCount;
+					do
+					{
+						shaderCount = mShaders.size();
+						DrawScene();
+					} while (mShaders.size() != shaderCount);
+
+					const GLuint buffer(readbackBuffers[tileCount % 2]);
+					glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+					glReadPixels(0, 0, mTile.width, mTile.height, GL_RGB,
+						GL_UNSIGNED_BYTE, nullptr);
+
+					if (tileCount > 0)
+						CopyTile(readbackBuffers[(tileCount - 1) % 2],
+							previousTile, image);
+
+					previousTile = mTile;
+					++tileCount;
+				}
+			}
+
+			CopyTile(readbackBuffers[(tileCount - 1) % 2], previousTile, image);
+
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+			glDeleteBuffers(2, readbackBuffers);
+			glBindFramebuffer(GL_FRAMEBUFFER, windowFramebuffer);
+		}
+
+		mOffscreenWidth = 0;
+		mOffscreenHeight = 0;
+		mOutputScale = 1.0;
+		mTile = Tile();
+		ApplyScissorArea();
+	}
+
+	mSizeUpdateRequired = true;
+	OnRenderSizeChanged();
+	Refresh();
+
+	assert(!GLHasError());
+	return image;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		CopyTile
+//
+// Description:		Copies the contents of a pixel buffer object into the
+//					appropriate region of the image.  OpenGL rows start at the
+//					bottom, so they are flipped.
+//
+// Input Arguments:
+//		buffer	= const GLuint&
+//		tile	= const Tile&
+//
+// Output Arguments:
+//		image	= wxImage&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::CopyTile(const GLuint& buffer, const Tile& tile,
+	wxImage& image) const
+{
+	const unsigned int rowSize(tile.width * 3);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+	const unsigned char* pixels(static_cast<const unsigned char*>(
+		glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, rowSize * tile.height,
+		GL_MAP_READ_BIT)));
+	if (!pixels)
+		return;
+
+	unsigned char* imageData(image.GetData());
+	int row;
+	for (row = 0; row < tile.height; ++row)
+	{
+		const int imageRow(mImageHeight - 1 - (tile.y + row));
+		std::copy(pixels + row * rowSize, pixels + (row + 1) * rowSize,
+			imageData + (imageRow * mImageWidth + tile.x) * 3);
+	}
+
+	glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		GetTileTransform
+//
+// Description:		Returns the matrix which maps normalized device
+//					coordinates for the entire offscreen image to those for
+//					the current tile.  Applied after the projection matrix.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Eigen::Matrix4d
+//
+//=============================================================================
+Eigen::Matrix4d RenderWindow::GetTileTransform() const
+{
+	Eigen::Matrix4d transform(Eigen::Matrix4d::Identity());
+	transform(0, 0) = static_cast<double>(mImageWidth) / mTile.width;
+	transform(1, 1) = static_cast<double>(mImageHeight) / mTile.height;
+	transform(0, 3) = static_cast<double>(mImageWidth - 2 * mTile.x)
+		/ mTile.width - 1.0;
+	transform(1, 3) = static_cast<double>(mImageHeight - 2 * mTile.y)
+		/ mTile.height - 1.0;
+
+	return transform;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		SetScissorArea
+//
+// Description:		Stores and applies the scissor box.
+//
+// Input Arguments:
+//		x		= const int&
+//		y		= const int&
+//		width	= const int&
+//		height	= const int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::SetScissorArea(const int& x, const int& y, const int& width,
+	const int& height)
+{
+	mScissorArea[0] = x;
+	mScissorArea[1] = y;
+	mScissorArea[2] = width;
+	mScissorArea[3] = height;
+	ApplyScissorArea();
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		ApplyScissorArea
+//
+// Description:		Converts the scissor box from window pixels to pixels
+//					within the current framebuffer and sends it to OpenGL.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::ApplyScissorArea() const
+{
+	if (!IsRenderingOffscreen())
+	{
+		glScissor(mScissorArea[0], mScissorArea[1], std::max(mScissorArea[2], 0),
+			std::max(mScissorArea[3], 0));
+		return;
+	}
+
+	const double xScale(static_cast<double>(mImageWidth) / mOffscreenWidth);
+	const double yScale(static_cast<double>(mImageHeight) / mOffscreenHeight);
+	const int left(static_cast<int>(std::round(mScissorArea[0] * xScale)));
+	const int bottom(static_cast<int>(std::round(mScissorArea[1] * yScale)));
+	const int right(static_cast<int>(std::round(
+		(mScissorArea[0] + mScissorArea[2]) * xScale)));
+	const int top(static_cast<int>(std::round(
+		(mScissorArea[1] + mScissorArea[3]) * yScale)));
+
+	glScissor(left - mTile.x, bottom - mTile.y, std::max(right - left, 0),
+		std::max(top - bottom, 0));
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		PrepareOffscreenFramebuffer
+//
+// Description:		Creates the framebuffer for offscreen rendering, or
+//					re-sizes it to match the requested tile size.
+//
+// Input Arguments:
+//		width	= const int&
+//		height	= const int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the framebuffer is ready for use
+//
+//=============================================================================
+bool RenderWindow::PrepareOffscreenFramebuffer(const int& width,
+	const int& height)
+{
+	if (mOffscreenFramebuffer != 0 && width == mOffscreenBufferWidth &&
+		height == mOffscreenBufferHeight)
+		return true;
+
+	GLint windowFramebuffer;
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &windowFramebuffer);
+
+	if (mOffscreenFramebuffer == 0)
+	{
+		glGenFramebuffers(1, &mOffscreenFramebuffer);
+		glGenRenderbuffers(1, &mOffscreenColorbuffer);
+		glGenRenderbuffers(1, &mOffscreenDepthbuffer);
+	}
+
+	glBindRenderbuffer(GL_RENDERBUFFER, mOffscreenColorbuffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+	glBindRenderbuffer(GL_RENDERBUFFER, mOffscreenDepthbuffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, mOffscreenFramebuffer);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+		GL_RENDERBUFFER, mOffscreenColorbuffer);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
+		GL_RENDERBUFFER, mOffscreenDepthbuffer);
+	const bool complete(
+		glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
+	glBindFramebuffer(GL_FRAMEBUFFER, windowFramebuffer);
+
+	if (!complete)
+	{
+		FreeOffscreenFramebuffer();
+		return false;
+	}
+
+	mOffscreenBufferWidth = width;
+	mOffscreenBufferHeight = height;
+	return true;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		FreeOffscreenFramebuffer
+//
+// Description:		Deletes the framebuffer used for offscreen rendering.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::FreeOffscreenFramebuffer()
+{
+	if (mOffscreenFramebuffer != 0)
+	{
+		glDeleteFramebuffers(1, &mOffscreenFramebuffer);
+		glDeleteRenderbuffers(1, &mOffscreenColorbuffer);
+		glDeleteRenderbuffers(1, &mOffscreenDepthbuffer);
+	}
+
+	mOffscreenFramebuffer = 0;
+	mOffscreenColorbuffer = 0;
+	mOffscreenDepthbuffer = 0;
+	mOffscreenBufferWidth = 0;
+	mOffscreenBufferHeight = 0;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		GetSize
+//
+// Description:		Returns the size of the current render target.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		wxSize
+//
+//=============================================================================
+wxSize RenderWindow::GetSize() const
+{
+	if (IsRenderingOffscreen())
+		return wxSize(mOffscreenWidth, mOffscreenHeight);
+
+	return wxGLCanvas::GetSize();
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		GetSize
+//
+// Description:		Returns the size of the current render target.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		width	= int*
+//		height	= int*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::GetSize(int* width, int* height) const
+{
+	if (IsRenderingOffscreen())
+	{
+		if (width)
+			*width = mOffscreenWidth;
+		if (height)
+			*height = mOffscreenHeight;
+	}
+	else
+		wxGLCanvas::GetSize(width, height);
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		DrawWithLayerCache
+//
+// Description:		Draws the scene by copying the cached image of the
+//					non-overlay primitives (re-drawing it first if any of them
+//					have changed) and then drawing the overlays on top.
+//
+// Input Arguments:
+//		sceneModified	= const bool&, true if the view or window size has
+//						  changed since the last render
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::DrawWithLayerCache(const bool& sceneModified)
+{
+	int width, height;
+	GetClientSize(&width, &height);
+
+	// The window's framebuffer is not necessarily framebuffer zero
+	GLint windowFramebuffer;
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &windowFramebuffer);
+
+	// Blitting a single-sample image into a multisample framebuffer is an
+	// error, so the cache can only be used if the window is single-sample
+	GLint sampleBuffers(0);
+	glGetIntegerv(GL_SAMPLE_BUFFERS, &sampleBuffers);
+
+	bool layerModified(sceneModified || !mLayerCacheValid ||
+		width != mLayerWidth || height != mLayerHeight);
+	if (sampleBuffers > 0 || !PrepareLayerFramebuffer(width, height))
+	{
+		// Fall back to drawing everything directly
+		mLayerCacheValid = false;
+		ClearColorBuffer();
+		for (auto& p : mPrimitiveList)
+			p->Draw();
+		return;
+	}
+
+	// Hiding, showing, adding, removing or re-ordering primitives changes
+	// this list
+	std::vector<const Primitive*> layerPrimitives;
+	for (auto& p : mPrimitiveList)
+	{
+		if (p->GetIsOverlay() || !p->IsDrawable())
+			continue;
+
+		if (p->IsModified())
+			layerModified = true;
+		layerPrimitives.push_back(p.get());
+	}
+
+	if (layerPrimitives != mCachedLayerPrimitives)
+		layerModified = true;
+
+	if (layerModified)
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, mLayerFramebuffer);
+		ClearColorBuffer();
+		for (auto& p : mPrimitiveList)
+		{
+			if (!p->GetIsOverlay())
+				p->Draw();
+		}
+
+		mCachedLayerPrimitives = std::move(layerPrimitives);
+		mLayerCacheValid = true;
+	}
+
+	// Blits are clipped by the scissor box
+	const GLboolean scissorEnabled(glIsEnabled(GL_SCISSOR_TEST));
+	glDisable(GL_SCISSOR_TEST);
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, mLayerFramebuffer);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, windowFramebuffer);
+	glBlitFramebuffer(0, 0, width, height, 0, 0, width, height,
+		GL_COLOR_BUFFER_BIT, GL_NEAREST);
+	glBindFramebuffer(GL_FRAMEBUFFER, windowFramebuffer);
+
+	if (scissorEnabled)
+		glEnable(GL_SCISSOR_TEST);
+
+	for (auto& p : mPrimitiveList)
+	{
+		if (p->GetIsOverlay())
+			p->Draw();
+	}
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		PrepareLayerFramebuffer
+//
+// Description:		Creates the offscreen framebuffer for cached layer
+//					rendering, or re-sizes it to match the window.
+//
+// Input Arguments:
+//		width	= const int&
+//		height	= const int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the framebuffer is ready for use
+//
+//=============================================================================
+bool RenderWindow::PrepareLayerFramebuffer(const int& width, const int& height)
+{
+	if (width <= 0 || height <= 0)
+	{
+		mLayerCacheValid = false;
+		return false;
+	}
+
+	if (mLayerFramebuffer != 0 && width == mLayerWidth && height == mLayerHeight)
+		return true;
+
+	GLint windowFramebuffer;
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &windowFramebuffer);
+
+	if (mLayerFramebuffer == 0)
+	{
+		glGenFramebuffers(1, &mLayerFramebuffer);
+		glGenRenderbuffers(1, &mLayerRenderbuffer);
+	}
+
+	glBindRenderbuffer(GL_RENDERBUFFER, mLayerRenderbuffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, mLayerFramebuffer);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+		GL_RENDERBUFFER, mLayerRenderbuffer);
+	const bool complete(
+		glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
+	glBindFramebuffer(GL_FRAMEBUFFER, windowFramebuffer);
+
+	if (!complete)
+	{
+		FreeLayerFramebuffer();
+		return false;
+	}
+
+	mLayerWidth = width;
+	mLayerHeight = height;
+	return true;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		FreeLayerFramebuffer
+//
+// Description:		Deletes the offscreen framebuffer used for cached layer
+//					rendering.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::FreeLayerFramebuffer()
+{
+	if (mLayerFramebuffer != 0)
+	{
+		glDeleteFramebuffers(1, &mLayerFramebuffer);
+		glDeleteRenderbuffers(1, &mLayerRenderbuffer);
+	}
+
+	mLayerFramebuffer = 0;
+	mLayerRenderbuffer = 0;
+	mLayerWidth = 0;
+	mLayerHeight = 0;
+	mLayerCacheValid = false;
+	mCachedLayerPrimitives.clear();
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		ClearColorBuffer
+//
+// Description:		Fills the currently bound color buffer with the background
+//					color.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::ClearColorBuffer() const
+{
+	glClearColor(static_cast<float>(mBackgroundColor.GetRed()),
+		static_cast<float>(mBackgroundColor.GetGreen()),
+		static_cast<float>(mBackgroundColor.GetBlue()),
+		static_cast<float>(mBackgroundColor.GetAlpha()));
+	glClear(GL_COLOR_BUFFER_BIT);
 }
 
 //=============================================================================
 // Class:			RenderWindow
-// Function:		Event Table
+// Function:		GetGLInfo
 //
-// Description:		Event Table for the RENDER_WINDOW class.
+// Description:		Gets useful GL version info and puts it in a string (for debugging).
 //
 // Input Arguments:
 //		None
@@ -201,59 +1127,46 @@ void RenderWindow::FreeOpenGLObjects()
 //		None
 //
 //=============================================================================
-BEGIN_EVENT_TABLE(RenderWindow, wxGLCanvas)
-	// Window events
-	EVT_SIZE(				RenderWindow::OnSize)
-	EVT_PAINT(				RenderWindow::OnPaint)
-	EVT_ENTER_WINDOW(		RenderWindow::OnEnterWindow)
-
-	// Interaction events
-	EVT_MOUSEWHEEL(			RenderWindow::OnMouseWheelEvent)
-	EVT_MOTION(				RenderWindow::OnMouseMoveEvent)
-	EVT_LEFT_UP(			RenderWindow::OnMouseUpEvent)
-	EVT_LEFT_DOWN(			RenderWindow::OnMouseDownEvent)
-	EVT_MIDDLE_UP(			RenderWindow::OnMouseUpEvent)
-	EVT_RIGHT_UP(			RenderWindow::OnMouseUpEvent)
-	EVT_RIGHT_DOWN(			RenderWindow::OnMouseDownEvent)
-END_EVENT_TABLE()
+void RenderWindow::GetGLInfo()
+{
+	std::string info;
+	info.append("Vendor:          " + std::string(reinterpret_cast<const char*>(glGetString(GL_VENDOR))) + '\n');
+	info.append("Renderer:        " + std::string(reinterpret_cast<const char*>(glGetString(GL_RENDERER))) + '\n');
+	info.append("OpenGL version:  " + std::string(reinterpret_cast<const char*>(glGetString(GL_VERSION))) + '\n');
+	info.append("GLSL version:    " + std::string(reinterpret_cast<const char*>(glGetString(GL_SHADING_LANGUAGE_VERSION))) + '\n');
+	std::cerr << info;
+}
 
 //=============================================================================
 // Class:			RenderWindow
-// Function:		GetContext
+// Function:		OnPaint
 //
-// Description:		Gets (or creates, if it doesn't yet exist) the GL context.
+// Description:		Event handler for the paint event.  Obtains the device
+//					context and re-renders the scene.
 //
 // Input Arguments:
-//		None
+//		event	= wxPaintEvent& (UNUSED)
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		wxGLContext*
+//		None
 //
 //=============================================================================
-wxGLContext* RenderWindow::GetContext()
+void RenderWindow::OnPaint(wxPaintEvent& WXUNUSED(event))
 {
-	if (!mContext)
-	{
-		wxGLContextAttrs attributes;
-		attributes.PlatformDefaults().OGLVersion(4, 0).EndList();
-		mContext = std::make_unique<wxGLContext>(this, nullptr, &attributes);
-		assert(mContext->IsOK() && "Minimum OpenGL verison not met (requires 4.0)");
-	}
-
-	return mContext.get();
+    Render();
 }
 
 //=============================================================================
 // Class:			RenderWindow
-// Function:		SetViewportCount
+// Function:		OnSize
 //
-// Description:		Sets the number of viewports.
+// Description:		Event handler for the window re-size event.
 //
 // Input Arguments:
-//		None
+//		event	= wxSizeEvent& (unused)
 //
 // Output Arguments:
 //		None
@@ -262,18 +1175,17 @@ wxGLContext* RenderWindow::GetContext()
 //		None
 //
 //=============================================================================
-void RenderWindow::SetViewportCount(const unsigned int& count)
+void RenderWindow::OnSize(wxSizeEvent& WXUNUSED(event))
 {
-	assert(count > 0);
-	viewportCount = count;
+    mSizeUpdateRequired = true;
+	Refresh();
 }
 
 //=============================================================================
 // Class:			RenderWindow
-// Function:		Render
+// Function:		ScheduleRender
 //
-// Description:		Updates the scene with all of this object's options and
-//					re-draws the image.
+// Description:		Requests a render on the next idle event.
 //
 // Input Arguments:
 //		None
@@ -285,124 +1197,90 @@ void RenderWindow::SetViewportCount(const unsigned int& count)
 //		None
 //
 //=============================================================================
-void RenderWindow::Render()
+void RenderWindow::ScheduleRender()
 {
-	if (!GetContext() || !IsShownOnScreen())
+	if (mRenderPending)
 		return;
 
-	const unsigned int shaderCount(mShaders.size());
-
-	{
-		std::lock_guard<std::mutex> lock(renderMutex);
-
-		SetCurrent(*mContext);
-		wxPaintDC(this);
-
-		assert(!GLHasError());
-
-		if (!mGlewInitialized)
-		{
-			glewExperimental = GL_TRUE;
-			if (glewInit() != GLEW_OK)
-				return;
-
-			// According to https://www.khronos.org/opengl/wiki/OpenGL_Loading_Library, glewInit() may cause
-			// OpenGL error GL_INVALID_ENUM (which we observe) even if everything is actually OK.
-			// So check for errors to clear the error flag.
-#ifdef _DEBUG
-			int e =
-#endif// _DEBUG
-				glGetError();
-
-#ifdef _DEBUG
-			assert(e == GL_NO_ERROR || e == GL_INVALID_ENUM);
-			GetGLInfo();
-#endif// _DEBUG
-			BuildShaders();
-			mGlewInitialized = true;
-		}
-
-		for (unsigned int viewport = 0; viewport < viewportCount; ++viewport)
-		{
-			if (mSizeUpdateRequired || viewport != lastViewportConfigured)
-				DoResize(viewport);
-
-			if (mModified || viewport != lastViewportConfigured)
-				Initialize(viewport);
-			else if (mModelviewModified)
-				UpdateModelviewMatrix();
-
-			if (viewport == 0)
-			{
-				glClearColor(static_cast<float>(mBackgroundColor.GetRed()),
-					static_cast<float>(mBackgroundColor.GetGreen()),
-					static_cast<float>(mBackgroundColor.GetBlue()),
-					static_cast<float>(mBackgroundColor.GetAlpha()));
-
-				if (mView3D)
-					glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-				else
-					glClear(GL_COLOR_BUFFER_BIT);
-			}
-
-			// Sort the primitives by Color.GetAlpha to ensure that transparent objects are rendered last
-			Primitive* firstTransparentPrimitive(nullptr);
-			if (mNeedAlphaSort)
-			{
-				std::sort(mPrimitiveList.begin(), mPrimitiveList.end(), AlphaSortPredicate);
-				mNeedAlphaSort = false;
-
-				if (mView3D)
-				{
-					for (const auto& p : mPrimitiveList)
-					{
-						if (p->GetColor().GetAlpha() < 1.0)
-						{
-							firstTransparentPrimitive = p.get();
-							break;
-						}
-					}
-				}
-			}
-
-			// Generally, all objects will have the same draw order and this won't do anything,
-			// but for some cases we do want to override the draw order just before rendering
-			if (mNeedOrderSort)
-			{
-				std::stable_sort(mPrimitiveList.begin(), mPrimitiveList.end(), OrderSortPredicate);
-				mNeedOrderSort = false;
-			}
+	mRenderPending = true;
+	wxWakeUpIdle();
+}
 
-			// NOTE:  Any primitive that uses it's own program should re-load the default program
-			// by calling RenderWindow::UseDefaultProgram() at the end of GenerateGeometry()
-			for (auto& p : mPrimitiveList)
-			{
-				if (firstTransparentPrimitive && p.get() == firstTransparentPrimitive)
-					glDepthMask(GL_FALSE);
-				p->Draw();
-			}
+//=============================================================================
+// Class:			RenderWindow
+// Function:		OnIdle
+//
+// Description:		Event handler for idle events.  Performs the scheduled
+//					render, or if the previous one was too recent, starts a
+//					timer to perform it at the next display refresh.
+//
+// Input Arguments:
+//		event	= wxIdleEvent&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::OnIdle(wxIdleEvent& event)
+{
+	event.Skip();
+	if (!mRenderPending || mFrameTimer.IsRunning())
+		return;
 
-			if (firstTransparentPrimitive)
-				glDepthMask(GL_TRUE);
+	const auto remaining(GetFrameInterval() - std::chrono::duration_cast<
+		std::chrono::microseconds>(std::chrono::steady_clock::now()
+		- mLastScheduledFrame));
+	if (remaining.count() <= 0)
+		RunScheduledFrame();
+	else
+		mFrameTimer.StartOnce(std::max(1, static_cast<int>(
+			std::chrono::duration_cast<std::chrono::milliseconds>(
+			remaining).count())));
+}
 
-			lastViewportConfigured = viewport;
-		}
+//=============================================================================
+// Class:			RenderWindow
+// Function:		RunScheduledFrame
+//
+// Description:		Updates the layout and renders the scene, if a render was
+//					requested.  The time required is recorded for use in
+//					adapting the rendering quality.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::RunScheduledFrame()
+{
+	if (!mRenderPending)
+		return;
 
-		SwapBuffers();// TODO:  Memory leak here?
-	}
+	mRenderPending = false;
+	mLastScheduledFrame = std::chrono::steady_clock::now();
 
-	// If shaders are added mid-render, we need to re-render to ensure everything gets displayed
-	if (mShaders.size() != shaderCount)
-		Render();
+	UpdateLayout();
+	Refresh();
+	Update();
 
-	assert(!GLHasError());
+	mLastFrameDuration = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - mLastScheduledFrame);
 }
 
 //=============================================================================
 // Class:			RenderWindow
-// Function:		GetGLInfo
+// Function:		GetFrameInterval
 //
-// Description:		Gets useful GL version info and puts it in a string (for debugging).
+// Description:		Returns the refresh interval of the display showing this
+//					window.
 //
 // Input Arguments:
 //		None
@@ -411,49 +1289,100 @@ void RenderWindow::Render()
 //		None
 //
 // Return Value:
-//		None
+//		std::chrono::microseconds
 //
 //=============================================================================
-void RenderWindow::GetGLInfo()
+std::chrono::microseconds RenderWindow::GetFrameInterval() const
 {
-	std::string info;
-	info.append("Vendor:          " + std::string(reinterpret_cast<const char*>(glGetString(GL_VENDOR))) + '\n');
-	info.append("Renderer:        " + std::string(reinterpret_cast<const char*>(glGetString(GL_RENDERER))) + '\n');
-	info.append("OpenGL version:  " + std::string(reinterpret_cast<const char*>(glGetString(GL_VERSION))) + '\n');
-	info.append("GLSL version:    " + std::string(reinterpret_cast<const char*>(glGetString(GL_SHADING_LANGUAGE_VERSION))) + '\n');
-	std::cerr << info;
+	int refreshRate(0);// [Hz]
+	const int display(wxDisplay::GetFromWindow(this));
+	if (display != wxNOT_FOUND)
+		refreshRate = wxDisplay(static_cast<unsigned int>(display))
+			.GetCurrentMode().refresh;
+
+	// Not all platforms report the refresh rate
+	if (refreshRate <= 0)
+		refreshRate = mDefaultRefreshRate;
+
+	return std::chrono::microseconds(1000000 / refreshRate);
 }
 
 //=============================================================================
 // Class:			RenderWindow
-// Function:		OnPaint
+// Function:		GetGlyphAtlasTexture
 //
-// Description:		Event handler for the paint event.  Obtains the device
-//					context and re-renders the scene.
+// Description:		Returns the texture for the specified glyph atlas.  The
+//					texture is re-loaded whenever glyphs have been added to
+//					the atlas since it was last used with this context.
 //
 // Input Arguments:
-//		event	= wxPaintEvent& (UNUSED)
+//		atlas	= const GlyphAtlas&
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		None
+//		GLuint
 //
 //=============================================================================
-void RenderWindow::OnPaint(wxPaintEvent& WXUNUSED(event))
+GLuint RenderWindow::GetGlyphAtlasTexture(const GlyphAtlas& atlas)
 {
-    Render();
+	const auto it(mGlyphAtlasTextures.find(atlas.GetId()));
+	GlyphAtlasTexture* texture;
+	if (it == mGlyphAtlasTextures.end())
+	{
+		texture = &mGlyphAtlasTextures[atlas.GetId()];
+		glGenTextures(1, &texture->id);
+		glBindTexture(GL_TEXTURE_2D, texture->id);
+
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+	}
+	else
+	{
+		texture = &it->second;
+		if (texture->revision == atlas.GetRevision())
+			return texture->id;
+
+		glBindTexture(GL_TEXTURE_2D, texture->id);
+	}
+
+	LP2D_TRACE_SCOPE("gl", "RenderWindow::GetGlyphAtlasTexture");
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	if (texture->width != atlas.GetWidth() ||
+		texture->height != atlas.GetHeight())
+	{
+		texture->width = atlas.GetWidth();
+		texture->height = atlas.GetHeight();
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, texture->width, texture->height,
+			0, GL_RED, GL_UNSIGNED_BYTE, atlas.GetPixels().data());
+	}
+	else
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, texture->width,
+			texture->height, GL_RED, GL_UNSIGNED_BYTE,
+			atlas.GetPixels().data());
+
+	texture->revision = atlas.GetRevision();
+	mFrameStatistics.RecordUpload(atlas.GetPixels().size());
+	assert(!GLHasError());
+
+	return texture->id;
 }
 
 //=============================================================================
 // Class:			RenderWindow
-// Function:		OnSize
+// Function:		PreparePrimitives
 //
-// Description:		Event handler for the window re-size event.
+// Description:		Performs the CPU-intensive portion of the updates for all
+//					primitives in parallel.  The OpenGL portion of the updates
+//					is completed (on this thread) when each primitive is drawn.
 //
 // Input Arguments:
-//		event	= wxSizeEvent& (unused)
+//		None
 //
 // Output Arguments:
 //		None
@@ -462,10 +1391,29 @@ void RenderWindow::OnPaint(wxPaintEvent& WXUNUSED(event))
 //		None
 //
 //=============================================================================
-void RenderWindow::OnSize(wxSizeEvent& WXUNUSED(event))
+void RenderWindow::PreparePrimitives()
 {
-    mSizeUpdateRequired = true;
-	Refresh();
+	LP2D_TRACE_SCOPE("geometry", "RenderWindow::PreparePrimitives");
+
+	FrameStatistics::Clock::time_point start;
+	if (mFrameStatistics.IsRecording())
+		start = FrameStatistics::Clock::now();
+
+	std::vector<Primitive*> toPrepare;
+	for (auto& p : mPrimitiveList)
+	{
+		if (p->BeginPrepare())
+			toPrepare.push_back(p.get());
+	}
+
+	ThreadPool::GetSharedPool().ParallelFor(toPrepare.size(),
+		[&toPrepare](const unsigned int& i)
+	{
+		toPrepare[i]->Prepare();
+	});
+
+	if (mFrameStatistics.IsRecording())
+		mFrameStatistics.RecordPrepare(FrameStatistics::Clock::now() - start);
 }
 
 //=============================================================================
@@ -490,9 +1438,19 @@ void RenderWindow::DoResize(const unsigned int& /*viewportId*/)
 
 	// set GL viewport (not called by wxGLCanvas::OnSize on all platforms...)
 	int w, h;
-	GetClientSize(&w, &h);
+	if (IsRenderingOffscreen())
+	{
+		w = mTile.width;
+		h = mTile.height;
+	}
+	else
+		GetClientSize(&w, &h);
 	glViewport(0, 0, w, h);
 
+	// Each tile requires its own scissor box
+	if (IsRenderingOffscreen())
+		ApplyScissorArea();
+
 	AutoSetFrustum();// This takes care of any change in aspect ratio
 
 	mSizeUpdateRequired = false;
@@ -590,6 +1548,9 @@ void RenderWindow::Initialize(const unsigned int& viewportId)
 		projectionMatrix = Generate2DProjectionMatrix();
 	}
 
+	if (IsRenderingOffscreen())
+		projectionMatrix = GetTileTransform() * projectionMatrix;
+
 	if (mWireFrame)
 		glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 	else
@@ -1275,6 +2236,38 @@ bool RenderWindow::WriteImageToFile(wxString pathAndFileName) const
 	return newImage.SaveFile(pathAndFileName);
 }
 
+//=============================================================================
+// Class:			RenderWindow
+// Function:		WriteImageToFile
+//
+// Description:		Renders the scene offscreen at the specified size and
+//					writes it to file.  The file type is specified by the file
+//					extension.
+//
+// Input Arguments:
+//		pathAndFileName	= wxString specifying the location to save the image to
+//		width			= const unsigned int&
+//		height			= const unsigned int&
+//		scale			= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, indicating success (true) or failure (false)
+//
+//=============================================================================
+bool RenderWindow::WriteImageToFile(wxString pathAndFileName,
+	const unsigned int& width, const unsigned int& height, const double& scale)
+{
+	wxImage newImage(RenderOffscreen(width, height, scale));
+	if (!newImage.IsOk())
+		return false;
+
+	wxInitAllImageHandlers();
+	return newImage.SaveFile(pathAndFileName);
+}
+
 //=============================================================================
 // Class:			RenderWindow
 // Function:		GetImage
@@ -1309,6 +2302,28 @@ wxImage RenderWindow::GetImage() const
 	return newImage;
 }
 
+//=============================================================================
+// Class:			RenderWindow
+// Function:		RenderImage
+//
+// Description:		Re-draws the scene offscreen at the window size and
+//					returns the image.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		wxImage
+//
+//=============================================================================
+wxImage RenderWindow::RenderImage()
+{
+	return RenderOffscreen(GetSize().GetWidth(), GetSize().GetHeight());
+}
+
 //=============================================================================
 // Class:			RenderWindow
 // Function:		IsThisRendererSelected
@@ -20,10 +20,9 @@
 
 // Local headers
 #include "lp2d/renderer/text.h"
+#include "lp2d/renderer/glyphAtlas.h"
 #include "lp2d/renderer/renderWindow.h"
-
-// Freetype headers
-#include FT_MODULE_H
+#include "lp2d/utilities/trace.h"
 
 namespace LibPlot2D
 {
@@ -45,23 +44,22 @@ namespace LibPlot2D
 //
 //=============================================================================
 GLint Text::mVertexLocation;
-GLint Text::mIndexLocation;
-FT_Library Text::mFt;
-unsigned int Text::mFtReferenceCount(0);
 
 const std::string Text::mTextColorName("textColor");
 const std::string Text::mVertexName("vertex");
-const std::string Text::mTextureIndexName("texIndex");
+
+const unsigned int Text::mMaxCachedStrings(512);
 
 //=============================================================================
 // Class:			Text
 // Function:		mVertexShader
 //
-// Description:		Text vertex shader.
+// Description:		Text vertex shader.  Texture coordinates are in pixels
+//					(the size of the atlas may change after the vertex buffer
+//					is built).
 //
 // Input Arguments:
 //		0	= vertex
-//		1	= texIndex
 //
 // Output Arguments:
 //		None
@@ -77,16 +75,13 @@ const std::string Text::mVertexShader(
 	"uniform mat4 modelviewMatrix;\n"
 	"\n"
 	"layout(location = 0) in vec4 vertex;// <vec2 pos, vec2 tex>\n"
-	"layout(location = 1) in uint texIndex;\n"
 	"\n"
 	"out vec2 texCoords;\n"
-	"flat out uint index;\n"
 	"\n"
 	"void main()\n"
 	"{\n"
 	"    gl_Position = projectionMatrix * modelviewMatrix * vec4(vertex.xy, 0.0, 1.0);\n"
 	"    texCoords = vertex.zw;\n"
-	"    index = texIndex;\n"
 	"}\n"
 );
 
@@ -109,17 +104,17 @@ const std::string Text::mVertexShader(
 const std::string Text::mFragmentShader(
 	"#version 400\n"
 	"\n"
-	"uniform sampler2DArray text;\n"
+	"uniform sampler2D text;\n"
 	"uniform vec3 textColor;\n"
 	"\n"
 	"in vec2 texCoords;\n"
-	"flat in uint index;\n"
 	"\n"
 	"out vec4 color;\n"
 	"\n"
 	"void main()\n"
 	"{\n"
-	"    highp vec4 sampled = vec4(1.0, 1.0, 1.0, texture(text, vec3(texCoords, index)).r);\n"
+	"    vec2 normalizedCoords = texCoords / vec2(textureSize(text, 0));\n"
+	"    highp vec4 sampled = vec4(1.0, 1.0, 1.0, texture(text, normalizedCoords).r);\n"
 	"    color = vec4(textColor, 1.0) * sampled;\n"
 	"}\n"
 );
@@ -143,87 +138,33 @@ const std::string Text::mFragmentShader(
 Text::Text(RenderWindow& renderer) : mRenderer(renderer)
 {
 	SetOrientation(0.0);
-	Initialize();
-}
-
-//=============================================================================
-// Class:			Text
-// Function:		~Text
-//
-// Description:		Destructor for Text object.
-//
-// Input Arguments:
-//		None
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		None
-//
-//=============================================================================
-Text::~Text()
-{
-	FreeFTResources();
-
-	if (glIsTexture(mTextureId))
-		glDeleteTextures(1, &mTextureId);
-}
-
-//=============================================================================
-// Class:			Text
-// Function:		Initialize
-//
-// Description:		Initializes the Freetype back-end of this object.  Must
-//					be called prior to any other post-creation method.
-//
-// Input Arguments:
-//		None
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		None
-//
-//=============================================================================
-void Text::Initialize()
-{
-	assert(!mGlyphsGenerated);
-	assert(mIsOK);
-
-	if (mFtReferenceCount == 0)
-	{
-		if (FT_Init_FreeType(&mFt))
-			mIsOK = false;
-	}
-
-	++mFtReferenceCount;
 }
 
 //=============================================================================
 // Class:			Text
 // Function:		SetFace
 //
-// Description:		Initializes the Freetype back-end of this object.  Must
-//					be called prior to any other post-creation method.
+// Description:		Sets the font file to use for rendering.
 //
 // Input Arguments:
-//		None
+//		fontFileName	= const std::string&
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		None
+//		bool, true if the font file can be loaded
 //
 //=============================================================================
 bool Text::SetFace(const std::string& fontFileName)
 {
-	assert(!mGlyphsGenerated);
-	if (FT_New_Face(mFt, fontFileName.c_str(), 0, &mFace))
+	if (!GlyphAtlas::FontFileIsValid(fontFileName))
 		return false;
 
+	mFontFileName = fontFileName;
+	mAtlas.reset();
+	mLayoutCache.clear();
+	mIsOK = true;
 	return true;
 }
 
@@ -268,15 +209,19 @@ void Text::SetSize(const double& height)
 //=============================================================================
 void Text::SetSize(const double& width, const double& height)
 {
-	assert(!mGlyphsGenerated);
-	FT_Set_Pixel_Sizes(mFace, width, height);
+	mWidth = static_cast<unsigned int>(width);
+	mHeight = static_cast<unsigned int>(height);
+	mAtlas.reset();
+	mLayoutCache.clear();
+	mIsOK = true;
 }
 
 //=============================================================================
 // Class:			Text
-// Function:		GenerateGlyphs
+// Function:		GetAtlas
 //
-// Description:		Generates the set of glyphs.
+// Description:		Returns the glyph atlas for the current font and size,
+//					obtaining it from the shared cache if necessary.
 //
 // Input Arguments:
 //		None
@@ -285,105 +230,100 @@ void Text::SetSize(const double& width, const double& height)
 //		None
 //
 // Return Value:
-//		bool, true for success, false otherwise
+//		GlyphAtlas*, nullptr if the font could not be loaded
 //
 //=============================================================================
-bool Text::GenerateGlyphs()
+GlyphAtlas* Text::GetAtlas()
 {
-	assert(!RenderWindow::GLHasError());
-	assert(!mGlyphsGenerated);// Doing this twice could leak memory via OpenGL
-
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-	Glyph g;
-	GLubyte c;
-
-	mMaxXSize = 0;
-	mMaxYSize = 0;
-
-	if (FT_Select_Charmap(mFace, FT_ENCODING_UNICODE))
-		return false;
-
-	// First loop determines max required image size
-	const unsigned int glyphCount(128);
-	for (c = 0; c < glyphCount; ++c)
-	{
-		if (FT_Load_Char(mFace, c, FT_LOAD_RENDER))
-			return false;
-
-		mMaxXSize = std::max(mMaxXSize, mFace->glyph->bitmap.width);
-		mMaxYSize = std::max(mMaxYSize, mFace->glyph->bitmap.rows);
-	}
-
-	glGenTextures(1, &mTextureId);
-	glBindTexture(GL_TEXTURE_2D_ARRAY, mTextureId);
-
-	glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RED, mMaxXSize, mMaxYSize, glyphCount,
-		0, GL_RED, GL_UNSIGNED_BYTE, nullptr);
-
-	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BASE_LEVEL, 0);
-	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, 0);
-
-	// Second loop actually builds and stores the textures
-	for (c = 0; c < glyphCount; ++c)
+	if (!mAtlas && IsOK())
 	{
-		if (FT_Load_Char(mFace, c, FT_LOAD_RENDER))
-			return false;
-
-		int w, h, d;
-		glGetTexLevelParameteriv(GL_TEXTURE_2D_ARRAY, 0, GL_TEXTURE_WIDTH, &w);
-		glGetTexLevelParameteriv(GL_TEXTURE_2D_ARRAY, 0, GL_TEXTURE_HEIGHT, &h);
-		glGetTexLevelParameteriv(GL_TEXTURE_2D_ARRAY, 0, GL_TEXTURE_DEPTH, &d);
-
-		glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, c,
-			mFace->glyph->bitmap.width, mFace->glyph->bitmap.rows, 1,
-			GL_RED, GL_UNSIGNED_BYTE, mFace->glyph->bitmap.buffer);// TODO:  Memory leak here
-
-		g.index = c;
-		g.xSize = mFace->glyph->bitmap.width;
-		g.ySize = mFace->glyph->bitmap.rows;
-		g.xBearing = mFace->glyph->bitmap_left;
-		g.yBearing = mFace->glyph->bitmap_top;
-		g.advance = mFace->glyph->advance.x;
-
-		mGlyphs.insert(std::make_pair(c, g));
+		mLayoutCache.clear();
+		mAtlas = GlyphAtlas::Get(mFontFileName, mWidth, mHeight);
+		if (!mAtlas)
+			mIsOK = false;
 	}
 
-	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
-	mGlyphsGenerated = true;
-
-	assert(!RenderWindow::GLHasError());
-	return true;
+	return mAtlas.get();
 }
 
 //=============================================================================
 // Class:			Text
-// Function:		FreeFTResources
+// Function:		DecodeUTF8
 //
-// Description:		Frees previously allocated Freetype resources (with
-//					reference counting).
+// Description:		Converts the specified UTF-8 string into Unicode code
+//					points.  Bytes which are not part of a valid UTF-8
+//					sequence are interpreted as Latin-1 characters.
 //
 // Input Arguments:
-//		None
+//		s	= const std::string&
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		None
+//		std::u32string
 //
 //=============================================================================
-void Text::FreeFTResources()
+std::u32string Text::DecodeUTF8(const std::string& s)
 {
-	FT_Done_Face(mFace);
+	std::u32string codes;
+	codes.reserve(s.length());
 
-	assert(mFtReferenceCount > 0);
-	--mFtReferenceCount;
-	if (mFtReferenceCount == 0)
-		FT_Done_FreeType(mFt);
+	std::string::size_type i(0);
+	while (i < s.length())
+	{
+		const unsigned char lead(static_cast<unsigned char>(s[i]));
+		unsigned int length;
+		char32_t code;
+		if (lead < 0x80)
+		{
+			length = 1;
+			code = lead;
+		}
+		else if ((lead & 0xE0) == 0xC0)
+		{
+			length = 2;
+			code = lead & 0x1F;
+		}
+		else if ((lead & 0xF0) == 0xE0)
+		{
+			length = 3;
+			code = lead & 0x0F;
+		}
+		else if ((lead & 0xF8) == 0xF0)
+		{
+			length = 4;
+			code = lead & 0x07;
+		}
+		else
+			length = 0;
+
+		unsigned int j;
+		for (j = 1; j < length; ++j)
+		{
+			if (i + j >= s.length() ||
+				(static_cast<unsigned char>(s[i + j]) & 0xC0) != 0x80)
+			{
+				length = 0;
+				break;
+			}
+
+			code = (code << 6) | (static_cast<unsigned char>(s[i + j]) & 0x3F);
+		}
+
+		if (length == 0)
+		{
+			codes.push_back(lead);
+			++i;
+		}
+		else
+		{
+			codes.push_back(code);
+			i += length;
+		}
+	}
+
+	return codes;
 }
 
 //=============================================================================
@@ -404,6 +344,8 @@ void Text::FreeFTResources()
 //=============================================================================
 Primitive::BufferInfo Text::BuildText()
 {
+	mRenderer.InitializePrimitiveType(*this);
+
 	if (mBufferVector.size() > 0)
 		return AssembleBuffers();
 
@@ -433,6 +375,10 @@ void Text::RenderBufferedGlyph(const unsigned int& vertexCount)
 {
 	assert(vertexCount > 0);
 
+	GlyphAtlas* atlas(GetAtlas());
+	if (!atlas)
+		return;
+
 	mRenderer.UseProgram(mRenderer.GetPrimitiveTypeProgram<Text>());
 
 	// TODO:  Really, we don't want to access state here that isn't contained within BufferInfo
@@ -443,12 +389,12 @@ void Text::RenderBufferedGlyph(const unsigned int& vertexCount)
 	RenderWindow::SendUniformMatrix(mModelview, mRenderer.GetActiveProgramInfo().uniformLocations.find(RenderWindow::mModelviewName)->second);
 
 	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D_ARRAY, mTextureId);
+	glBindTexture(GL_TEXTURE_2D, mRenderer.GetGlyphAtlasTexture(*atlas));
 
 	glDrawArrays(GL_TRIANGLES, 0, vertexCount);
 
 	mRenderer.UseDefaultProgram();
-	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+	glBindTexture(GL_TEXTURE_2D, 0);
 
 	assert(!RenderWindow::GLHasError());
 }
@@ -472,29 +418,16 @@ void Text::RenderBufferedGlyph(const unsigned int& vertexCount)
 //=============================================================================
 Text::BoundingBox Text::GetBoundingBox(const std::string& s)
 {
-	DoInternalInitialization();
-	mRenderer.InitializePrimitiveType(*this);
-
 	BoundingBox b;
 	b.xLeft = 0;
 	b.xRight = 0;
 	b.yUp = 0;
 	b.yDown = 0;
 
-	for (const auto& c : s)
-	{
-		const auto glyphIt(mGlyphs.find(c));
-		if (glyphIt == mGlyphs.end())
-			continue;
-
-		Glyph g = glyphIt->second;
-
-		//b.xLeft += 0;
-		b.xRight += g.advance >> 6;
-		b.yUp = std::max(b.yUp, g.yBearing);
-		b.yDown = std::min(b.yDown, g.yBearing - g.ySize);
-	}
+	if (!GetAtlas())
+		return b;
 
+	b = GetLayout(s).boundingBox;
 	b.xLeft *= mScale;
 	b.xRight *= mScale;
 	b.yUp *= mScale;
@@ -503,31 +436,6 @@ Text::BoundingBox Text::GetBoundingBox(const std::string& s)
 	return b;
 }
 
-//=============================================================================
-// Class:			Text
-// Function:		DoInternalInitialization
-//
-// Description:		Performs necessary static-state initialization.
-//
-// Input Arguments:
-//		None
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		None
-//
-//=============================================================================
-void Text::DoInternalInitialization()
-{
-	if (!mGlyphsGenerated)
-	{
-		if (!GenerateGlyphs())
-			mIsOK = false;
-	}
-}
-
 //=============================================================================
 // Class:			Text
 // Function:		DoGLInitialization
@@ -561,12 +469,10 @@ GLuint Text::DoGLInitialization()
 	assert(!RenderWindow::GLHasError());
 
 	mVertexLocation = glGetAttribLocation(s.programId, mVertexName.c_str());
-	mIndexLocation = glGetAttribLocation(s.programId, mTextureIndexName.c_str());
 
 	assert(!RenderWindow::GLHasError());
 
 	s.attributeLocations[mVertexName] = mVertexLocation;
-	s.attributeLocations[mTextureIndexName] = mIndexLocation;
 
 	return mRenderer.AddShader(s);
 }
@@ -642,9 +548,6 @@ Primitive::BufferInfo Text::AssembleBuffers()
 
 	for (const auto& buffer : mBufferVector)
 	{
-		bufferInfo.indexBuffer.insert(bufferInfo.indexBuffer.end(),
-			buffer.indexBuffer.begin(),
-			buffer.indexBuffer.end());
 		bufferInfo.vertexBuffer.insert(bufferInfo.vertexBuffer.end(),
 			buffer.vertexBuffer.begin(),
 			buffer.vertexBuffer.end());
@@ -676,71 +579,126 @@ Primitive::BufferInfo Text::AssembleBuffers()
 //=============================================================================
 Primitive::BufferInfo Text::BuildLocalText()
 {
-	DoInternalInitialization();
-	mRenderer.InitializePrimitiveType(*this);
+	Primitive::BufferInfo bufferInfo;
+	if (!GetAtlas())
+		return bufferInfo;
+
+	const StringLayout& layout(GetLayout(mText));
+	bufferInfo.vertexCount = layout.vertices.size() / 4;
+	bufferInfo.vertexBuffer.resize(layout.vertices.size());
+
+	unsigned int i;
+	for (i = 0; i < layout.vertices.size(); i += 4)
+	{
+		bufferInfo.vertexBuffer[i] = mX + layout.vertices[i] * mScale;
+		bufferInfo.vertexBuffer[i + 1] = mY + layout.vertices[i + 1] * mScale;
+		bufferInfo.vertexBuffer[i + 2] = layout.vertices[i + 2];
+		bufferInfo.vertexBuffer[i + 3] = layout.vertices[i + 3];
+	}
+
+	return bufferInfo;
+}
+
+//=============================================================================
+// Class:			Text
+// Function:		GetLayout
+//
+// Description:		Returns the layout of the specified string at unit scale
+//					with the origin at zero, generating it if it is not in
+//					the cache.  Must only be called when the atlas is valid.
+//
+// Input Arguments:
+//		s	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const StringLayout&
+//
+//=============================================================================
+const Text::StringLayout& Text::GetLayout(const std::string& s)
+{
+	const auto it(mLayoutCache.find(s));
+	if (it != mLayoutCache.end())
+		return it->second;
+
+	// Strings which are no longer in use are not tracked, so just start over
+	// when the cache gets too large
+	if (mLayoutCache.size() >= mMaxCachedStrings)
+		mLayoutCache.clear();
 
+	assert(mAtlas);
 	assert(sizeof(GLfloat) == sizeof(float));
-	assert(sizeof(GLuint) == sizeof(unsigned int));
 
-	Primitive::BufferInfo bufferInfo;
-	bufferInfo.vertexCount = 6 * mText.length();
-	bufferInfo.vertexBuffer.resize(bufferInfo.vertexCount * 4);
-	bufferInfo.indexBuffer.resize(bufferInfo.vertexCount);
+	const std::u32string codes(DecodeUTF8(s));
+
+	StringLayout layout;
+	layout.boundingBox.xLeft = 0;
+	layout.boundingBox.xRight = 0;
+	layout.boundingBox.yUp = 0;
+	layout.boundingBox.yDown = 0;
+	layout.vertices.resize(6 * 4 * codes.length());
 
-	double xStart(mX);
+	int xStart(0);
 
-	unsigned int i(0), texI(0);
-	for (const auto &c : mText)
+	unsigned int i(0);
+	for (const auto &c : codes)
 	{
-		Glyph g = mGlyphs[c];
-
-		GLfloat xpos = xStart + g.xBearing * mScale;
-		GLfloat ypos = mY - (g.ySize - g.yBearing) * mScale;
-
-		GLfloat w = g.xSize * mScale;
-		GLfloat h = g.ySize * mScale;
-
-		bufferInfo.indexBuffer[texI++] = g.index;
-		bufferInfo.indexBuffer[texI++] = g.index;
-		bufferInfo.indexBuffer[texI++] = g.index;
-		bufferInfo.indexBuffer[texI++] = g.index;
-		bufferInfo.indexBuffer[texI++] = g.index;
-		bufferInfo.indexBuffer[texI++] = g.index;
-
-		bufferInfo.vertexBuffer[i++] = xpos;
-		bufferInfo.vertexBuffer[i++] = ypos;
-		bufferInfo.vertexBuffer[i++] = 0.0;
-		bufferInfo.vertexBuffer[i++] = float(g.ySize) / float(mMaxYSize);
-
-		bufferInfo.vertexBuffer[i++] = xpos;
-		bufferInfo.vertexBuffer[i++] = ypos + h;
-		bufferInfo.vertexBuffer[i++] = 0.0;
-		bufferInfo.vertexBuffer[i++] = 0.0;
-
-		bufferInfo.vertexBuffer[i++] = xpos + w;
-		bufferInfo.vertexBuffer[i++] = ypos + h;
-		bufferInfo.vertexBuffer[i++] = float(g.xSize) / float(mMaxXSize);
-		bufferInfo.vertexBuffer[i++] = 0.0;
-
-		bufferInfo.vertexBuffer[i++] = xpos + w;
-		bufferInfo.vertexBuffer[i++] = ypos + h;
-		bufferInfo.vertexBuffer[i++] = float(g.xSize) / float(mMaxXSize);
-		bufferInfo.vertexBuffer[i++] = 0.0;
-
-		bufferInfo.vertexBuffer[i++] = xpos + w;
-		bufferInfo.vertexBuffer[i++] = ypos;
-		bufferInfo.vertexBuffer[i++] = float(g.xSize) / float(mMaxXSize);
-		bufferInfo.vertexBuffer[i++] = float(g.ySize) / float(mMaxYSize);
-
-		bufferInfo.vertexBuffer[i++] = xpos;
-		bufferInfo.vertexBuffer[i++] = ypos;
-		bufferInfo.vertexBuffer[i++] = 0.0;
-		bufferInfo.vertexBuffer[i++] = float(g.ySize) / float(mMaxYSize);
-
-		xStart += (g.advance >> 6) * mScale;// Bitshift by 6 to get value in pixels (2^6 = 64)
-    }
+		const GlyphAtlas::Glyph& g(mAtlas->GetGlyph(c));
+
+		GLfloat xpos = xStart + g.xBearing;
+		GLfloat ypos = -(g.ySize - g.yBearing);
+
+		GLfloat w = g.xSize;
+		GLfloat h = g.ySize;
+
+		// Texture coordinates are in pixels, with the top row of the glyph
+		// image at g.y
+		const GLfloat left(static_cast<GLfloat>(g.x));
+		const GLfloat right(static_cast<GLfloat>(g.x + g.xSize));
+		const GLfloat top(static_cast<GLfloat>(g.y));
+		const GLfloat bottom(static_cast<GLfloat>(g.y + g.ySize));
+
+		layout.vertices[i++] = xpos;
+		layout.vertices[i++] = ypos;
+		layout.vertices[i++] = left;
+		layout.vertices[i++] = bottom;
+
+		layout.vertices[i++] = xpos;
+		layout.vertices[i++] = ypos + h;
+		layout.vertices[i++] = left;
+		layout.vertices[i++] = top;
+
+		layout.vertices[i++] = xpos + w;
+		layout.vertices[i++] = ypos + h;
+		layout.vertices[i++] = right;
+		layout.vertices[i++] = top;
+
+		layout.vertices[i++] = xpos + w;
+		layout.vertices[i++] = ypos + h;
+		layout.vertices[i++] = right;
+		layout.vertices[i++] = top;
+
+		layout.vertices[i++] = xpos + w;
+		layout.vertices[i++] = ypos;
+		layout.vertices[i++] = right;
+		layout.vertices[i++] = bottom;
+
+		layout.vertices[i++] = xpos;
+		layout.vertices[i++] = ypos;
+		layout.vertices[i++] = left;
+		layout.vertices[i++] = bottom;
+
+		xStart += g.advance >> 6;// Bitshift by 6 to get value in pixels (2^6 = 64)
+
+		layout.boundingBox.xRight = xStart;
+		layout.boundingBox.yUp = std::max(layout.boundingBox.yUp, g.yBearing);
+		layout.boundingBox.yDown = std::min(layout.boundingBox.yDown,
+			g.yBearing - g.ySize);
+	}
 
-	return bufferInfo;
+	return mLayoutCache.emplace(s, std::move(layout)).first->second;
 }
 
 //=============================================================================
@@ -761,25 +719,24 @@ Primitive::BufferInfo Text::BuildLocalText()
 //=============================================================================
 void Text::ConfigureVertexArray(Primitive::BufferInfo& bufferInfo) const
 {
-	bufferInfo.GetOpenGLIndices(true);
+	LP2D_TRACE_SCOPE("gl", "Text::ConfigureVertexArray");
+
+	bufferInfo.GetOpenGLIndices();
 	glBindVertexArray(bufferInfo.GetVertexArrayIndex());
 
 	glBindBuffer(GL_ARRAY_BUFFER, bufferInfo.GetVertexBufferIndex());
     glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * bufferInfo.vertexBuffer.size(),
 		bufferInfo.vertexBuffer.data(), GL_DYNAMIC_DRAW);
+	mRenderer.GetFrameStatistics().RecordUpload(
+		sizeof(GLfloat) * bufferInfo.vertexBuffer.size());
 
 	glEnableVertexAttribArray(mVertexLocation);
 	glVertexAttribPointer(mVertexLocation, 4, GL_FLOAT, GL_FALSE, 0, 0);
 
-	glBindBuffer(GL_ARRAY_BUFFER, bufferInfo.GetIndexBufferIndex());
-	glBufferData(GL_ARRAY_BUFFER, sizeof(GLuint) * bufferInfo.indexBuffer.size(),
-		bufferInfo.indexBuffer.data(), GL_DYNAMIC_DRAW);
-
-	glEnableVertexAttribArray(mIndexLocation);
-	glVertexAttribIPointer(mIndexLocation, 1, GL_UNSIGNED_INT, 0, 0);
-
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
+
+	bufferInfo.vertexCountModified = false;
 }
 
 }// namespace LibPlot2D
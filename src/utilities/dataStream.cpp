@@ -0,0 +1,177 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  dataStream.cpp
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Lock-free single-producer/single-consumer buffer for streaming
+//        samples from an external thread to a plotted curve.
+
+// Local headers
+#include "lp2d/utilities/dataStream.h"
+#include "lp2d/utilities/dataset2D.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cassert>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			DataStream
+// Function:		DataStream
+//
+// Description:		Constructor for DataStream class.
+//
+// Input Arguments:
+//		capacity	= const unsigned int&
+//		policy		= const OverflowPolicy&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+DataStream::DataStream(const unsigned int& capacity,
+	const OverflowPolicy& policy) : mCapacity(std::max(capacity, 1U)),
+	mPolicy(policy), mBuffer(new Sample[mCapacity])
+{
+}
+
+//=============================================================================
+// Class:			DataStream
+// Function:		Push
+//
+// Description:		Adds a block of samples to the buffer.  When the buffer is
+//					full, either waits for the consumer or discards the oldest
+//					samples, according to the overflow policy.
+//
+// Input Arguments:
+//		x		= const double*
+//		y		= const double*
+//		count	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int, number of samples added
+//
+//=============================================================================
+unsigned int DataStream::Push(const double* x, const double* y,
+	const unsigned int& count)
+{
+	unsigned long long head(mHead.load(std::memory_order_relaxed));
+	unsigned int pushed(0);
+	while (pushed < count && !mClosed)
+	{
+		unsigned long long tail(mTail.load(std::memory_order_acquire));
+		const unsigned long long space(mCapacity - (head - tail));
+		if (space == 0)
+		{
+			if (mPolicy == OverflowPolicy::Block)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				continue;
+			}
+
+			// Claim the oldest slots before overwriting them; this fails if
+			// the consumer has just read past them, in which case there is
+			// now room without dropping anything
+			const unsigned long long drop(std::min<unsigned long long>(
+				count - pushed, mCapacity));
+			if (mTail.compare_exchange_strong(tail, tail + drop,
+				std::memory_order_acq_rel))
+				mDropped += drop;
+			continue;
+		}
+
+		const unsigned int n(static_cast<unsigned int>(
+			std::min<unsigned long long>(space, count - pushed)));
+		unsigned int i;
+		for (i = 0; i < n; ++i)
+		{
+			Sample& sample(mBuffer[(head + i) % mCapacity]);
+			sample.x.store(x[pushed + i], std::memory_order_relaxed);
+			sample.y.store(y[pushed + i], std::memory_order_relaxed);
+		}
+
+		head += n;
+		pushed += n;
+		mHead.store(head, std::memory_order_release);
+	}
+
+	return pushed;
+}
+
+//=============================================================================
+// Class:			DataStream
+// Function:		Drain
+//
+// Description:		Moves the samples which are unread at the time of the
+//					call to the end of the specified dataset.  Samples pushed
+//					during the call are left for the next call, so a fast
+//					producer cannot keep the main thread here indefinitely.
+//					Samples are read in chunks; if the producer discards part
+//					of a chunk while it is being read, the chunk is discarded
+//					and read again from the new tail.
+//
+// Input Arguments:
+//		target	= Dataset2D&
+//
+// Output Arguments:
+//		target	= Dataset2D&
+//
+// Return Value:
+//		unsigned int, number of samples appended
+//
+//=============================================================================
+unsigned int DataStream::Drain(Dataset2D& target)
+{
+	const unsigned long long chunkSize(std::max(mCapacity / 4, 1U));
+	std::vector<double> x, y;
+	unsigned int count(0);
+	const unsigned long long head(mHead.load(std::memory_order_acquire));
+	while (true)
+	{
+		// Under the drop-oldest policy, the tail may pass the snapshot
+		unsigned long long tail(mTail.load(std::memory_order_acquire));
+		if (tail >= head)
+			break;
+
+		const unsigned long long n(std::min(head - tail, chunkSize));
+		x.resize(n);
+		y.resize(n);
+		unsigned long long i;
+		for (i = 0; i < n; ++i)
+		{
+			const Sample& sample(mBuffer[(tail + i) % mCapacity]);
+			x[i] = sample.x.load(std::memory_order_relaxed);
+			y[i] = sample.y.load(std::memory_order_relaxed);
+		}
+
+		if (mTail.compare_exchange_strong(tail, tail + n,
+			std::memory_order_acq_rel))
+		{
+			// Appending (as opposed to modifying the data directly) allows
+			// curves to extend their cached geometry
+			target.Append(x, y);
+			count += static_cast<unsigned int>(n);
+		}
+	}
+
+	return count;
+}
+
+}// namespace LibPlot2D
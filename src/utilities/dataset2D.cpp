@@ -28,6 +28,24 @@
 namespace LibPlot2D
 {
 
+//=============================================================================
+// Class:			Dataset2D
+// Function:		Constant declarations
+//
+// Description:		Constant declarations for Dataset2D class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+std::atomic<unsigned long long> Dataset2D::mNextRevision(0);
+
 //=============================================================================
 // Class:			Dataset2D
 // Function:		Dataset2D
@@ -67,9 +85,39 @@ Dataset2D::Dataset2D(const unsigned int &numberOfPoints)
 //=============================================================================
 void Dataset2D::Reverse()
 {
+	MarkModified();
 	std::reverse(mYData.begin(), mYData.end());
 }
 
+//=============================================================================
+// Class:			Dataset2D
+// Function:		Append
+//
+// Description:		Adds the specified points to the end of the data.
+//
+// Input Arguments:
+//		x	= const std::vector<double>&
+//		y	= const std::vector<double>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void Dataset2D::Append(const std::vector<double>& x,
+	const std::vector<double>& y)
+{
+	assert(x.size() == y.size());
+	if (x.empty())
+		return;
+
+	mRevision = ++mNextRevision;
+	mXData.insert(mXData.end(), x.begin(), x.end());
+	mYData.insert(mYData.end(), y.begin(), y.end());
+}
+
 //=============================================================================
 // Class:			Dataset2D
 // Function:		Resize
@@ -89,6 +137,7 @@ void Dataset2D::Reverse()
 //=============================================================================
 void Dataset2D::Resize(const unsigned int &numberOfPoints)
 {
+	MarkModified();
 	mXData.resize(numberOfPoints);
 	mYData.resize(numberOfPoints);
 }
@@ -202,6 +251,7 @@ bool Dataset2D::GetYAt(const double &x, double &y, bool *exactValue) const
 //=============================================================================
 Dataset2D& Dataset2D::XShift(const double &shift)
 {
+	MarkModified();
 	for (auto& x : mXData)
 		x += shift;
 
@@ -226,6 +276,7 @@ Dataset2D& Dataset2D::XShift(const double &shift)
 //=============================================================================
 Dataset2D& Dataset2D::WrapData(const double& rolloverPoint)
 {
+	MarkModified();
 	const double halfRollover(rolloverPoint * 0.5);
 	for (auto& y : mYData)
 	{
@@ -256,6 +307,7 @@ Dataset2D& Dataset2D::WrapData(const double& rolloverPoint)
 //=============================================================================
 Dataset2D& Dataset2D::UnwrapData(const double& rolloverPoint)
 {
+	MarkModified();
 	unsigned int i;
 	for (i = 1; i < mYData.size(); ++i)
 	{
@@ -295,6 +347,7 @@ Dataset2D& Dataset2D::UnwrapData(const double& rolloverPoint)
 //=============================================================================
 Dataset2D& Dataset2D::operator+=(const Dataset2D &target)
 {
+	MarkModified();
 	assert(mYData.size() == target.mYData.size());
 
 	unsigned int i;
@@ -322,6 +375,7 @@ Dataset2D& Dataset2D::operator+=(const Dataset2D &target)
 //=============================================================================
 Dataset2D& Dataset2D::operator-=(const Dataset2D &target)
 {
+	MarkModified();
 	assert(mYData.size() == target.mYData.size());
 
 	unsigned int i;
@@ -349,6 +403,7 @@ Dataset2D& Dataset2D::operator-=(const Dataset2D &target)
 //=============================================================================
 Dataset2D& Dataset2D::operator*=(const Dataset2D &target)
 {
+	MarkModified();
 	assert(mYData.size() == target.mYData.size());
 
 	unsigned int i;
@@ -376,6 +431,7 @@ Dataset2D& Dataset2D::operator*=(const Dataset2D &target)
 //=============================================================================
 Dataset2D& Dataset2D::operator/=(const Dataset2D &target)
 {
+	MarkModified();
 	assert(mYData.size() == target.mYData.size());
 
 	unsigned int i;
@@ -499,6 +555,7 @@ const Dataset2D Dataset2D::operator/(const Dataset2D &target) const
 //=============================================================================
 Dataset2D& Dataset2D::operator+=(const double &target)
 {
+	MarkModified();
 	for (auto& y : mYData)
 		y += target;
 
@@ -523,6 +580,7 @@ Dataset2D& Dataset2D::operator+=(const double &target)
 //=============================================================================
 Dataset2D& Dataset2D::operator-=(const double &target)
 {
+	MarkModified();
 	for (auto& y : mYData)
 		y -= target;
 
@@ -547,6 +605,7 @@ Dataset2D& Dataset2D::operator-=(const double &target)
 //=============================================================================
 Dataset2D& Dataset2D::operator*=(const double &target)
 {
+	MarkModified();
 	for (auto& y : mYData)
 		y *= target;
 
@@ -571,6 +630,7 @@ Dataset2D& Dataset2D::operator*=(const double &target)
 //=============================================================================
 Dataset2D& Dataset2D::operator/=(const double &target)
 {
+	MarkModified();
 	for (auto& y : mYData)
 		y /= target;
 
@@ -717,6 +777,7 @@ const Dataset2D Dataset2D::operator%(const double &target) const
 //=============================================================================
 Dataset2D& Dataset2D::MultiplyXData(const double &target)
 {
+	MarkModified();
 	for (auto& x : mXData)
 		x *= target;
 
@@ -741,6 +802,7 @@ Dataset2D& Dataset2D::MultiplyXData(const double &target)
 //=============================================================================
 Dataset2D& Dataset2D::ToPower(const double &target)
 {
+	MarkModified();
 	for (auto& y : mYData)
 		y = pow(y, target);
 
@@ -765,6 +827,7 @@ Dataset2D& Dataset2D::ToPower(const double &target)
 //=============================================================================
 Dataset2D& Dataset2D::ToPower(const Dataset2D &target)
 {
+	MarkModified();
 	assert(mYData.size() == target.mYData.size());
 
 	unsigned int i;
@@ -865,6 +928,7 @@ unsigned int Dataset2D::GetNumberOfZoomedPoints(const double &min, const double
 //=============================================================================
 Dataset2D& Dataset2D::DoLog()
 {
+	MarkModified();
 	for (auto& y : mYData)
 		y = log(y);
 
@@ -889,6 +953,7 @@ Dataset2D& Dataset2D::DoLog()
 //=============================================================================
 Dataset2D& Dataset2D::DoLog10()
 {
+	MarkModified();
 	for (auto& y : mYData)
 		y = log10(y);
 
@@ -913,6 +978,7 @@ Dataset2D& Dataset2D::DoLog10()
 //=============================================================================
 Dataset2D& Dataset2D::DoExp()
 {
+	MarkModified();
 	for (auto& y : mYData)
 		y = exp(y);
 
@@ -937,6 +1003,7 @@ Dataset2D& Dataset2D::DoExp()
 //=============================================================================
 Dataset2D& Dataset2D::DoAbs()
 {
+	MarkModified();
 	for (auto& y : mYData)
 		y = fabs(y);
 
@@ -961,6 +1028,7 @@ Dataset2D& Dataset2D::DoAbs()
 //=============================================================================
 Dataset2D& Dataset2D::DoSin()
 {
+	MarkModified();
 	for (auto& y : mYData)
 		y = sin(y);
 
@@ -985,6 +1053,7 @@ Dataset2D& Dataset2D::DoSin()
 //=============================================================================
 Dataset2D& Dataset2D::DoCos()
 {
+	MarkModified();
 	for (auto& y : mYData)
 		y = cos(y);
 
@@ -1009,6 +1078,7 @@ Dataset2D& Dataset2D::DoCos()
 //=============================================================================
 Dataset2D& Dataset2D::DoTan()
 {
+	MarkModified();
 	for (auto& y : mYData)
 		y = tan(y);
 
@@ -1033,6 +1103,7 @@ Dataset2D& Dataset2D::DoTan()
 //=============================================================================
 Dataset2D& Dataset2D::DoArcSin()
 {
+	MarkModified();
 	for (auto& y : mYData)
 		y = asin(y);
 
@@ -1057,6 +1128,7 @@ Dataset2D& Dataset2D::DoArcSin()
 //=============================================================================
 Dataset2D& Dataset2D::DoArcCos()
 {
+	MarkModified();
 	for (auto& y : mYData)
 		y = acos(y);
 
@@ -1081,6 +1153,7 @@ Dataset2D& Dataset2D::DoArcCos()
 //=============================================================================
 Dataset2D& Dataset2D::DoArcTan()
 {
+	MarkModified();
 	for (auto& y : mYData)
 		y = atan(y);
 
@@ -1326,6 +1399,7 @@ const Dataset2D Dataset2D::DoArcTan() const
 //=============================================================================
 Dataset2D& Dataset2D::ApplyPower(const double &target)
 {
+	MarkModified();
 	for (auto& y : mYData)
 		y = pow(target, y);
 	return *this;
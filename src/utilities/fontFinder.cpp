@@ -15,11 +15,19 @@
 // Standard C++ headers
 #include <cstdlib>
 #include <fstream>
+#include <sstream>
 
 // wxWidgets headers
 #include <wx/wx.h>
 #include <wx/dir.h>
 #include <wx/fontenum.h>
+#include <wx/filename.h>
+#include <wx/stdpaths.h>
+
+#ifdef LP2D_USE_FONTCONFIG
+// fontconfig headers
+#include <fontconfig/fontconfig.h>
+#endif
 
 // Local headers
 #include "lp2d/utilities/fontFinder.h"
@@ -47,12 +55,74 @@ const unsigned int FontFinder::mFamilyNameRecordId(1);
 const unsigned int FontFinder::mSubFamilyNameRecordId(2);
 const unsigned int FontFinder::mFullNameRecordId(4);
 
+const std::string FontFinder::mIndexFileName("fontIndex.txt");
+const std::string FontFinder::mIndexFileHeader("LibPlot2D font index 1");
+
+std::shared_future<FontFinder::FontIndex> FontFinder::mIndex;
+std::mutex FontFinder::mIndexMutex;
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		BeginIndexing
+//
+// Description:		Starts preparing the font index in the background.  When
+//					fontconfig is used, no index is necessary.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FontFinder::BeginIndexing()
+{
+#ifndef LP2D_USE_FONTCONFIG
+	GetIndex();
+#endif
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		GetIndex
+//
+// Description:		Returns the font index, starting the background thread
+//					which prepares it if it has not yet been started.  Must be
+//					called from the main thread.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::shared_future<FontIndex>
+//
+//=============================================================================
+std::shared_future<FontFinder::FontIndex> FontFinder::GetIndex()
+{
+	std::lock_guard<std::mutex> lock(mIndexMutex);
+	if (!mIndex.valid())
+	{
+		// wxStandardPaths is not used from the worker thread
+		mIndex = std::async(std::launch::async, &FontFinder::PrepareIndex,
+			GetFontDirectory(), GetIndexFilePath()).share();
+	}
+
+	return mIndex;
+}
+
 //=============================================================================
 // Class:			FontFinder
 // Function:		GetFontFileName
 //
-// Description:		Searches the local hard drive (intelligently) and returns
-//					the path and file name for a preferred font.
+// Description:		Returns the path and file name for a preferred font.  When
+//					fontconfig is not used, the first call may block until the
+//					font index is ready.
 //
 // Input Arguments:
 //		fontName	= const wxString& name of the desired font
@@ -67,33 +137,351 @@ const unsigned int FontFinder::mFullNameRecordId(4);
 //=============================================================================
 wxString FontFinder::GetFontFileName(const wxString &fontName)
 {
-	wxString fontDirectory;
+#ifdef LP2D_USE_FONTCONFIG
+	// fontconfig knows about every font in the indexed directories, so
+	// there is no need to fall back to (and wait for) the index
+	return FindWithFontconfig(fontName);
+#else
+	const FontIndex& index(GetIndex().get());
+	const auto it(index.files.find(fontName.Lower().ToUTF8().data()));
+	if (it == index.files.end())
+		return wxEmptyString;
 
+	return wxString::FromUTF8(it->second.c_str());
+#endif
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		GetFontDirectory
+//
+// Description:		Returns the directory in which the system fonts are
+//					installed.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		wxString
+//
+//=============================================================================
+wxString FontFinder::GetFontDirectory()
+{
 #ifdef __WXMSW__
-	fontDirectory = wxGetOSDirectory() + _T("\\Fonts\\");
+	return wxGetOSDirectory() + _T("\\Fonts\\");
 #elif defined __WXGTK__
-	fontDirectory = _T("/usr/share/fonts/");
+	return _T("/usr/share/fonts/");
 #else
 	// Unknown platform - warn the user
 	#	warning "Unrecognized platform - unable to locate font files!"
 		return wxEmptyString;
 #endif
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		GetIndexFilePath
+//
+// Description:		Returns the path and file name of the saved font index.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		wxString
+//
+//=============================================================================
+wxString FontFinder::GetIndexFilePath()
+{
+	return wxFileName(wxStandardPaths::Get().GetUserLocalDataDir(),
+		mIndexFileName).GetFullPath();
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		PrepareIndex
+//
+// Description:		Loads the saved font index, or re-builds (and saves) it if
+//					it is missing or out-of-date.  Executed on a worker thread.
+//
+// Input Arguments:
+//		fontDirectory	= const wxString&
+//		indexFile		= const wxString&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		FontIndex
+//
+//=============================================================================
+FontFinder::FontIndex FontFinder::PrepareIndex(const wxString& fontDirectory,
+	const wxString& indexFile)
+{
+	// Unreadable directories are expected; don't report them to the user
+	wxLogNull noLog;
+
+	FontIndex index;
+	if (ReadIndex(indexFile, index) && IndexIsCurrent(index))
+		return index;
 
-	wxArrayString fontFiles;
-	wxDir::GetAllFiles(fontDirectory, &fontFiles, _T("*.ttf"), wxDIR_FILES | wxDIR_DIRS);
+	index = BuildIndex(fontDirectory);
+	WriteIndex(indexFile, index);
+	return index;
+}
 
-	wxString nameFromFile;
-	for (const auto& fontFile : fontFiles)
+//=============================================================================
+// Class:			FontFinder
+// Function:		BuildIndex
+//
+// Description:		Reads the names of all of the TrueType fonts in the
+//					specified directory (and its subdirectories).
+//
+// Input Arguments:
+//		fontDirectory	= const wxString&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		FontIndex
+//
+//=============================================================================
+FontFinder::FontIndex FontFinder::BuildIndex(const wxString& fontDirectory)
+{
+	FontIndex index;
+	if (fontDirectory.IsEmpty())
+		return index;
+
+	std::vector<wxString> pendingDirectories(1, fontDirectory);
+	while (!pendingDirectories.empty())
+	{
+		const wxString directory(pendingDirectories.back());
+		pendingDirectories.pop_back();
+
+		wxDir dir(directory);
+		if (!dir.IsOpened())
+			continue;
+
+		index.directories.push_back(std::make_pair(
+			std::string(directory.ToUTF8().data()),
+			wxFileModificationTime(directory)));
+
+		wxString name;
+		bool found(dir.GetFirst(&name, wxEmptyString, wxDIR_DIRS));
+		while (found)
+		{
+			pendingDirectories.push_back(dir.GetNameWithSep() + name);
+			found = dir.GetNext(&name);
+		}
+
+		wxString fontName;
+		found = dir.GetFirst(&name, _T("*.ttf"), wxDIR_FILES);
+		while (found)
+		{
+			const wxString fontFile(dir.GetNameWithSep() + name);
+			if (GetFontName(fontFile, fontName))
+				index.files.emplace(fontName.Lower().ToUTF8().data(),
+					fontFile.ToUTF8().data());
+			found = dir.GetNext(&name);
+		}
+	}
+
+	return index;
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		ReadIndex
+//
+// Description:		Reads the saved font index.
+//
+// Input Arguments:
+//		indexFile	= const wxString&
+//
+// Output Arguments:
+//		index		= FontIndex&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//=============================================================================
+bool FontFinder::ReadIndex(const wxString& indexFile, FontIndex& index)
+{
+	std::ifstream file(indexFile.mb_str(), std::ios::in);
+	if (!file.is_open())
+		return false;
+
+	std::string line;
+	if (!std::getline(file, line) || line != mIndexFileHeader)
+		return false;
+
+	// Each line is a type character, followed by two tab-separated fields
+	while (std::getline(file, line))
+	{
+		const std::string::size_type firstTab(line.find('\t'));
+		if (firstTab != 1)
+			return false;
+
+		const std::string::size_type secondTab(line.find('\t', firstTab + 1));
+		if (secondTab == std::string::npos)
+			return false;
+
+		const std::string first(line.substr(firstTab + 1,
+			secondTab - firstTab - 1));
+		const std::string second(line.substr(secondTab + 1));
+
+		if (line[0] == 'D')
+		{
+			std::istringstream ss(first);
+			long long modificationTime;
+			if (!(ss >> modificationTime))
+				return false;
+			index.directories.push_back(std::make_pair(second,
+				static_cast<std::time_t>(modificationTime)));
+		}
+		else if (line[0] == 'F')
+			index.files.emplace(first, second);
+		else
+			return false;
+	}
+
+	return true;
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		WriteIndex
+//
+// Description:		Saves the font index.  Failure is not an error; the index
+//					will be re-built the next time it is needed.
+//
+// Input Arguments:
+//		indexFile	= const wxString&
+//		index		= const FontIndex&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FontFinder::WriteIndex(const wxString& indexFile, const FontIndex& index)
+{
+	if (!wxFileName::Mkdir(wxFileName(indexFile).GetPath(), wxS_DIR_DEFAULT,
+		wxPATH_MKDIR_FULL))
+		return;
+
+	std::ofstream file(indexFile.mb_str(), std::ios::out | std::ios::trunc);
+	if (!file.is_open())
+		return;
+
+	file << mIndexFileHeader << '\n';
+	for (const auto& directory : index.directories)
+		file << "D\t" << static_cast<long long>(directory.second) << '\t'
+			<< directory.first << '\n';
+
+	for (const auto& font : index.files)
+		file << "F\t" << font.first << '\t' << font.second << '\n';
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		IndexIsCurrent
+//
+// Description:		Checks to see if any of the indexed directories have been
+//					modified since the index was built.  Adding or removing
+//					fonts (or subdirectories) changes the modification time of
+//					the containing directory.
+//
+// Input Arguments:
+//		index	= const FontIndex&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the index is up-to-date
+//
+//=============================================================================
+bool FontFinder::IndexIsCurrent(const FontIndex& index)
+{
+	if (index.directories.empty())
+		return false;
+
+	for (const auto& directory : index.directories)
 	{
-		if (GetFontName(fontFile, nameFromFile))
+		if (wxFileModificationTime(wxString::FromUTF8(
+			directory.first.c_str())) != directory.second)
+			return false;
+	}
+
+	return true;
+}
+
+#ifdef LP2D_USE_FONTCONFIG
+//=============================================================================
+// Class:			FontFinder
+// Function:		FindWithFontconfig
+//
+// Description:		Asks fontconfig for the regular style of the specified
+//					font family.
+//
+// Input Arguments:
+//		fontName	= const wxString&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		wxString containing the path to the font file, or an empty string
+//		if the font could not be located
+//
+//=============================================================================
+wxString FontFinder::FindWithFontconfig(const wxString &fontName)
+{
+	if (!FcInit())
+		return wxEmptyString;
+
+	FcPattern* pattern(FcPatternCreate());
+	FcPatternAddString(pattern, FC_FAMILY,
+		reinterpret_cast<const FcChar8*>(fontName.ToUTF8().data()));
+	FcConfigSubstitute(nullptr, pattern, FcMatchPattern);
+	FcDefaultSubstitute(pattern);
+
+	FcResult result;
+	FcPattern* match(FcFontMatch(nullptr, pattern, &result));
+	FcPatternDestroy(pattern);
+	if (!match)
+		return wxEmptyString;
+
+	// FcFontMatch() returns the closest available font, which may be a
+	// substitute, so we must check that the family is the one requested
+	wxString fontFile;
+	FcChar8* value;
+	int i(0);
+	while (FcPatternGetString(match, FC_FAMILY, i++, &value) == FcResultMatch)
+	{
+		if (fontName.CmpNoCase(wxString::FromUTF8(
+			reinterpret_cast<const char*>(value))) == 0)
 		{
-			if (fontName.CmpNoCase(nameFromFile) == 0)
-				return fontFile;
+			if (FcPatternGetString(match, FC_FILE, 0, &value) == FcResultMatch)
+				fontFile = wxString::FromUTF8(reinterpret_cast<const char*>(value));
+			break;
 		}
 	}
 
-	return wxEmptyString;
+	FcPatternDestroy(match);
+	return fontFile;
 }
+#endif
 
 //=============================================================================
 // Class:			FontFinder
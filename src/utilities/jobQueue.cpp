@@ -0,0 +1,467 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  jobQueue.cpp
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Pool of worker threads for executing long-running jobs, with support
+//        for progress reporting, cancellation and delivery of results to the
+//        main thread.
+
+// Local headers
+#include "lp2d/utilities/jobQueue.h"
+#include "lp2d/utilities/trace.h"
+
+// Standard C++ headers
+#include <algorithm>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			JobQueue
+// Function:		JobQueue
+//
+// Description:		Constructor for JobQueue class.
+//
+// Input Arguments:
+//		threadCount	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+JobQueue::JobQueue(const unsigned int& threadCount)
+{
+	// Always use at least two threads so that a short job is not stuck
+	// waiting behind a long one
+	unsigned int count(threadCount);
+	if (count == 0)
+		count = std::max(2U, std::thread::hardware_concurrency());
+
+	unsigned int i;
+	for (i = 0; i < count; ++i)
+		mThreads.push_back(std::thread(&JobQueue::WorkerLoop, this));
+}
+
+//=============================================================================
+// Class:			JobQueue
+// Function:		~JobQueue
+//
+// Description:		Destructor for JobQueue class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+JobQueue::~JobQueue()
+{
+	CancelAll();
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStopping = true;
+	}
+	mJobAvailable.notify_all();
+
+	for (auto& thread : mThreads)
+		thread.join();
+}
+
+//=============================================================================
+// Class:			JobQueue
+// Function:		Submit
+//
+// Description:		Adds a job to the queue.
+//
+// Input Arguments:
+//		description	= const wxString&
+//		work		= Work
+//		onCancelled	= std::function<void()>
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int, identifier of the new job
+//
+//=============================================================================
+unsigned int JobQueue::Submit(const wxString& description, Work work,
+	std::function<void()> onCancelled)
+{
+	std::shared_ptr<Job> job(std::make_shared<Job>());
+	job->description = description;
+	job->work = std::move(work);
+	job->onCancelled = std::move(onCancelled);
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		job->id = mNextId++;
+		mJobs.push_back(job);
+		mWaitingJobs.push_back(job);
+	}
+	mJobAvailable.notify_one();
+
+	return job->id;
+}
+
+//=============================================================================
+// Class:			JobQueue
+// Function:		Cancel
+//
+// Description:		Requests that the specified job be cancelled.
+//
+// Input Arguments:
+//		id	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void JobQueue::Cancel(const unsigned int& id)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	for (auto& job : mJobs)
+	{
+		if (job->id != id)
+			continue;
+
+		job->cancelled = true;
+		if (!job->running)
+		{
+			mWaitingJobs.erase(std::remove(mWaitingJobs.begin(),
+				mWaitingJobs.end(), job), mWaitingJobs.end());
+			job->finished = true;
+		}
+		return;
+	}
+}
+
+//=============================================================================
+// Class:			JobQueue
+// Function:		CancelAll
+//
+// Description:		Requests that all jobs be cancelled.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void JobQueue::CancelAll()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	for (auto& job : mJobs)
+	{
+		job->cancelled = true;
+		if (!job->running)
+			job->finished = true;
+	}
+	mWaitingJobs.clear();
+}
+
+//=============================================================================
+// Class:			JobQueue
+// Function:		GetStatus
+//
+// Description:		Gets the state of all jobs that have not yet completed.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<JobStatus>
+//
+//=============================================================================
+std::vector<JobQueue::JobStatus> JobQueue::GetStatus() const
+{
+	std::vector<JobStatus> status;
+	std::lock_guard<std::mutex> lock(mMutex);
+	for (const auto& job : mJobs)
+	{
+		if (job->finished || job->cancelled)
+			continue;
+
+		JobStatus s;
+		s.id = job->id;
+		s.description = job->description;
+		s.progress = job->progress;
+		s.running = job->running;
+		status.push_back(s);
+	}
+
+	return status;
+}
+
+//=============================================================================
+// Class:			JobQueue
+// Function:		IsIdle
+//
+// Description:		Checks to see if any jobs have not yet completed.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if there are no incomplete jobs
+//
+//=============================================================================
+bool JobQueue::IsIdle() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mJobs.empty();
+}
+
+//=============================================================================
+// Class:			JobQueue
+// Function:		ProcessPending
+//
+// Description:		Executes any functions posted to the main thread and
+//					removes finished jobs, notifying the owners of cancelled
+//					jobs as they are removed.  Must be called from the main
+//					thread.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void JobQueue::ProcessPending()
+{
+	// Swap the functions out prior to executing them, in case the functions
+	// result in a nested call to this method (i.e. by displaying a message box)
+	std::deque<PendingFunction> pending;
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		pending.swap(mPendingFunctions);
+	}
+
+	for (auto& function : pending)
+	{
+		if (!function.first->cancelled)
+			function.second();
+	}
+
+	std::vector<std::function<void()>> cancellations;
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		const auto removed(std::stable_partition(mJobs.begin(), mJobs.end(),
+			[this](const std::shared_ptr<Job>& job)
+		{
+			return !job->finished || std::any_of(mPendingFunctions.begin(),
+				mPendingFunctions.end(), [&job](const PendingFunction& f)
+			{
+				return f.first == job;
+			});
+		}));
+
+		for (auto it = removed; it != mJobs.end(); ++it)
+		{
+			if ((*it)->cancelled && (*it)->onCancelled)
+				cancellations.push_back(std::move((*it)->onCancelled));
+		}
+
+		mJobs.erase(removed, mJobs.end());
+	}
+
+	// Executed outside of the lock, as they may submit new jobs
+	for (auto& function : cancellations)
+		function();
+}
+
+//=============================================================================
+// Class:			JobQueue
+// Function:		WorkerLoop
+//
+// Description:		Main loop for worker threads.  Executes jobs as they become
+//					available.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void JobQueue::WorkerLoop()
+{
+	Trace::SetThreadName("JobQueue worker");
+
+	while (true)
+	{
+		std::shared_ptr<Job> job;
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mJobAvailable.wait(lock, [this]()
+			{
+				return mStopping || !mWaitingJobs.empty();
+			});
+
+			if (mStopping)
+				return;
+
+			job = mWaitingJobs.front();
+			mWaitingJobs.pop_front();
+			job->running = true;
+		}
+
+		Context context(*this, job);
+		job->work(context);
+
+		std::lock_guard<std::mutex> lock(mMutex);
+		job->finished = true;
+		job->work = nullptr;// Release anything captured by the job
+	}
+}
+
+//=============================================================================
+// Class:			JobQueue
+// Function:		Post
+//
+// Description:		Queues a function for execution on the main thread.
+//
+// Input Arguments:
+//		job			= const std::shared_ptr<Job>&
+//		function	= std::function<void()>
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void JobQueue::Post(const std::shared_ptr<Job>& job,
+	std::function<void()> function)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	mPendingFunctions.push_back(std::make_pair(job, std::move(function)));
+}
+
+//=============================================================================
+// Class:			JobQueue::Context
+// Function:		SetProgress
+//
+// Description:		Reports the progress of the job.
+//
+// Input Arguments:
+//		fraction	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void JobQueue::Context::SetProgress(const double& fraction)
+{
+	mJob->progress = std::min(std::max(fraction, 0.0), 1.0);
+}
+
+//=============================================================================
+// Class:			JobQueue::Context
+// Function:		IsCancelled
+//
+// Description:		Checks to see if the job was cancelled.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the job was cancelled
+//
+//=============================================================================
+bool JobQueue::Context::IsCancelled() const
+{
+	return mJob->cancelled;
+}
+
+//=============================================================================
+// Class:			JobQueue::Context
+// Function:		PostToMainThread
+//
+// Description:		Queues a function for execution on the main thread.
+//
+// Input Arguments:
+//		function	= std::function<void()>
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void JobQueue::Context::PostToMainThread(std::function<void()> function)
+{
+	mQueue.Post(mJob, std::move(function));
+}
+
+//=============================================================================
+// Class:			JobQueue::Context
+// Function:		ShowMessage
+//
+// Description:		Queues a message to be displayed on the main thread.
+//
+// Input Arguments:
+//		message	= const wxString&
+//		caption	= const wxString&
+//		style	= const long&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void JobQueue::Context::ShowMessage(const wxString& message,
+	const wxString& caption, const long& style)
+{
+	PostToMainThread([message, caption, style]()
+	{
+		wxMessageBox(message, caption, style);
+	});
+}
+
+}// namespace LibPlot2D
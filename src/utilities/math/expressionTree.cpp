@@ -20,6 +20,7 @@
 #include "lp2d/utilities/signals/integral.h"
 #include "lp2d/utilities/signals/fft.h"
 #include "lp2d/utilities/math/plotMath.h"
+#include "lp2d/utilities/trace.h"
 
 namespace LibPlot2D
 {
@@ -86,6 +87,8 @@ const unsigned int ExpressionTree::mPrintfPrecision = 15;
 wxString ExpressionTree::Solve(wxString expression, Dataset2D &solvedData,
 	const double &xAxisFactor)
 {
+	LP2D_TRACE_SCOPE("math", "ExpressionTree::Solve");
+
 	mXAxisFactor = xAxisFactor;
 
 	if (!ParenthesesBalanced(expression))
@@ -121,6 +124,8 @@ wxString ExpressionTree::Solve(wxString expression, Dataset2D &solvedData,
 std::string ExpressionTree::Solve(std::string expression,
 	std::string &solvedExpression)
 {
+	LP2D_TRACE_SCOPE("math", "ExpressionTree::Solve");
+
 	if (!ParenthesesBalanced(expression))
 		return "Imbalanced parentheses!";
 
@@ -0,0 +1,275 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  rollingHistogram.cpp
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Distribution of the most recent samples of a quantity, with bins
+//        which double in width (for timing and size measurements).
+
+// Local headers
+#include "lp2d/utilities/rollingHistogram.h"
+
+// Standard C++ headers
+#include <cassert>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			RollingHistogram
+// Function:		RollingHistogram
+//
+// Description:		Constructor for RollingHistogram class.
+//
+// Input Arguments:
+//		capacity		= const unsigned int&
+//		firstBinLimit	= const double&
+//		binCount		= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+RollingHistogram::RollingHistogram(const unsigned int& capacity,
+	const double& firstBinLimit, const unsigned int& binCount)
+	: mCapacity(capacity), mFirstBinLimit(firstBinLimit),
+	mBinCounts(binCount, 0)
+{
+	assert(capacity > 0);
+	assert(firstBinLimit > 0.0);
+	assert(binCount > 0);
+	mSamples.reserve(mCapacity);
+}
+
+//=============================================================================
+// Class:			RollingHistogram
+// Function:		Add
+//
+// Description:		Adds a sample, replacing the oldest sample if the capacity
+//					has been reached.
+//
+// Input Arguments:
+//		value	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RollingHistogram::Add(const double& value)
+{
+	if (mSamples.size() < mCapacity)
+		mSamples.push_back(value);
+	else
+	{
+		--mBinCounts[GetBin(mSamples[mNext])];
+		mSamples[mNext] = value;
+	}
+
+	++mBinCounts[GetBin(value)];
+	mNext = (mNext + 1) % mCapacity;
+}
+
+//=============================================================================
+// Class:			RollingHistogram
+// Function:		Clear
+//
+// Description:		Discards all samples.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RollingHistogram::Clear()
+{
+	mSamples.clear();
+	mNext = 0;
+	std::fill(mBinCounts.begin(), mBinCounts.end(), 0);
+}
+
+//=============================================================================
+// Class:			RollingHistogram
+// Function:		GetLast
+//
+// Description:		Returns the most recently added sample.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//=============================================================================
+double RollingHistogram::GetLast() const
+{
+	if (mSamples.empty())
+		return 0.0;
+
+	return mSamples[(mNext + mCapacity - 1) % mCapacity];
+}
+
+//=============================================================================
+// Class:			RollingHistogram
+// Function:		GetMean
+//
+// Description:		Returns the mean of the retained samples.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//=============================================================================
+double RollingHistogram::GetMean() const
+{
+	if (mSamples.empty())
+		return 0.0;
+
+	return std::accumulate(mSamples.begin(), mSamples.end(), 0.0)
+		/ mSamples.size();
+}
+
+//=============================================================================
+// Class:			RollingHistogram
+// Function:		GetMaximum
+//
+// Description:		Returns the largest of the retained samples.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//=============================================================================
+double RollingHistogram::GetMaximum() const
+{
+	if (mSamples.empty())
+		return 0.0;
+
+	return *std::max_element(mSamples.begin(), mSamples.end());
+}
+
+//=============================================================================
+// Class:			RollingHistogram
+// Function:		GetPercentile
+//
+// Description:		Returns the value below which the specified fraction of the
+//					retained samples lie (nearest-rank method).
+//
+// Input Arguments:
+//		fraction	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//=============================================================================
+double RollingHistogram::GetPercentile(const double& fraction) const
+{
+	if (mSamples.empty())
+		return 0.0;
+
+	const double clamped(std::min(std::max(fraction, 0.0), 1.0));
+	const unsigned int rank(std::min(static_cast<unsigned int>(
+		clamped * mSamples.size()),
+		static_cast<unsigned int>(mSamples.size()) - 1));
+
+	std::vector<double> sorted(mSamples);
+	std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+	return sorted[rank];
+}
+
+//=============================================================================
+// Class:			RollingHistogram
+// Function:		GetBinUpperLimit
+//
+// Description:		Returns the upper limit of the specified bin.
+//
+// Input Arguments:
+//		bin	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//=============================================================================
+double RollingHistogram::GetBinUpperLimit(const unsigned int& bin) const
+{
+	assert(bin < mBinCounts.size());
+	if (bin + 1 == mBinCounts.size())
+		return std::numeric_limits<double>::infinity();
+
+	double limit(mFirstBinLimit);
+	unsigned int i;
+	for (i = 0; i < bin; ++i)
+		limit *= 2.0;
+
+	return limit;
+}
+
+//=============================================================================
+// Class:			RollingHistogram
+// Function:		GetBin
+//
+// Description:		Returns the index of the bin into which the specified
+//					value falls.
+//
+// Input Arguments:
+//		value	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//=============================================================================
+unsigned int RollingHistogram::GetBin(const double& value) const
+{
+	unsigned int bin(0);
+	double limit(mFirstBinLimit);
+	while (bin + 1 < mBinCounts.size() && value >= limit)
+	{
+		limit *= 2.0;
+		++bin;
+	}
+
+	return bin;
+}
+
+}// namespace LibPlot2D
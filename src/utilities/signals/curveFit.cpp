@@ -14,6 +14,7 @@
 // Local headers
 #include "lp2d/utilities/signals/curveFit.h"
 #include "lp2d/utilities/dataset2D.h"
+#include "lp2d/utilities/trace.h"
 
 // Eigen headers
 #include <Eigen/Dense>
@@ -48,6 +49,8 @@ namespace LibPlot2D
 CurveFit::PolynomialFit CurveFit::DoPolynomialFit(const Dataset2D &data,
 	const unsigned int &order)
 {
+	LP2D_TRACE_SCOPE("signal", "CurveFit::DoPolynomialFit");
+
 	PolynomialFit fit;
 	fit.coefficients.resize(order + 1);
 	fit.order = order;
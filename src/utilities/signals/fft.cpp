@@ -20,6 +20,7 @@
 #include "lp2d/utilities/dataset2D.h"
 #include "lp2d/utilities/math/plotMath.h"
 #include "lp2d/utilities/signals/derivative.h"
+#include "lp2d/utilities/trace.h"
 
 namespace LibPlot2D
 {
@@ -77,6 +78,8 @@ std::unique_ptr<Dataset2D> FastFourierTransform::ComputeFFT(
 	Dataset2D data, const WindowType &window,
 	unsigned int windowSize, const double &overlap, const bool &subtractMean)
 {
+	LP2D_TRACE_SCOPE("signal", "FastFourierTransform::ComputeFFT");
+
 	double sampleRate = 1.0 / data.GetAverageDeltaX();// [Hz]
 
 	if (subtractMean)
@@ -300,6 +303,8 @@ void FastFourierTransform::ComputeFRF(const Dataset2D &input,
 	const WindowType &window, const bool &moduloPhase, Dataset2D& amplitude,
 	Dataset2D* phase, Dataset2D* coherence)
 {
+	LP2D_TRACE_SCOPE("signal", "FastFourierTransform::ComputeFRF");
+
 	assert(input.GetNumberOfPoints() == output.GetNumberOfPoints());
 
 	unsigned int i, windowSize;
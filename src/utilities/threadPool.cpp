@@ -0,0 +1,261 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  threadPool.cpp
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Pool of worker threads for splitting short, CPU-bound loops (such as
+//        building curve geometry) across all available cores.
+
+// Local headers
+#include "lp2d/utilities/threadPool.h"
+#include "lp2d/utilities/trace.h"
+
+// Standard C++ headers
+#include <algorithm>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			ThreadPool
+// Function:		Constant declarations
+//
+// Description:		Constant declarations for ThreadPool class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+thread_local bool ThreadPool::mInsideLoop(false);
+
+//=============================================================================
+// Class:			ThreadPool
+// Function:		ThreadPool
+//
+// Description:		Constructor for ThreadPool class.
+//
+// Input Arguments:
+//		workerCount	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+ThreadPool::ThreadPool(const unsigned int& workerCount)
+{
+	unsigned int i;
+	for (i = 0; i < workerCount; ++i)
+		mThreads.push_back(std::thread(&ThreadPool::WorkerLoop, this));
+}
+
+//=============================================================================
+// Class:			ThreadPool
+// Function:		~ThreadPool
+//
+// Description:		Destructor for ThreadPool class.  Stops the worker threads.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStopping = true;
+	}
+	mWorkCondition.notify_all();
+
+	for (auto& t : mThreads)
+		t.join();
+}
+
+//=============================================================================
+// Class:			ThreadPool
+// Function:		GetSharedPool
+//
+// Description:		Returns the pool shared by all renderers.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		ThreadPool&
+//
+//=============================================================================
+ThreadPool& ThreadPool::GetSharedPool()
+{
+	static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1U) - 1);
+	return pool;
+}
+
+//=============================================================================
+// Class:			ThreadPool
+// Function:		ParallelFor
+//
+// Description:		Executes the loop iterations on the worker threads and the
+//					calling thread.  Calls made from within a loop body (on
+//					any thread) are executed serially, as are calls made while
+//					another thread is running a loop on the pool.
+//
+// Input Arguments:
+//		count		= const unsigned int&
+//		function	= const std::function<void(const unsigned int&)>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void ThreadPool::ParallelFor(const unsigned int& count,
+	const std::function<void(const unsigned int&)>& function)
+{
+	std::unique_lock<std::mutex> runLock;
+	if (count > 1 && !mThreads.empty() && !mInsideLoop)
+		runLock = std::unique_lock<std::mutex>(mRunMutex, std::try_to_lock);
+
+	if (!runLock.owns_lock())
+	{
+		unsigned int i;
+		for (i = 0; i < count; ++i)
+			function(i);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mFunction = &function;
+		mCount = count;
+		mNext = 0;
+		mBusyWorkers = mThreads.size();
+		mException = nullptr;
+		mFailed = false;
+		++mGeneration;
+	}
+	mWorkCondition.notify_all();
+
+	mInsideLoop = true;
+	RunIterations();
+	mInsideLoop = false;
+
+	std::exception_ptr exception;
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		mDoneCondition.wait(lock, [this]() { return mBusyWorkers == 0; });
+		mFunction = nullptr;
+		exception = mException;
+	}
+
+	if (exception)
+		std::rethrow_exception(exception);
+}
+
+//=============================================================================
+// Class:			ThreadPool
+// Function:		WorkerLoop
+//
+// Description:		Main loop for worker threads.  Waits for a new loop to be
+//					started, then executes iterations until none remain.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void ThreadPool::WorkerLoop()
+{
+	Trace::SetThreadName("ThreadPool worker");
+	mInsideLoop = true;
+
+	unsigned long long generation(0);
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mWorkCondition.wait(lock, [this, &generation]()
+			{
+				return mStopping || mGeneration != generation;
+			});
+
+			if (mStopping)
+				return;
+			generation = mGeneration;
+		}
+
+		RunIterations();
+
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (--mBusyWorkers == 0)
+			mDoneCondition.notify_one();
+	}
+}
+
+//=============================================================================
+// Class:			ThreadPool
+// Function:		RunIterations
+//
+// Description:		Executes iterations of the current loop until none remain.
+//					After an iteration throws, the remaining iterations are
+//					skipped.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void ThreadPool::RunIterations()
+{
+	unsigned int i;
+	while ((i = mNext++) < mCount && !mFailed)
+	{
+		try
+		{
+			(*mFunction)(i);
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (!mException)
+				mException = std::current_exception();
+			mFailed = true;
+		}
+	}
+}
+
+}// namespace LibPlot2D
@@ -0,0 +1,296 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  trace.cpp
+// Date:  10/18/2026
+// Auth:  K. Loux
+// Desc:  Records timed events from all threads for viewing in the Chrome
+//        trace viewer (chrome://tracing or Perfetto).
+
+// Local headers
+#include "lp2d/utilities/trace.h"
+
+// Standard C++ headers
+#include <fstream>
+#include <iomanip>
+#include <locale>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			Trace
+// Function:		Constant declarations
+//
+// Description:		Constant declarations for Trace class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+// Roughly 40 MB of events
+const std::size_t Trace::mMaxEventCount(1000000);
+const Trace::Clock::time_point Trace::mEpoch(Trace::Clock::now());
+
+std::atomic<bool> Trace::mEnabled(false);
+std::atomic<unsigned int> Trace::mNextThreadId(1);
+
+std::mutex Trace::mMutex;
+std::vector<Trace::Event> Trace::mEvents;
+std::map<unsigned int, std::string> Trace::mThreadNames;
+
+//=============================================================================
+// Class:			Trace
+// Function:		SetEnabled
+//
+// Description:		Enables or disables the collection of events.
+//
+// Input Arguments:
+//		enabled	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void Trace::SetEnabled(const bool& enabled)
+{
+	mEnabled = enabled;
+}
+
+//=============================================================================
+// Class:			Trace
+// Function:		Clear
+//
+// Description:		Discards all collected events.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void Trace::Clear()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	mEvents.clear();
+	mEvents.shrink_to_fit();
+}
+
+//=============================================================================
+// Class:			Trace
+// Function:		SetThreadName
+//
+// Description:		Sets the name which identifies the calling thread.
+//
+// Input Arguments:
+//		name	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void Trace::SetThreadName(const std::string& name)
+{
+	const unsigned int threadId(GetThreadId());
+	std::lock_guard<std::mutex> lock(mMutex);
+	mThreadNames[threadId] = name;
+}
+
+//=============================================================================
+// Class:			Trace
+// Function:		WriteChromeTrace
+//
+// Description:		Writes the collected events to the specified file.
+//
+// Input Arguments:
+//		fileName	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//=============================================================================
+bool Trace::WriteChromeTrace(const std::string& fileName)
+{
+	std::ofstream file(fileName);
+	if (!file.is_open())
+		return false;
+
+	WriteChromeTrace(file);
+	return file.good();
+}
+
+//=============================================================================
+// Class:			Trace
+// Function:		WriteChromeTrace
+//
+// Description:		Writes the collected events to the specified stream.  Each
+//					scope is written as a complete ("X") event, with times in
+//					microseconds since the application started.
+//
+// Input Arguments:
+//		stream	= std::ostream&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void Trace::WriteChromeTrace(std::ostream& stream)
+{
+	// JSON requires '.' as the decimal separator, regardless of user locale
+	stream.imbue(std::locale::classic());
+	stream << std::fixed << std::setprecision(3);
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+	bool first(true);
+	for (const auto& thread : mThreadNames)
+	{
+		if (!first)
+			stream << ',';
+		first = false;
+
+		stream << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+			<< thread.first << ",\"args\":{\"name\":\""
+			<< EscapeString(thread.second) << "\"}}";
+	}
+
+	typedef std::chrono::duration<double, std::micro> Microseconds;
+	for (const auto& e : mEvents)
+	{
+		if (!first)
+			stream << ',';
+		first = false;
+
+		stream << "\n{\"name\":\"" << EscapeString(e.name)
+			<< "\",\"cat\":\"" << EscapeString(e.category)
+			<< "\",\"ph\":\"X\",\"ts\":"
+			<< Microseconds(e.start - mEpoch).count()
+			<< ",\"dur\":" << Microseconds(e.duration).count()
+			<< ",\"pid\":1,\"tid\":" << e.threadId << '}';
+	}
+
+	stream << "\n]}\n";
+}
+
+//=============================================================================
+// Class:			Trace
+// Function:		GetThreadId
+//
+// Description:		Returns a small integer which identifies the calling
+//					thread.  Identifiers are assigned in order of first use and
+//					are never re-used.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//=============================================================================
+unsigned int Trace::GetThreadId()
+{
+	thread_local const unsigned int threadId(mNextThreadId++);
+	return threadId;
+}
+
+//=============================================================================
+// Class:			Trace
+// Function:		Record
+//
+// Description:		Adds an event ending now to the list.
+//
+// Input Arguments:
+//		category	= const char*
+//		name		= const char*
+//		start		= const Clock::time_point&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void Trace::Record(const char* category, const char* name,
+	const Clock::time_point& start)
+{
+	Event e;
+	e.category = category;
+	e.name = name;
+	e.start = start;
+	e.duration = Clock::now() - start;
+	e.threadId = GetThreadId();
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (mEvents.size() < mMaxEventCount)
+		mEvents.push_back(e);
+}
+
+//=============================================================================
+// Class:			Trace
+// Function:		EscapeString
+//
+// Description:		Escapes characters with special meaning in JSON strings.
+//
+// Input Arguments:
+//		s	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string
+//
+//=============================================================================
+std::string Trace::EscapeString(const std::string& s)
+{
+	std::string escaped;
+	escaped.reserve(s.size());
+	for (const auto& c : s)
+	{
+		if (c == '"' || c == '\\')
+		{
+			escaped.push_back('\\');
+			escaped.push_back(c);
+		}
+		else if (static_cast<unsigned char>(c) < 0x20)
+			escaped.push_back(' ');
+		else
+			escaped.push_back(c);
+	}
+
+	return escaped;
+}
+
+}// namespace LibPlot2D